@@ -2,12 +2,13 @@
 
 // Common dependencies
 #include <stdlib.h> // malloc, free
-#include <string.h> // memcpy
+#include <string.h> // memcpy, memset
 
 // Linux dependencies
 #ifdef __linux__
-#include <unistd.h>       // getpagesize, sysconf, _SC_PAGESIZE, ftruncate, getpid, close, lseek
-#include <stdio.h>        // FILE, fopen, perror, feof, fscanf, fclose, snprintf, unlink
+#include <unistd.h>       // getpagesize, sysconf, _SC_PAGESIZE, ftruncate, getpid, close, lseek, pread
+#include <stdio.h>        // FILE, fopen, perror, feof, fscanf, fclose, snprintf, sscanf, unlink
+#include <dirent.h>       // DIR, struct dirent, opendir, readdir, closedir
 #include <mntent.h>       // struct mntent, getmntent
 #include <string.h>       // strcmp
 #include <linux/limits.h> // PATH_MAX
@@ -16,8 +17,88 @@
 #include <sys/mman.h>     // mmap, mlock, PROT_READ, PROT_WRITE, PROT_EXEC, MAP_SHARED, MAP_HUGETLB, MAP_LOCKED, MAP_NORESERVE, MAP_FAILED, munmap
 #include <sys/stat.h>     // struct stat, fstat
 #include <stdint.h>       // uint_t, uintptr_t
+#include <inttypes.h>     // PRId64
+#include <sys/ioctl.h>    // ioctl
+#include <sys/syscall.h>  // __NR_perf_event_open, SYS_mbind, SYS_get_mempolicy
+#include <linux/mempolicy.h>  // MPOL_BIND, MPOL_PREFERRED, MPOL_F_ADDR
+#include <linux/perf_event.h> // struct perf_event_attr, PERF_TYPE_HW_CACHE, PERF_EVENT_IOC_RESET, PERF_EVENT_IOC_ENABLE, PERF_EVENT_IOC_DISABLE
 #endif
 
+// x86 dependencies
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h> // __m128i, __m256i, _mm_loadu_si128, _mm_storeu_si128, _mm_set1_epi8, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_set1_epi8
+#endif
+
+// Packet buffer layout (see PacketBufferWrapperConstants)
+#define PAP_OFFSET     0  // Offset of the physical address of the packet buffer
+#define OFL_OFFSET     16 // Offset of the offload flags
+#define PKT_OFFSET     20 // Offset of the packet size
+#define RSS_OFFSET     24 // Offset of the RSS hash
+#define RXF_OFFSET     28 // Offset of the RX flags
+#define VLN_OFFSET     32 // Offset of the VLAN tag
+#define SEG_OFFSET     34 // Offset of the number of segments
+#define MSS_OFFSET     36 // Offset of the maximum segment size
+#define NXT_OFFSET     40 // Offset of the virtual address of the next segment
+#define PAYLOAD_OFFSET 64 // Offset of the packet data
+
+// Packet buffer offload flags (see PacketBufferWrapperConstants)
+#define OFL_LENS_MASK       0xffff     // MAC and IP header lengths, laid out like in a context descriptor
+#define OFL_L2_LENGTH_SHIFT 9          // Shift of the layer 2 header length
+#define OFL_L2_LENGTH_MASK  0x7f       // Mask of the layer 2 header length
+#define OFL_L3_LENGTH_MASK  0x1ff      // Mask of the layer 3 header length
+#define OFL_L4_LENGTH_SHIFT 16         // Shift of the layer 4 header length
+#define OFL_L4_LENGTH_MASK  0xff       // Mask of the layer 4 header length
+#define OFL_IP_CHECKSUM     (1u << 24) // Insert the IPv4 header checksum
+#define OFL_UDP_CHECKSUM    (1u << 25) // Insert the UDP checksum
+#define OFL_TCP_CHECKSUM    (1u << 26) // Insert the TCP checksum
+#define OFL_IPV6            (1u << 27) // The layer 3 header is an IPv6 header
+#define OFL_TSO             (1u << 28) // Split the TCP payload in segments of the maximum segment size
+
+// Packet buffer RX flags (see PacketBufferWrapperConstants)
+#define RXF_IPV4             (1u << 0)  // The layer 3 header is an IPv4 header
+#define RXF_IPV6             (1u << 1)  // The layer 3 header is an IPv6 header
+#define RXF_TCP              (1u << 2)  // The layer 4 header is a TCP header
+#define RXF_UDP              (1u << 3)  // The layer 4 header is a UDP header
+#define RXF_SCTP             (1u << 4)  // The layer 4 header is an SCTP header
+#define RXF_IP_CHECKSUM_GOOD (1u << 5)  // The IPv4 header checksum was verified and is right
+#define RXF_IP_CHECKSUM_BAD  (1u << 6)  // The IPv4 header checksum was verified and is wrong
+#define RXF_L4_CHECKSUM_GOOD (1u << 7)  // The layer 4 checksum was verified and is right
+#define RXF_L4_CHECKSUM_BAD  (1u << 8)  // The layer 4 checksum was verified and is wrong
+#define RXF_RSS_HASH         (1u << 9)  // The RSS hash is valid
+#define RXF_VLAN             (1u << 10) // The VLAN tag is valid
+
+// Ixgbe advanced descriptor layout and flags (see IxgbeDefs)
+#define IXGBE_DESCRIPTOR_SIZE        16         // Size of a descriptor
+#define IXGBE_RXDADV_STAT_DD         0x01       // Descriptor done
+#define IXGBE_RXDADV_STAT_EOP        0x02       // End of packet
+#define IXGBE_RXDADV_STAT_VP         0x08       // 802.1Q tagged packet
+#define IXGBE_RXDADV_STAT_L4CS       0x20       // Layer 4 checksum verified
+#define IXGBE_RXDADV_STAT_IPCS       0x40       // IPv4 header checksum verified
+#define IXGBE_RXDADV_ERR_TCPE        0x40000000 // Layer 4 checksum error
+#define IXGBE_RXDADV_ERR_IPE         0x80000000 // IPv4 header checksum error
+#define IXGBE_RXDADV_RSSTYPE_MASK    0x0000000f // RSS type
+#define IXGBE_RXDADV_PKTTYPE_IPV4    0x00000010 // IPv4 header
+#define IXGBE_RXDADV_PKTTYPE_IPV4_EX 0x00000020 // IPv4 header with options
+#define IXGBE_RXDADV_PKTTYPE_IPV6    0x00000040 // IPv6 header
+#define IXGBE_RXDADV_PKTTYPE_IPV6_EX 0x00000080 // IPv6 header with extensions
+#define IXGBE_RXDADV_PKTTYPE_TCP     0x00000100 // TCP header
+#define IXGBE_RXDADV_PKTTYPE_UDP     0x00000200 // UDP header
+#define IXGBE_RXDADV_PKTTYPE_SCTP    0x00000400 // SCTP header
+#define IXGBE_RXDADV_PKTTYPE_ETQF    0x00008000 // EtherType filter match, the packet type is not valid
+#define IXGBE_ADVTXD_PAYLEN_SHIFT    14         // Payload length shift
+#define IXGBE_ADVTXD_DCMD_EOP        0x01000000 // End of packet
+#define IXGBE_ADVTXD_DCMD_RS         0x08000000 // Report status
+#define IXGBE_ADVTXD_DTYP_CTXT       0x00200000 // Advanced context descriptor
+#define IXGBE_ADVTXD_DCMD_DEXT       0x20000000 // Descriptor extension
+#define IXGBE_ADVTXD_DCMD_TSE        0x80000000 // TCP segmentation enable
+#define IXGBE_ADVTXD_CC              0x00000080 // Check context
+#define IXGBE_ADVTXD_POPTS_IXSM      0x00000100 // Insert the IP checksum
+#define IXGBE_ADVTXD_POPTS_TXSM      0x00000200 // Insert the TCP/UDP checksum
+#define IXGBE_ADVTXD_TUCMD_IPV4      0x00000400 // IP packet type: IPv4
+#define IXGBE_ADVTXD_TUCMD_L4T_TCP   0x00000800 // L4 packet type: TCP
+#define IXGBE_ADVTXD_L4LEN_SHIFT     8          // Layer 4 header length shift
+#define IXGBE_ADVTXD_MSS_SHIFT       16         // Maximum segment size shift
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -34,6 +115,116 @@ Java_de_tum_in_net_ixy_memory_FastestMemoryManager_c_1is_1valid(const JNIEnv *en
 // Huge memory page id counter
 static unsigned int hugepageid = 0;
 
+#ifdef __linux__
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+// Maximum number of NUMA nodes of a node mask
+#define NUMA_MAX_NODES 1024
+#define NUMA_MASK_BITS (8 * sizeof(unsigned long))
+
+// Binds a memory region to a NUMA node, which must be done before its pages are faulted in
+static void numa_bind(void *addr, const jlong size, const jint node) {
+	if (node < 0 || node >= NUMA_MAX_NODES) return;
+	unsigned long mask[NUMA_MAX_NODES / NUMA_MASK_BITS] = {0};
+	mask[node / NUMA_MASK_BITS] = 1UL << (node % NUMA_MASK_BITS);
+	if (syscall(SYS_mbind, addr, (unsigned long) size, MPOL_BIND, mask, NUMA_MAX_NODES + 1, 0) != 0) {
+		perror("Error binding the memory region to the NUMA node");
+		fflush(stderr);
+	}
+}
+
+// Returns the NUMA node the memory policy of an address binds it to, or -1 if there is none
+static jint numa_node(void *addr) {
+	int mode = 0;
+	unsigned long mask[NUMA_MAX_NODES / NUMA_MASK_BITS] = {0};
+	if (syscall(SYS_get_mempolicy, &mode, mask, NUMA_MAX_NODES + 1, addr, MPOL_F_ADDR) != 0) {
+		perror("Error reading the memory policy");
+		fflush(stderr);
+		return -1;
+	}
+	if (mode != MPOL_BIND && mode != MPOL_PREFERRED) return -1;
+	for (jint i = 0; i < NUMA_MAX_NODES / NUMA_MASK_BITS; i++) {
+		if (mask[i] != 0) return (jint) (i * NUMA_MASK_BITS + __builtin_ctzl(mask[i]));
+	}
+	return -1;
+}
+
+// Computes the mmap flags that select anonymous huge memory pages of the given size
+static int hugepage_flags(const jlong pagesize) {
+	return MAP_HUGETLB | (__builtin_ctzll((unsigned long long) pagesize) << MAP_HUGE_SHIFT);
+}
+
+// Maps anonymous huge memory pages of the given size, which do not need a hugetlbfs mount
+static jlong hugepage_anonymous(const jlong size, const jboolean lock, const jlong pagesize, const jint node) {
+	int flags = MAP_SHARED | MAP_ANONYMOUS | hugepage_flags(pagesize);
+	if (lock && node < 0) flags |= MAP_LOCKED;
+	void *virt_addr = mmap(NULL, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+	if (virt_addr == MAP_FAILED) {
+		perror("Error mmap-ing anonymous huge memory pages");
+		fflush(stderr);
+		return 0;
+	}
+
+	// Bind the memory to the NUMA node before locking faults the pages in
+	numa_bind(virt_addr, size, node);
+
+	// Prevent the allocated memory to be swapped
+	if (lock && mlock(virt_addr, size) != 0) {
+		perror("Error locking the allocated memory");
+		fflush(stderr);
+		munmap(virt_addr, size);
+		return 0;
+	}
+	return (jlong) virt_addr;
+}
+
+// Checks whether an anonymous huge memory page of the given size can be mapped
+static jboolean hugepage_probe(const jlong pagesize) {
+	void *virt_addr = mmap(NULL, pagesize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS | hugepage_flags(pagesize), -1, 0);
+	if (virt_addr == MAP_FAILED) return JNI_FALSE;
+	if (munmap(virt_addr, pagesize) != 0) {
+		perror("Error munmap-ing the probed huge memory page");
+		fflush(stderr);
+	}
+	return JNI_TRUE;
+}
+
+// Directory where the kernel publishes a pool per supported huge memory page size
+#define HUGEPAGES_PATH "/sys/kernel/mm/hugepages"
+
+// Reads a counter of a huge memory page pool
+static long hugepage_counter(const char *pool, const char *name) {
+	char path[PATH_MAX];
+	snprintf(path, PATH_MAX, HUGEPAGES_PATH "/%s/%s", pool, name);
+	FILE *fp = fopen(path, "r");
+	if (fp == NULL) return 0;
+	long value = 0;
+	if (fscanf(fp, "%ld", &value) != 1) value = 0;
+	fclose(fp);
+	return value;
+}
+
+// Stores in ascending order the sizes of the huge memory page pools that have free or overcommittable pages
+static jint hugepage_sizes(jlong *sizes, const jint max) {
+	DIR *dir = opendir(HUGEPAGES_PATH);
+	if (dir == NULL) return 0;
+	jint count = 0;
+	for (const struct dirent *entry = readdir(dir); entry != NULL && count < max; entry = readdir(dir)) {
+		unsigned long kib = 0;
+		if (sscanf(entry->d_name, "hugepages-%lukB", &kib) != 1) continue;
+		if (hugepage_counter(entry->d_name, "free_hugepages") <= 0 && hugepage_counter(entry->d_name, "nr_overcommit_hugepages") <= 0) continue;
+		const jlong size = (jlong) kib * 1024;
+		jint i = count++;
+		for (; i > 0 && sizes[i - 1] > size; i--) sizes[i] = sizes[i - 1];
+		sizes[i] = size;
+	}
+	closedir(dir);
+	return count;
+}
+#endif
+
 JNIEXPORT jlong JNICALL
 Java_de_tum_in_net_ixy_memory_FastestMemoryManager_c_1allocate(JNIEnv *env, const jclass klass, const jlong size, jstring mnt) {
 #ifdef __linux__
@@ -188,8 +379,17 @@ Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1is_1valid(const JNIEnv
 #endif
 }
 
+JNIEXPORT jboolean JNICALL
+Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1hugepage_1probe(const JNIEnv *env, const jclass klass, const jlong pagesize) {
+#ifdef __linux__
+	return hugepage_probe(pagesize);
+#else
+	return JNI_FALSE;
+#endif
+}
+
 JNIEXPORT jlong JNICALL
-Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1allocate(JNIEnv *env, const jclass klass, const jlong size, const jboolean huge, const jboolean lock, jstring mnt) {
+Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1allocate(JNIEnv *env, const jclass klass, const jlong size, const jboolean huge, const jboolean lock, jstring mnt, const jlong pagesize, const jint node) {
 	// If no huge memory pages should be employed, then use the simple C memory allocation function
 	if (!huge) {
 		void *addr = malloc((size_t) size);
@@ -207,6 +407,9 @@ Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1allocate(JNIEnv *env,
 	}
 
 #ifdef __linux__
+	// Anonymous huge memory pages do not need any file
+	if (pagesize > 0) return hugepage_anonymous(size, lock, pagesize, node);
+
 	// Get the prefix
 	char *prefix = (*env)->GetStringUTFChars(env, mnt, NULL);
 
@@ -235,14 +438,17 @@ Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1allocate(JNIEnv *env,
 
 	// Map the hugepage file to memory
 	int flags = MAP_SHARED;
-	if (lock) flags |= MAP_LOCKED;
-	const void *virt_addr = mmap(NULL, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+	if (lock && node < 0) flags |= MAP_LOCKED;
+	void *virt_addr = mmap(NULL, size, PROT_READ | PROT_WRITE, flags, fd, 0);
 	if (virt_addr == MAP_FAILED) {
 		perror("Error mmap-ing the hugepage file");
 		fflush(stderr);
 		return 0;
 	}
 
+	// Bind the memory to the NUMA node before locking faults the pages in
+	numa_bind(virt_addr, size, node);
+
 	// Prevent the allocated memory to be swapped
 	if (lock && mlock(virt_addr, size) != 0) {
 		perror("Error locking the allocated memory");
@@ -269,6 +475,15 @@ Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1allocate(JNIEnv *env,
 #endif
 }
 
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1numa_1node(const JNIEnv *env, const jclass klass, const jlong address) {
+#ifdef __linux__
+	return numa_node((void *) address);
+#else
+	return -1;
+#endif
+}
+
 JNIEXPORT jboolean JNICALL
 Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1free(const JNIEnv *env, const jclass klass, const jlong address, const jlong size, const jboolean huge, const jboolean lock) {
 	// If no huge memory pages should be employed, then use the simple C memory allocation function
@@ -306,10 +521,7 @@ Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1mmap(JNIEnv *env, cons
 		perror("Error memory mapping file");
 		fflush(stderr);
 		printf(" * File descriptor: %d\n", fd);
-		printf(" * Size: %d (mod page = %d; mod huge = %d)\n",
-				size,
-				size % sysconf(_SC_PAGESIZE),
-				size % Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1size(env, klass));
+		printf(" * Size: %" PRId64 " (mod page = %" PRId64 ")\n", (int64_t) size, (int64_t) (size % sysconf(_SC_PAGESIZE)));
 		printf(" * Huge: %s\n", huge ? "true" : "false");
 		printf(" * Lock: %s\n", lock ? "true" : "false");
 		fflush(stdout);
@@ -365,10 +577,16 @@ Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1address_1size(const JNIEnv *en
 }
 
 JNIEXPORT jlong JNICALL
-Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1size(const JNIEnv *env, const jclass klass) {
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1size(JNIEnv *env, const jclass klass, jstring mnt) {
 #ifdef __linux__
 // Phase 1: Find if the hugetlbfs is actually mounted
 {
+	// Copy the mount point and release the string resource
+	char path[PATH_MAX];
+	const char *prefix = (*env)->GetStringUTFChars(env, mnt, NULL);
+	snprintf(path, PATH_MAX, "%s", prefix);
+	(*env)->ReleaseStringUTFChars(env, mnt, prefix);
+
 	FILE *fp = fopen("/etc/mtab", "r");
 	if (fp == NULL) {
 		perror("Error opening /etc/mtab");
@@ -383,7 +601,7 @@ Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1size(const JNIEnv *e
 			fflush(stderr);
 			return -1;
 		}
-		if (strcmp(mnt->mnt_type, "hugetlbfs") == 0 && strcmp(mnt->mnt_fsname, "hugetlbfs") == 0 && strcmp(mnt->mnt_dir, "/mnt/huge") == 0) {
+		if (strcmp(mnt->mnt_type, "hugetlbfs") == 0 && strcmp(mnt->mnt_fsname, "hugetlbfs") == 0 && strcmp(mnt->mnt_dir, path) == 0) {
 			found = 1;
 			break;
 		}
@@ -440,8 +658,29 @@ Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1size(const JNIEnv *e
 #endif
 }
 
+JNIEXPORT jboolean JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1probe(const JNIEnv *env, const jclass klass, const jlong pagesize) {
+#ifdef __linux__
+	return hugepage_probe(pagesize);
+#else
+	return JNI_FALSE;
+#endif
+}
+
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1sizes(JNIEnv *env, const jclass klass, const jlongArray sizes) {
+#ifdef __linux__
+	jlong *dest = (*env)->GetLongArrayElements(env, sizes, NULL);
+	const jint count = hugepage_sizes(dest, (*env)->GetArrayLength(env, sizes));
+	(*env)->ReleaseLongArrayElements(env, sizes, dest, 0);
+	return count;
+#else
+	return 0;
+#endif
+}
+
 JNIEXPORT jlong JNICALL
-Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1allocate(JNIEnv *env, const jclass klass, const jlong size, const jboolean huge, const jboolean lock, jstring mnt) {
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1allocate(JNIEnv *env, const jclass klass, const jlong size, const jboolean huge, const jboolean lock, jstring mnt, const jlong pagesize, const jint node) {
 	// If no huge memory pages should be employed, then use the simple C memory allocation function
 	if (!huge) {
 		void *addr = malloc((size_t) size);
@@ -459,6 +698,9 @@ Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1allocate(JNIEnv *env, const jc
 	}
 
 #ifdef __linux__
+	// Anonymous huge memory pages do not need any file
+	if (pagesize > 0) return hugepage_anonymous(size, lock, pagesize, node);
+
 	// Get the prefix
 	char *prefix = (*env)->GetStringUTFChars(env, mnt, NULL);
 
@@ -487,14 +729,17 @@ Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1allocate(JNIEnv *env, const jc
 
 	// Map the hugepage file to memory
 	int flags = MAP_SHARED;
-	if (lock) flags |= MAP_LOCKED;
-	const void *virt_addr = mmap(NULL, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+	if (lock && node < 0) flags |= MAP_LOCKED;
+	void *virt_addr = mmap(NULL, size, PROT_READ | PROT_WRITE, flags, fd, 0);
 	if (virt_addr == MAP_FAILED) {
 		perror("Error mmap-ing the hugepage file");
 		fflush(stderr);
 		return 0;
 	}
 
+	// Bind the memory to the NUMA node before locking faults the pages in
+	numa_bind(virt_addr, size, node);
+
 	// Prevent the allocated memory to be swapped
 	if (lock && mlock(virt_addr, size) != 0) {
 		perror("Error locking the allocated memory");
@@ -521,6 +766,15 @@ Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1allocate(JNIEnv *env, const jc
 #endif
 }
 
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1numa_1node(const JNIEnv *env, const jclass klass, const jlong address) {
+#ifdef __linux__
+	return numa_node((void *) address);
+#else
+	return -1;
+#endif
+}
+
 JNIEXPORT jboolean JNICALL
 Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1free(const JNIEnv *env, const jclass klass, const jlong address, const jlong size, const jboolean huge, const jboolean lock) {
 	// If no huge memory pages should be employed, then use the simple C memory allocation function
@@ -558,10 +812,7 @@ Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1mmap(JNIEnv *env, const jclass
 		perror("Error memory mapping file");
 		fflush(stderr);
 		printf(" * File descriptor: %d\n", fd);
-		printf(" * Size: %d (mod page = %d; mod huge = %d)\n",
-				size,
-				size % sysconf(_SC_PAGESIZE),
-				size % Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1size(env, klass));
+		printf(" * Size: %" PRId64 " (mod page = %" PRId64 ")\n", (int64_t) size, (int64_t) (size % sysconf(_SC_PAGESIZE)));
 		printf(" * Huge: %s\n", huge ? "true" : "false");
 		printf(" * Lock: %s\n", lock ? "true" : "false");
 		fflush(stdout);
@@ -679,71 +930,858 @@ Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1long_1volatile(const JNIE
 	*((volatile jlong *) address) = value;
 }
 
+JNIEXPORT jbyte JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1byte_1opaque(const JNIEnv *env, const jclass klass, const jlong address) {
+	return __atomic_load_n((jbyte *) address, __ATOMIC_RELAXED);
+}
+
+JNIEXPORT jshort JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1short_1opaque(const JNIEnv *env, const jclass klass, const jlong address) {
+	return __atomic_load_n((jshort *) address, __ATOMIC_RELAXED);
+}
+
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1int_1opaque(const JNIEnv *env, const jclass klass, const jlong address) {
+	return __atomic_load_n((jint *) address, __ATOMIC_RELAXED);
+}
+
+JNIEXPORT jlong JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1long_1opaque(const JNIEnv *env, const jclass klass, const jlong address) {
+	return __atomic_load_n((jlong *) address, __ATOMIC_RELAXED);
+}
+
+JNIEXPORT jbyte JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1byte_1acquire(const JNIEnv *env, const jclass klass, const jlong address) {
+	return __atomic_load_n((jbyte *) address, __ATOMIC_ACQUIRE);
+}
+
+JNIEXPORT jshort JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1short_1acquire(const JNIEnv *env, const jclass klass, const jlong address) {
+	return __atomic_load_n((jshort *) address, __ATOMIC_ACQUIRE);
+}
+
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1int_1acquire(const JNIEnv *env, const jclass klass, const jlong address) {
+	return __atomic_load_n((jint *) address, __ATOMIC_ACQUIRE);
+}
+
+JNIEXPORT jlong JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1long_1acquire(const JNIEnv *env, const jclass klass, const jlong address) {
+	return __atomic_load_n((jlong *) address, __ATOMIC_ACQUIRE);
+}
+
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1byte_1opaque(const JNIEnv *env, const jclass klass, const jlong address, const jbyte value) {
+	__atomic_store_n((jbyte *) address, value, __ATOMIC_RELAXED);
+}
+
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1short_1opaque(const JNIEnv *env, const jclass klass, const jlong address, const jshort value) {
+	__atomic_store_n((jshort *) address, value, __ATOMIC_RELAXED);
+}
+
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1int_1opaque(const JNIEnv *env, const jclass klass, const jlong address, const jint value) {
+	__atomic_store_n((jint *) address, value, __ATOMIC_RELAXED);
+}
+
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1long_1opaque(const JNIEnv *env, const jclass klass, const jlong address, const jlong value) {
+	__atomic_store_n((jlong *) address, value, __ATOMIC_RELAXED);
+}
+
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1byte_1release(const JNIEnv *env, const jclass klass, const jlong address, const jbyte value) {
+	__atomic_store_n((jbyte *) address, value, __ATOMIC_RELEASE);
+}
+
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1short_1release(const JNIEnv *env, const jclass klass, const jlong address, const jshort value) {
+	__atomic_store_n((jshort *) address, value, __ATOMIC_RELEASE);
+}
+
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1int_1release(const JNIEnv *env, const jclass klass, const jlong address, const jint value) {
+	__atomic_store_n((jint *) address, value, __ATOMIC_RELEASE);
+}
+
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1long_1release(const JNIEnv *env, const jclass klass, const jlong address, const jlong value) {
+	__atomic_store_n((jlong *) address, value, __ATOMIC_RELEASE);
+}
+
+// The region functions copy straight between the array and the memory region, while GetByteArrayElements might copy
+// the whole array twice
 JNIEXPORT void JNICALL
 Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get(JNIEnv *env, const jclass klass, const jlong src, const jint size, const jbyteArray dest, const jint offset) {
-	jbyte *destptr = (*env)->GetByteArrayElements(env, dest, NULL);
-	memcpy((void *) (destptr + offset), (void *) src, size);
-	(*env)->ReleaseByteArrayElements(env, dest, destptr, 0);
+	(*env)->SetByteArrayRegion(env, dest, offset, size, (const jbyte *) src);
 }
 
 JNIEXPORT void JNICALL
 Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put(JNIEnv *env, const jclass klass, const jlong dest, const jint size, const jbyteArray src, const jint offset) {
-	jbyte *srcptr = (*env)->GetByteArrayElements(env, src, NULL);
+	(*env)->GetByteArrayRegion(env, src, offset, size, (jbyte *) dest);
+}
+
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1buffer(JNIEnv *env, const jclass klass, const jlong src, const jint size, const jobject dest, const jint offset) {
+	jbyte *destptr = (*env)->GetDirectBufferAddress(env, dest);
+	memcpy((void *) (destptr + offset), (void *) src, size);
+}
+
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1buffer(JNIEnv *env, const jclass klass, const jlong dest, const jint size, const jobject src, const jint offset) {
+	jbyte *srcptr = (*env)->GetDirectBufferAddress(env, src);
 	memcpy((void *) dest, (void *) (srcptr + offset), size);
-	(*env)->ReleaseByteArrayElements(env, src, srcptr, JNI_ABORT);
 }
 
+// Critical natives of the scalar accessors, which HotSpot calls without the JNIEnv and jclass arguments nor the
+// thread state transitions of a regular JNI call when the method is compiled (-XX:+CriticalJNINatives)
+// The bodies are repeated instead of calling the regular natives, which are exported and would go through the PLT
+#define JNI_CRITICAL(ret, name, params) \
+	JNIEXPORT ret JNICALL JavaCritical_de_tum_in_net_ixy_memory_JniMemoryManager_c_1##name params
+#define JNI_CRITICAL_ACCESSORS(type, name) \
+	JNI_CRITICAL(type, get_1##name, (const jlong address)) { \
+		return *((type *) address); \
+	} \
+	JNI_CRITICAL(type, get_1##name##_1volatile, (const jlong address)) { \
+		__asm__ volatile ("" : : : "memory"); \
+		return *((volatile type *) address); \
+	} \
+	JNI_CRITICAL(type, get_1##name##_1opaque, (const jlong address)) { \
+		return __atomic_load_n((type *) address, __ATOMIC_RELAXED); \
+	} \
+	JNI_CRITICAL(type, get_1##name##_1acquire, (const jlong address)) { \
+		return __atomic_load_n((type *) address, __ATOMIC_ACQUIRE); \
+	} \
+	JNI_CRITICAL(void, put_1##name, (const jlong address, const type value)) { \
+		*((type *) address) = value; \
+	} \
+	JNI_CRITICAL(void, put_1##name##_1volatile, (const jlong address, const type value)) { \
+		__asm__ volatile ("" : : : "memory"); \
+		*((volatile type *) address) = value; \
+	} \
+	JNI_CRITICAL(void, put_1##name##_1opaque, (const jlong address, const type value)) { \
+		__atomic_store_n((type *) address, value, __ATOMIC_RELAXED); \
+	} \
+	JNI_CRITICAL(void, put_1##name##_1release, (const jlong address, const type value)) { \
+		__atomic_store_n((type *) address, value, __ATOMIC_RELEASE); \
+	}
+
+JNI_CRITICAL_ACCESSORS(jbyte, byte)
+JNI_CRITICAL_ACCESSORS(jshort, short)
+JNI_CRITICAL_ACCESSORS(jint, int)
+JNI_CRITICAL_ACCESSORS(jlong, long)
+
 
-JNIEXPORT jlong JNICALL
-Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1virt2phys(const JNIEnv *env, const jclass klass, const jlong address) {
 #ifdef __linux__
-	// Open the pagemap file
-	const int fd = open("/proc/self/pagemap", O_RDONLY);
-	if(fd == -1) {
+// Mask of the page frame number of a pagemap entry (bits 0-54)
+#define PAGEMAP_PFN_MASK 0x7fffffffffffffULL
+
+// Cached descriptor of the pagemap file, opened the first time an address is translated
+static int pagemapfd = -1;
+
+// Returns the cached descriptor of the pagemap file, opening it if needed
+static int pagemap(void) {
+	int fd = __atomic_load_n(&pagemapfd, __ATOMIC_ACQUIRE);
+	if (fd != -1) return fd;
+	fd = open("/proc/self/pagemap", O_RDONLY);
+	if (fd == -1) {
 		perror("Could not open /proc/self/pagemap file");
 		fflush(stderr);
+		return -1;
+	}
+
+	// If another thread opened it first, use that descriptor instead
+	int expected = -1;
+	if (!__atomic_compare_exchange_n(&pagemapfd, &expected, fd, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+		close(fd);
+		fd = expected;
+	}
+	return fd;
+}
+
+// Translates a virtual address reading a single pagemap entry
+static uint64_t translate(const int fd, const uint64_t address, const uint64_t pagesize) {
+	uint64_t entry = 0;
+	if (pread(fd, &entry, sizeof(entry), (address / pagesize) * sizeof(entry)) != sizeof(entry)) {
+		perror("Could not read the physical address");
+		fflush(stderr);
 		return 0;
 	}
+	return (entry & PAGEMAP_PFN_MASK) * pagesize + address % pagesize;
+}
+#endif
+
+JNIEXPORT jlong JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1virt2phys(const JNIEnv *env, const jclass klass, const jlong address) {
+#ifdef __linux__
+	const int fd = pagemap();
+	if (fd == -1) return 0;
+	return (jlong) translate(fd, (uint64_t) address, sysconf(_SC_PAGESIZE));
+#else
+	return 0;
+#endif
+}
 
-	// Get the page size to compute the page number and offset
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1virt2phys_1bulk(JNIEnv *env, const jclass klass, const jlong address, const jlong step, const jint count, const jlong hugepagesize, const jlongArray physical) {
+	if (count <= 0) return;
+	jlong *dest = (*env)->GetLongArrayElements(env, physical, NULL);
+	memset(dest, 0, count * sizeof(jlong));
+#ifdef __linux__
+	const int fd = pagemap();
+	if (fd == -1) goto release;
 	const uint64_t pagesize = sysconf(_SC_PAGESIZE);
-	const uint64_t page = (uint64_t) address / pagesize;
 
-	// Move to the correct position
-	if (lseek(fd, page * sizeof(void *), SEEK_SET) == -1) {
-		perror("Could not move the cursor to the correct position");
+	// Huge memory pages are physically contiguous, translate only the first address of each one
+	if (hugepagesize > 0) {
+		const uint64_t huge = (uint64_t) hugepagesize;
+		uint64_t page = UINT64_MAX;
+		uint64_t base = 0;
+		for (jint i = 0; i < count; i++) {
+			const uint64_t virt = (uint64_t) address + (uint64_t) i * step;
+			if (virt / huge != page) {
+				page = virt / huge;
+				const uint64_t phys = translate(fd, virt, pagesize);
+				base = phys == 0 ? 0 : phys - virt % huge;
+			}
+			dest[i] = base == 0 ? 0 : (jlong) (base + virt % huge);
+		}
+		goto release;
+	}
+
+	// Read all the pagemap entries of the memory region at once
+	const uint64_t first = (uint64_t) address / pagesize;
+	const uint64_t last = ((uint64_t) address + (uint64_t) (count - 1) * step) / pagesize;
+	const size_t size = (last - first + 1) * sizeof(uint64_t);
+	uint64_t *entries = malloc(size);
+	if (entries == NULL) goto release;
+	if (pread(fd, entries, size, first * sizeof(uint64_t)) != (ssize_t) size) {
+		perror("Could not read the physical addresses");
 		fflush(stderr);
-		return 0;
+	} else {
+		for (jint i = 0; i < count; i++) {
+			const uint64_t virt = (uint64_t) address + (uint64_t) i * step;
+			dest[i] = (jlong) ((entries[virt / pagesize - first] & PAGEMAP_PFN_MASK) * pagesize + virt % pagesize);
+		}
 	}
+	free(entries);
+release:
+#endif
+	(*env)->ReleaseLongArrayElements(env, physical, dest, 0);
+}
 
-	// Read the physical address
-	uint64_t phy = 0;
-	if (read(fd, &phy, sizeof(void *)) == -1) {
-		perror("Could not read the physical address");
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+JNIEXPORT jlong JNICALL
+Java_de_tum_in_net_ixy_memory_TlbCounter_c_1dtlb_1misses(const JNIEnv *env, const jclass klass, const jlong address, const jlong size, const jlong stride, const jint rounds) {
+#ifdef __linux__
+	// Count the data TLB read misses of this thread in user space
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HW_CACHE;
+	attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	const int fd = (int) syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+	if (fd == -1) {
+		perror("Could not open the data TLB miss counter");
 		fflush(stderr);
-		return 0;
+		return -1;
 	}
 
-	// Close the pagemap file
+	// Walk the memory region
+	const volatile uint8_t *base = (const volatile uint8_t *) address;
+	ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+	ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+	for (jint i = 0; i < rounds; i++) {
+		for (jlong offset = 0; offset < size; offset += stride) base[offset];
+	}
+	ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+
+	// Read the counter
+	uint64_t misses = 0;
+	const ssize_t bytes = read(fd, &misses, sizeof(misses));
 	if (close(fd) != 0) {
-		perror("Error closing the /proc/self/pagemap file");
+		perror("Error closing the data TLB miss counter");
 		fflush(stderr);
 	}
+	return bytes == sizeof(misses) ? (jlong) misses : -1;
+#else
+	return -1;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+JNIEXPORT jboolean JNICALL
+Java_de_tum_in_net_ixy_memory_VarHandleMemoryManager_c_1is_1valid(const JNIEnv *env, const jclass klass) {
+#ifdef __linux__
+	return JNI_TRUE;
+#else
+	return JNI_FALSE;
+#endif
+}
+
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_VarHandleMemoryManager_c_1address_1size(const JNIEnv *env, const jclass klass) {
+	return sizeof(void *);
+}
 
-	// Return the physical address with the fixed offset
-	const uint64_t offset = address % pagesize;
-//	printf("Computing translation: %p\n", (void *) address);
-//	printf(" * Offset = %x\n", (unsigned long long) offset);
-//	printf(" * Page = %x\n", (unsigned long long) page);
-//	printf(" * Physical = %d\n", (unsigned long long) phy);
-//	printf(" * Phys. addr. = %p\n", (void *) (phy & 0x7fffffffffffff));
-//	fflush(stdout);
-	return (jlong) ((phy & 0x7fffffffffffffULL)*pagesize + offset);
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_VarHandleMemoryManager_c_1page_1size(const JNIEnv *env, const jclass klass) {
+#ifdef __linux__
+	return sysconf(_SC_PAGESIZE);
 #else
 	return 0;
 #endif
 }
 
+JNIEXPORT jlong JNICALL
+Java_de_tum_in_net_ixy_memory_VarHandleMemoryManager_c_1address(JNIEnv *env, const jclass klass, const jobject buffer) {
+	void *address = (*env)->GetDirectBufferAddress(env, buffer);
+	return (address == NULL) ? 0 : (jlong) address;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Translates the writeback of a descriptor into the RX flags of its packet buffer
+static inline uint32_t rx_flags(const uint32_t info, const uint32_t status) {
+	uint32_t flags = 0;
+	if ((info & IXGBE_RXDADV_PKTTYPE_ETQF) == 0) {
+		if (info & (IXGBE_RXDADV_PKTTYPE_IPV4 | IXGBE_RXDADV_PKTTYPE_IPV4_EX)) flags |= RXF_IPV4;
+		if (info & (IXGBE_RXDADV_PKTTYPE_IPV6 | IXGBE_RXDADV_PKTTYPE_IPV6_EX)) flags |= RXF_IPV6;
+		if (info & IXGBE_RXDADV_PKTTYPE_TCP) flags |= RXF_TCP;
+		if (info & IXGBE_RXDADV_PKTTYPE_UDP) flags |= RXF_UDP;
+		if (info & IXGBE_RXDADV_PKTTYPE_SCTP) flags |= RXF_SCTP;
+	}
+	if (status & IXGBE_RXDADV_STAT_IPCS) flags |= (status & IXGBE_RXDADV_ERR_IPE) ? RXF_IP_CHECKSUM_BAD : RXF_IP_CHECKSUM_GOOD;
+	if (status & IXGBE_RXDADV_STAT_L4CS) flags |= (status & IXGBE_RXDADV_ERR_TCPE) ? RXF_L4_CHECKSUM_BAD : RXF_L4_CHECKSUM_GOOD;
+	if (info & IXGBE_RXDADV_RSSTYPE_MASK) flags |= RXF_RSS_HASH;
+	if (status & IXGBE_RXDADV_STAT_VP) flags |= RXF_VLAN;
+	return flags;
+}
+
+// Flag of the virtual addresses of a TX descriptor ring whose packet buffer is not the last segment of its packet
+#define TX_MORE_SEGMENTS 1
+
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_ixgbe_IxgbeDevice_c_1rx_1batch(JNIEnv *env, const jclass klass, const jlong ring, const jint index, const jint capacity, const jlongArray buffers, const jlongArray received, const jint budget, const jint length) {
+	jlong *bufptr = (*env)->GetPrimitiveArrayCritical(env, buffers, NULL);
+	jlong *rcvptr = (*env)->GetPrimitiveArrayCritical(env, received, NULL);
+	const jint mask = capacity - 1;
+	jint count = 0;
+	jint packets = 0;
+	jint i = index;
+	while (packets < length && count < budget) {
+		// Stop as soon as the hardware has not finished with the first descriptor of a packet
+		const uintptr_t desc = (uintptr_t) ring + (uintptr_t) i * IXGBE_DESCRIPTOR_SIZE;
+		uint32_t status = *((volatile uint32_t *) (desc + 8));
+		if ((status & IXGBE_RXDADV_STAT_DD) == 0) break;
+
+		// A packet that spans several descriptors can only be collected when the hardware has finished with all of them
+		jint segments = 1;
+		uintptr_t last = desc;
+		while ((status & IXGBE_RXDADV_STAT_EOP) == 0 && count + segments < budget) {
+			last = (uintptr_t) ring + (uintptr_t) ((i + segments) & mask) * IXGBE_DESCRIPTOR_SIZE;
+			status = *((volatile uint32_t *) (last + 8));
+			if ((status & IXGBE_RXDADV_STAT_DD) == 0) break;
+			segments++;
+		}
+		if ((status & IXGBE_RXDADV_STAT_DD) == 0 || (status & IXGBE_RXDADV_STAT_EOP) == 0) break;
+
+		// Copy the translated writeback of the last descriptor to the first packet buffer
+		const jlong head = bufptr[i];
+		const uint32_t info = *((volatile uint32_t *) last);
+		*((volatile jint *) (head + OFL_OFFSET)) = 0;
+		*((volatile jint *) (head + RSS_OFFSET)) = *((volatile jint *) (last + 4));
+		*((volatile jint *) (head + RXF_OFFSET)) = rx_flags(info, status);
+		*((volatile jshort *) (head + VLN_OFFSET)) = *((volatile jshort *) (last + 14));
+		*((volatile jshort *) (head + SEG_OFFSET)) = (jshort) segments;
+
+		// Copy the length of every segment, link them and hand them to the caller
+		for (jint s = 1; s <= segments; s++) {
+			const uintptr_t seg = (uintptr_t) ring + (uintptr_t) i * IXGBE_DESCRIPTOR_SIZE;
+			const jlong virt = bufptr[i];
+			i = (i + 1) & mask;
+			*((volatile jint *) (virt + PKT_OFFSET)) = *((volatile uint16_t *) (seg + 12));
+			*((volatile jlong *) (virt + NXT_OFFSET)) = (s == segments) ? 0 : bufptr[i];
+			rcvptr[count++] = virt;
+		}
+		packets++;
+	}
+	(*env)->ReleasePrimitiveArrayCritical(env, received, rcvptr, 0);
+	(*env)->ReleasePrimitiveArrayCritical(env, buffers, bufptr, JNI_ABORT);
+	return count;
+}
+
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_ixgbe_IxgbeDevice_c_1rx_1refill(JNIEnv *env, const jclass klass, const jlong ring, jint index, const jint capacity, const jlongArray buffers, const jlongArray fresh, const jint length) {
+	jlong *bufptr = (*env)->GetPrimitiveArrayCritical(env, buffers, NULL);
+	jlong *frsptr = (*env)->GetPrimitiveArrayCritical(env, fresh, NULL);
+	const jint mask = capacity - 1;
+	for (jint i = 0; i < length; i++) {
+		// Register the new packet buffer in the descriptor and remember its virtual address
+		const uintptr_t desc = (uintptr_t) ring + (uintptr_t) index * IXGBE_DESCRIPTOR_SIZE;
+		const jlong virt = frsptr[i];
+		const jlong phys = *((volatile jlong *) (virt + PAP_OFFSET));
+		*((volatile jlong *) desc) = phys + PAYLOAD_OFFSET;
+		*((volatile jlong *) (desc + 8)) = 0;
+		bufptr[index] = virt;
+		index = (index + 1) & mask;
+	}
+	(*env)->ReleasePrimitiveArrayCritical(env, fresh, frsptr, JNI_ABORT);
+	(*env)->ReleasePrimitiveArrayCritical(env, buffers, bufptr, 0);
+	return index;
+}
+
+// Writes a context descriptor that programs the offload flags and the maximum segment size of a packet buffer
+static inline void tx_context(const uintptr_t desc, const uint32_t offload, const uint32_t mss) {
+	uint32_t tucmd = IXGBE_ADVTXD_DTYP_CTXT | IXGBE_ADVTXD_DCMD_DEXT;
+	if ((offload & OFL_IPV6) == 0) tucmd |= IXGBE_ADVTXD_TUCMD_IPV4;
+	if (offload & OFL_TCP_CHECKSUM) tucmd |= IXGBE_ADVTXD_TUCMD_L4T_TCP;
+	uint32_t mss_l4len = ((offload >> OFL_L4_LENGTH_SHIFT) & OFL_L4_LENGTH_MASK) << IXGBE_ADVTXD_L4LEN_SHIFT;
+	if (offload & OFL_TSO) mss_l4len |= mss << IXGBE_ADVTXD_MSS_SHIFT;
+	*((volatile uint32_t *) desc) = offload & OFL_LENS_MASK;
+	*((volatile uint32_t *) (desc + 4)) = 0;
+	*((volatile uint32_t *) (desc + 8)) = tucmd;
+	*((volatile uint32_t *) (desc + 12)) = mss_l4len;
+}
+
+// Computes the payload length of the first data descriptor, which excludes the replicated headers when segmenting
+static inline uint32_t tx_payload(const uint32_t offload, const uint32_t length) {
+	if ((offload & OFL_TSO) == 0) return length;
+	const uint32_t l2 = (offload >> OFL_L2_LENGTH_SHIFT) & OFL_L2_LENGTH_MASK;
+	const uint32_t l3 = offload & OFL_L3_LENGTH_MASK;
+	const uint32_t l4 = (offload >> OFL_L4_LENGTH_SHIFT) & OFL_L4_LENGTH_MASK;
+	return length - l2 - l3 - l4;
+}
+
+// Translates the offload flags of a packet buffer into the options of its data descriptor
+static inline uint32_t tx_options(const uint32_t offload) {
+	if (offload == 0) return 0;
+	uint32_t options = IXGBE_ADVTXD_CC;
+	if (offload & OFL_IP_CHECKSUM) options |= IXGBE_ADVTXD_POPTS_IXSM;
+	if (offload & (OFL_UDP_CHECKSUM | OFL_TCP_CHECKSUM)) options |= IXGBE_ADVTXD_POPTS_TXSM;
+	return options;
+}
+
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_ixgbe_IxgbeDevice_c_1tx_1batch(JNIEnv *env, const jclass klass, const jlong ring, jint index, const jint capacity, jint free, const jlongArray buffers, const jlongArray packets, const jint length, const jint flags, const jint context, const jint mss) {
+	jlong *bufptr = (*env)->GetPrimitiveArrayCritical(env, buffers, NULL);
+	jlong *pktptr = (*env)->GetPrimitiveArrayCritical(env, packets, NULL);
+	const jint mask = capacity - 1;
+	uint32_t programmed = (uint32_t) context;
+	uint32_t programmed_mss = (uint32_t) mss;
+	for (jint i = 0; i < length; i++) {
+		const jlong virt = pktptr[i];
+		const uint32_t offload = *((volatile uint32_t *) (virt + OFL_OFFSET));
+		const uint32_t packet_mss = *((volatile uint16_t *) (virt + MSS_OFFSET));
+		const jint segments = *((volatile uint16_t *) (virt + SEG_OFFSET));
+
+		// Program the offloads in a context descriptor only when they differ from the ones of the last packet, and
+		// write the packet only if all its descriptors fit because the NIC does not send incomplete packets
+		const int tso = (offload & OFL_TSO) != 0;
+		const jint contexts = (offload != 0 && (offload != programmed || (tso && packet_mss != programmed_mss))) ? 1 : 0;
+		const jint needed = contexts + (segments > 1 ? segments : 1);
+		if (needed > free) break;
+		free -= needed;
+		if (contexts) {
+			tx_context((uintptr_t) ring + (uintptr_t) index * IXGBE_DESCRIPTOR_SIZE, offload, packet_mss);
+			bufptr[index] = 0;
+			index = (index + 1) & mask;
+			programmed = offload;
+			programmed_mss = packet_mss;
+		}
+		const jint packet_flags = tso ? (jint) ((uint32_t) flags | IXGBE_ADVTXD_DCMD_TSE) : flags;
+		const jint segment_flags = packet_flags & ~(IXGBE_ADVTXD_DCMD_EOP | IXGBE_ADVTXD_DCMD_RS);
+
+		// Write the physical address and the flags with the size of every segment, remembering their virtual addresses
+		// to clean them up later; only the last descriptor ends the packet and reports its status
+		const uintptr_t first = (uintptr_t) ring + (uintptr_t) index * IXGBE_DESCRIPTOR_SIZE;
+		uint32_t total = 0;
+		jlong seg = virt;
+		for (jint s = 1; ; s++) {
+			const uintptr_t desc = (uintptr_t) ring + (uintptr_t) index * IXGBE_DESCRIPTOR_SIZE;
+			const jlong phys = *((volatile jlong *) (seg + PAP_OFFSET));
+			const jint size = *((volatile jint *) (seg + PKT_OFFSET));
+			total += (uint32_t) size;
+			*((volatile jlong *) desc) = phys + PAYLOAD_OFFSET;
+			const int last = s >= segments;
+			*((volatile jint *) (desc + 8)) = (last ? packet_flags : segment_flags) | size;
+			*((volatile jint *) (desc + 12)) = 0;
+			bufptr[index] = last ? seg : (seg | TX_MORE_SEGMENTS);
+			index = (index + 1) & mask;
+			if (last) break;
+
+			// Unlink the segment so that it can be reused as a single segment packet
+			const jlong next = *((volatile jlong *) (seg + NXT_OFFSET));
+			*((volatile jlong *) (seg + NXT_OFFSET)) = 0;
+			seg = next;
+		}
+		if (segments > 1) *((volatile jshort *) (virt + SEG_OFFSET)) = 1;
+
+		// The first descriptor has the payload length of the whole packet and the offload options
+		const uint32_t payload = tx_payload(offload, total);
+		*((volatile jint *) (first + 12)) = (jint) ((payload << IXGBE_ADVTXD_PAYLEN_SHIFT) | tx_options(offload));
+	}
+	(*env)->ReleasePrimitiveArrayCritical(env, packets, pktptr, JNI_ABORT);
+	(*env)->ReleasePrimitiveArrayCritical(env, buffers, bufptr, 0);
+	return index;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Kernels that copy or fill the memory of a single packet, selected once depending on the instruction sets of the CPU
+typedef void (*copy_kernel)(uint8_t *dest, const uint8_t *src, size_t bytes);
+typedef void (*fill_kernel)(uint8_t *dest, uint8_t value, size_t bytes);
+typedef uint64_t (*sum_kernel)(const uint8_t *data, size_t bytes);
+
+// Kernel level, name and implementations selected by "kernels_init" (0 = scalar, 1 = SSE2, 2 = AVX2)
+static jint kernel_level = 0;
+static copy_kernel kernel_copy;
+static fill_kernel kernel_fill;
+static sum_kernel kernel_sum;
+
+static void copy_scalar(uint8_t *dest, const uint8_t *src, const size_t bytes) {
+	memcpy(dest, src, bytes);
+}
+
+static void fill_scalar(uint8_t *dest, const uint8_t value, const size_t bytes) {
+	memset(dest, value, bytes);
+}
+
+// Adds up the 32-bit words of a memory region, which folded gives the same one's complement sum as the 16-bit words
+static uint64_t sum_scalar(const uint8_t *data, const size_t bytes) {
+	uint64_t sum = 0;
+	size_t i = 0;
+	for (; i + sizeof(uint32_t) <= bytes; i += sizeof(uint32_t)) {
+		uint32_t word;
+		memcpy(&word, data + i, sizeof(word));
+		sum += word;
+	}
+	if (i + sizeof(uint16_t) <= bytes) {
+		uint16_t half;
+		memcpy(&half, data + i, sizeof(half));
+		sum += half;
+		i += sizeof(uint16_t);
+	}
+	if (i < bytes) {
+		// The odd byte is padded with a zero byte after it
+		uint16_t last = 0;
+		memcpy(&last, data + i, 1);
+		sum += last;
+	}
+	return sum;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// The vectorized kernels store the last vector overlapping the previous one instead of copying the tail byte by byte
+__attribute__((target("sse2")))
+static void copy_sse2(uint8_t *dest, const uint8_t *src, const size_t bytes) {
+	if (bytes < sizeof(__m128i)) {
+		memcpy(dest, src, bytes);
+		return;
+	}
+	const size_t last = bytes - sizeof(__m128i);
+	for (size_t i = 0; i < last; i += sizeof(__m128i)) {
+		_mm_storeu_si128((__m128i *) (dest + i), _mm_loadu_si128((const __m128i *) (src + i)));
+	}
+	_mm_storeu_si128((__m128i *) (dest + last), _mm_loadu_si128((const __m128i *) (src + last)));
+}
+
+__attribute__((target("sse2")))
+static void fill_sse2(uint8_t *dest, const uint8_t value, const size_t bytes) {
+	if (bytes < sizeof(__m128i)) {
+		memset(dest, value, bytes);
+		return;
+	}
+	const __m128i vector = _mm_set1_epi8((char) value);
+	const size_t last = bytes - sizeof(__m128i);
+	for (size_t i = 0; i < last; i += sizeof(__m128i)) _mm_storeu_si128((__m128i *) (dest + i), vector);
+	_mm_storeu_si128((__m128i *) (dest + last), vector);
+}
+
+// The vectorized sums zero-extend the 32-bit words to 64-bit lanes, so the carries are never lost
+__attribute__((target("sse2")))
+static uint64_t sum_sse2(const uint8_t *data, const size_t bytes) {
+	const __m128i zero = _mm_setzero_si128();
+	__m128i acc = zero;
+	size_t i = 0;
+	for (; i + sizeof(__m128i) <= bytes; i += sizeof(__m128i)) {
+		const __m128i vector = _mm_loadu_si128((const __m128i *) (data + i));
+		acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(vector, zero));
+		acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(vector, zero));
+	}
+	uint64_t lanes[2];
+	_mm_storeu_si128((__m128i *) lanes, acc);
+	return lanes[0] + lanes[1] + sum_scalar(data + i, bytes - i);
+}
+
+__attribute__((target("avx2")))
+static void copy_avx2(uint8_t *dest, const uint8_t *src, const size_t bytes) {
+	if (bytes < sizeof(__m256i)) {
+		copy_sse2(dest, src, bytes);
+		return;
+	}
+	const size_t last = bytes - sizeof(__m256i);
+	for (size_t i = 0; i < last; i += sizeof(__m256i)) {
+		_mm256_storeu_si256((__m256i *) (dest + i), _mm256_loadu_si256((const __m256i *) (src + i)));
+	}
+	_mm256_storeu_si256((__m256i *) (dest + last), _mm256_loadu_si256((const __m256i *) (src + last)));
+}
+
+__attribute__((target("avx2")))
+static void fill_avx2(uint8_t *dest, const uint8_t value, const size_t bytes) {
+	if (bytes < sizeof(__m256i)) {
+		fill_sse2(dest, value, bytes);
+		return;
+	}
+	const __m256i vector = _mm256_set1_epi8((char) value);
+	const size_t last = bytes - sizeof(__m256i);
+	for (size_t i = 0; i < last; i += sizeof(__m256i)) _mm256_storeu_si256((__m256i *) (dest + i), vector);
+	_mm256_storeu_si256((__m256i *) (dest + last), vector);
+}
+
+__attribute__((target("avx2")))
+static uint64_t sum_avx2(const uint8_t *data, const size_t bytes) {
+	const __m256i zero = _mm256_setzero_si256();
+	__m256i acc = zero;
+	size_t i = 0;
+	for (; i + sizeof(__m256i) <= bytes; i += sizeof(__m256i)) {
+		const __m256i vector = _mm256_loadu_si256((const __m256i *) (data + i));
+		acc = _mm256_add_epi64(acc, _mm256_unpacklo_epi32(vector, zero));
+		acc = _mm256_add_epi64(acc, _mm256_unpackhi_epi32(vector, zero));
+	}
+	uint64_t lanes[4];
+	_mm256_storeu_si256((__m256i *) lanes, acc);
+	return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_scalar(data + i, bytes - i);
+}
+#endif
+
+// Selects the fastest kernels the CPU supports
+static void kernels_init(void) {
+	kernel_level = 0;
+	kernel_copy  = copy_scalar;
+	kernel_fill  = fill_scalar;
+	kernel_sum   = sum_scalar;
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) {
+		kernel_level = 2;
+		kernel_copy  = copy_avx2;
+		kernel_fill  = fill_avx2;
+		kernel_sum   = sum_avx2;
+	} else if (__builtin_cpu_supports("sse2")) {
+		kernel_level = 1;
+		kernel_copy  = copy_sse2;
+		kernel_fill  = fill_sse2;
+		kernel_sum   = sum_sse2;
+	}
+#endif
+}
+
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_PacketKernels_c_1kernel(const JNIEnv *env, const jclass klass) {
+	return kernel_level;
+}
+
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_PacketKernels_c_1fill(JNIEnv *env, const jclass klass, const jlongArray addresses, const jint count, const jint offset, const jint bytes, const jbyte value) {
+	jlong *addrptr = (*env)->GetPrimitiveArrayCritical(env, addresses, NULL);
+	for (jint i = 0; i < count; i++) {
+		kernel_fill((uint8_t *) (uintptr_t) addrptr[i] + PAYLOAD_OFFSET + offset, (uint8_t) value, (size_t) bytes);
+	}
+	(*env)->ReleasePrimitiveArrayCritical(env, addresses, addrptr, JNI_ABORT);
+}
+
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_PacketKernels_c_1copy(JNIEnv *env, const jclass klass, const jlongArray addresses, const jint count, const jint offset, const jbyteArray src, const jint bytes) {
+	jlong *addrptr = (*env)->GetPrimitiveArrayCritical(env, addresses, NULL);
+	jbyte *srcptr  = (*env)->GetPrimitiveArrayCritical(env, src, NULL);
+	for (jint i = 0; i < count; i++) {
+		kernel_copy((uint8_t *) (uintptr_t) addrptr[i] + PAYLOAD_OFFSET + offset, (const uint8_t *) srcptr, (size_t) bytes);
+	}
+	(*env)->ReleasePrimitiveArrayCritical(env, src, srcptr, JNI_ABORT);
+	(*env)->ReleasePrimitiveArrayCritical(env, addresses, addrptr, JNI_ABORT);
+}
+
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_PacketKernels_c_1patch(JNIEnv *env, const jclass klass, const jlongArray addresses, const jint count, const jbyteArray template, const jint bytes, const jint field, jint value) {
+	jlong *addrptr = (*env)->GetPrimitiveArrayCritical(env, addresses, NULL);
+	jbyte *tmplptr = (*env)->GetPrimitiveArrayCritical(env, template, NULL);
+	for (jint i = 0; i < count; i++) {
+		// Write the template, the packet size and the sequence number in a single pass over the packet
+		const uintptr_t virt = (uintptr_t) addrptr[i];
+		kernel_copy((uint8_t *) virt + PAYLOAD_OFFSET, (const uint8_t *) tmplptr, (size_t) bytes);
+		*((jint *) (virt + PKT_OFFSET)) = bytes;
+		memcpy((void *) (virt + PAYLOAD_OFFSET + field), &value, sizeof(value));
+		value = (jint) ((uint32_t) value + 1);
+	}
+	(*env)->ReleasePrimitiveArrayCritical(env, template, tmplptr, JNI_ABORT);
+	(*env)->ReleasePrimitiveArrayCritical(env, addresses, addrptr, JNI_ABORT);
+	return value;
+}
+
+// Folds a sum of words to a 16-bit one's complement sum
+static jint checksum_fold(uint64_t sum) {
+	while (sum >> 16) sum = (sum & 0xffff) + (sum >> 16);
+	return (jint) sum;
+}
+
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_Checksums_c_1sum(const JNIEnv *env, const jclass klass, const jlong address, const jint bytes) {
+	return checksum_fold(kernel_sum((const uint8_t *) (uintptr_t) address, (size_t) bytes));
+}
+
+// Critical native of the sum, because most of the checksummed regions are headers of a few bytes
+JNIEXPORT jint JNICALL
+JavaCritical_de_tum_in_net_ixy_memory_Checksums_c_1sum(const jlong address, const jint bytes) {
+	return checksum_fold(kernel_sum((const uint8_t *) (uintptr_t) address, (size_t) bytes));
+}
+
+// Native methods of the class JniMemoryManager; every table is registered when the library is loaded to skip the
+// symbol lookup
+static const JNINativeMethod gJniMemoryManagerMethods[] = {
+	{"c_is_valid", "()Z", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1is_1valid},
+	{"c_address_size", "()I", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1address_1size},
+	{"c_page_size", "()I", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1page_1size},
+	{"c_hugepage_size", "(Ljava/lang/String;)J", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1size},
+	{"c_hugepage_probe", "(J)Z", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1probe},
+	{"c_hugepage_sizes", "([J)I", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1sizes},
+	{"c_allocate", "(JZZLjava/lang/String;JI)J", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1allocate},
+	{"c_numa_node", "(J)I", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1numa_1node},
+	{"c_free", "(JJZZ)Z", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1free},
+	{"c_mmap", "(Ljava/io/FileDescriptor;JZZ)J", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1mmap},
+	{"c_munmap", "(JJZZ)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1munmap},
+	{"c_get_byte", "(J)B", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1byte},
+	{"c_get_byte_volatile", "(J)B", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1byte_1volatile},
+	{"c_get_byte_opaque", "(J)B", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1byte_1opaque},
+	{"c_get_byte_acquire", "(J)B", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1byte_1acquire},
+	{"c_put_byte", "(JB)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1byte},
+	{"c_put_byte_volatile", "(JB)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1byte_1volatile},
+	{"c_put_byte_opaque", "(JB)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1byte_1opaque},
+	{"c_put_byte_release", "(JB)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1byte_1release},
+	{"c_get_short", "(J)S", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1short},
+	{"c_get_short_volatile", "(J)S", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1short_1volatile},
+	{"c_get_short_opaque", "(J)S", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1short_1opaque},
+	{"c_get_short_acquire", "(J)S", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1short_1acquire},
+	{"c_put_short", "(JS)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1short},
+	{"c_put_short_volatile", "(JS)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1short_1volatile},
+	{"c_put_short_opaque", "(JS)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1short_1opaque},
+	{"c_put_short_release", "(JS)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1short_1release},
+	{"c_get_int", "(J)I", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1int},
+	{"c_get_int_volatile", "(J)I", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1int_1volatile},
+	{"c_get_int_opaque", "(J)I", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1int_1opaque},
+	{"c_get_int_acquire", "(J)I", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1int_1acquire},
+	{"c_put_int", "(JI)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1int},
+	{"c_put_int_volatile", "(JI)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1int_1volatile},
+	{"c_put_int_opaque", "(JI)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1int_1opaque},
+	{"c_put_int_release", "(JI)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1int_1release},
+	{"c_get_long", "(J)J", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1long},
+	{"c_get_long_volatile", "(J)J", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1long_1volatile},
+	{"c_get_long_opaque", "(J)J", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1long_1opaque},
+	{"c_get_long_acquire", "(J)J", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1long_1acquire},
+	{"c_put_long", "(JJ)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1long},
+	{"c_put_long_volatile", "(JJ)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1long_1volatile},
+	{"c_put_long_opaque", "(JJ)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1long_1opaque},
+	{"c_put_long_release", "(JJ)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1long_1release},
+	{"c_get", "(JI[BI)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get},
+	{"c_put", "(JI[BI)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put},
+	{"c_get_buffer", "(JILjava/nio/ByteBuffer;I)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1buffer},
+	{"c_put_buffer", "(JILjava/nio/ByteBuffer;I)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1buffer},
+	{"c_virt2phys", "(J)J", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1virt2phys},
+	{"c_virt2phys_bulk", "(JJIJ[J)V", (void *) Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1virt2phys_1bulk},
+};
+
+// Native methods of the class SmartUnsafeMemoryManager
+static const JNINativeMethod gSmartUnsafeMemoryManagerMethods[] = {
+	{"c_is_valid", "()Z", (void *) Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1is_1valid},
+	{"c_hugepage_probe", "(J)Z", (void *) Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1hugepage_1probe},
+	{"c_allocate", "(JZZLjava/lang/String;JI)J", (void *) Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1allocate},
+	{"c_numa_node", "(J)I", (void *) Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1numa_1node},
+	{"c_free", "(JJZZ)Z", (void *) Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1free},
+	{"c_mmap", "(Ljava/io/FileDescriptor;JZZ)J", (void *) Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1mmap},
+	{"c_munmap", "(JJZZ)V", (void *) Java_de_tum_in_net_ixy_memory_SmartUnsafeMemoryManager_c_1munmap},
+};
+
+// Native methods of the class VarHandleMemoryManager
+static const JNINativeMethod gVarHandleMemoryManagerMethods[] = {
+	{"c_is_valid", "()Z", (void *) Java_de_tum_in_net_ixy_memory_VarHandleMemoryManager_c_1is_1valid},
+	{"c_address_size", "()I", (void *) Java_de_tum_in_net_ixy_memory_VarHandleMemoryManager_c_1address_1size},
+	{"c_page_size", "()I", (void *) Java_de_tum_in_net_ixy_memory_VarHandleMemoryManager_c_1page_1size},
+	{"c_address", "(Ljava/nio/ByteBuffer;)J", (void *) Java_de_tum_in_net_ixy_memory_VarHandleMemoryManager_c_1address},
+};
+
+// Native methods of the class TlbCounter
+static const JNINativeMethod gTlbCounterMethods[] = {
+	{"c_dtlb_misses", "(JJJI)J", (void *) Java_de_tum_in_net_ixy_memory_TlbCounter_c_1dtlb_1misses},
+};
+
+// Native methods of the class PacketKernels
+static const JNINativeMethod gPacketKernelsMethods[] = {
+	{"c_kernel", "()I", (void *) Java_de_tum_in_net_ixy_memory_PacketKernels_c_1kernel},
+	{"c_fill", "([JIIIB)V", (void *) Java_de_tum_in_net_ixy_memory_PacketKernels_c_1fill},
+	{"c_copy", "([JII[BI)V", (void *) Java_de_tum_in_net_ixy_memory_PacketKernels_c_1copy},
+	{"c_patch", "([JI[BIII)I", (void *) Java_de_tum_in_net_ixy_memory_PacketKernels_c_1patch},
+};
+
+// Native methods of the class Checksums
+static const JNINativeMethod gChecksumsMethods[] = {
+	{"c_sum", "(JI)I", (void *) Java_de_tum_in_net_ixy_memory_Checksums_c_1sum},
+};
+
+// Native methods of the class IxgbeDevice, which are the batches of the hot path
+static const JNINativeMethod gIxgbeDeviceMethods[] = {
+	{"c_rx_batch", "(JII[J[JII)I", (void *) Java_de_tum_in_net_ixy_ixgbe_IxgbeDevice_c_1rx_1batch},
+	{"c_rx_refill", "(JII[J[JI)I", (void *) Java_de_tum_in_net_ixy_ixgbe_IxgbeDevice_c_1rx_1refill},
+	{"c_tx_batch", "(JIII[J[JIIII)I", (void *) Java_de_tum_in_net_ixy_ixgbe_IxgbeDevice_c_1tx_1batch},
+};
+
+// Finds a class without initializing it, because its static initializer might load this library again
+static jclass find_class(JNIEnv *env, const char *name) {
+	const jclass loaderclass = (*env)->FindClass(env, "java/lang/ClassLoader");
+	const jclass classclass  = (*env)->FindClass(env, "java/lang/Class");
+	if (loaderclass == NULL || classclass == NULL) return NULL;
+	const jmethodID getloader = (*env)->GetStaticMethodID(env, loaderclass, "getSystemClassLoader", "()Ljava/lang/ClassLoader;");
+	const jmethodID forname   = (*env)->GetStaticMethodID(env, classclass, "forName", "(Ljava/lang/String;ZLjava/lang/ClassLoader;)Ljava/lang/Class;");
+	if (getloader == NULL || forname == NULL) return NULL;
+	const jobject loader = (*env)->CallStaticObjectMethod(env, loaderclass, getloader);
+	const jstring jname  = (*env)->NewStringUTF(env, name);
+	if (jname == NULL) return NULL;
+	return (jclass) (*env)->CallStaticObjectMethod(env, classclass, forname, jname, JNI_FALSE, loader);
+}
+
+// Registers the native methods of a class, whose exported symbols are still resolved lazily if the registration fails
+static void register_natives(JNIEnv *env, const char *name, const JNINativeMethod *methods, const jint count) {
+	const jclass klass = find_class(env, name);
+	if (klass == NULL || (*env)->ExceptionCheck(env)) {
+		(*env)->ExceptionClear(env);
+		return;
+	}
+	if ((*env)->RegisterNatives(env, klass, methods, count) != JNI_OK) (*env)->ExceptionClear(env);
+	(*env)->DeleteLocalRef(env, klass);
+}
+
+#define REGISTER_NATIVES(env, name, methods) register_natives(env, name, methods, sizeof(methods) / sizeof(methods[0]))
+
+JNIEXPORT jint JNICALL
+JNI_OnLoad(JavaVM *vm, void *reserved) {
+	JNIEnv *env;
+	if ((*vm)->GetEnv(vm, (void **) &env, JNI_VERSION_1_8) != JNI_OK) return JNI_ERR;
+	kernels_init();
+	REGISTER_NATIVES(env, "de.tum.in.net.ixy.memory.JniMemoryManager", gJniMemoryManagerMethods);
+	REGISTER_NATIVES(env, "de.tum.in.net.ixy.memory.SmartUnsafeMemoryManager", gSmartUnsafeMemoryManagerMethods);
+	REGISTER_NATIVES(env, "de.tum.in.net.ixy.memory.VarHandleMemoryManager", gVarHandleMemoryManagerMethods);
+	REGISTER_NATIVES(env, "de.tum.in.net.ixy.memory.TlbCounter", gTlbCounterMethods);
+	REGISTER_NATIVES(env, "de.tum.in.net.ixy.memory.PacketKernels", gPacketKernelsMethods);
+	REGISTER_NATIVES(env, "de.tum.in.net.ixy.memory.Checksums", gChecksumsMethods);
+	REGISTER_NATIVES(env, "de.tum.in.net.ixy.ixgbe.IxgbeDevice", gIxgbeDeviceMethods);
+	return JNI_VERSION_1_8;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <jni.h> // JNIEXPORT, JNICALL, jint, JNIEnv, jclass, jlong, jboolean, jbyte, jshort, jint, jstring
+#include <jni.h> // JNIEXPORT, JNICALL, jint, JNIEnv, jclass, jlong, jboolean, jbyte, jshort, jint, jstring, jobject, jlongArray
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,18 +33,42 @@ Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1page_1size(const JNIEnv *, con
 /*
  * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
  * Method:    c_hugepage_size
- * Signature: ()J
+ * Signature: (Ljava/lang/String;)J
  */
 JNIEXPORT jlong JNICALL
-Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1size(const JNIEnv *, const jclass);
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1size(JNIEnv *, const jclass, jstring);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_hugepage_probe
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1probe(const JNIEnv *, const jclass, const jlong);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_hugepage_sizes
+ * Signature: ([J)I
+ */
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1hugepage_1sizes(JNIEnv *, const jclass, const jlongArray);
 
 /*
  * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
  * Method:    c_allocate
- * Signature: (JZZLjava/lang/String;)J
+ * Signature: (JZZLjava/lang/String;JI)J
  */
 JNIEXPORT jlong JNICALL
-Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1allocate(JNIEnv *, const jclass, const jlong, const jboolean, const jboolean, jstring);
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1allocate(JNIEnv *, const jclass, const jlong, const jboolean, const jboolean, jstring, const jlong, const jint);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_numa_node
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1numa_1node(const JNIEnv *, const jclass, const jlong);
 
 /*
  * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
@@ -172,7 +196,7 @@ Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1int(const JNIEnv *, const
  * Signature: (JB)V
  */
 JNIEXPORT void JNICALL
-Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1byte_volatile(const JNIEnv *, const jclass, const jlong, const jbyte);
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1byte_1volatile(const JNIEnv *, const jclass, const jlong, const jbyte);
 
 /*
  * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
@@ -198,6 +222,142 @@ Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1int_1volatile(const JNIEn
 JNIEXPORT void JNICALL
 Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1long_1volatile(const JNIEnv *, const jclass, const jlong, const jlong);
 
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_get_byte_opaque
+ * Signature: (J)B
+ */
+JNIEXPORT jbyte JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1byte_1opaque(const JNIEnv *, const jclass, const jlong);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_get_short_opaque
+ * Signature: (J)S
+ */
+JNIEXPORT jshort JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1short_1opaque(const JNIEnv *, const jclass, const jlong);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_get_int_opaque
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1int_1opaque(const JNIEnv *, const jclass, const jlong);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_get_long_opaque
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1long_1opaque(const JNIEnv *, const jclass, const jlong);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_get_byte_acquire
+ * Signature: (J)B
+ */
+JNIEXPORT jbyte JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1byte_1acquire(const JNIEnv *, const jclass, const jlong);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_get_short_acquire
+ * Signature: (J)S
+ */
+JNIEXPORT jshort JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1short_1acquire(const JNIEnv *, const jclass, const jlong);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_get_int_acquire
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1int_1acquire(const JNIEnv *, const jclass, const jlong);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_get_long_acquire
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1long_1acquire(const JNIEnv *, const jclass, const jlong);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_put_byte_opaque
+ * Signature: (JB)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1byte_1opaque(const JNIEnv *, const jclass, const jlong, const jbyte);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_put_short_opaque
+ * Signature: (JS)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1short_1opaque(const JNIEnv *, const jclass, const jlong, const jshort);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_put_int_opaque
+ * Signature: (JI)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1int_1opaque(const JNIEnv *, const jclass, const jlong, const jint);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_put_long_opaque
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1long_1opaque(const JNIEnv *, const jclass, const jlong, const jlong);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_put_byte_release
+ * Signature: (JB)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1byte_1release(const JNIEnv *, const jclass, const jlong, const jbyte);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_put_short_release
+ * Signature: (JS)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1short_1release(const JNIEnv *, const jclass, const jlong, const jshort);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_put_int_release
+ * Signature: (JI)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1int_1release(const JNIEnv *, const jclass, const jlong, const jint);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_put_long_release
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1long_1release(const JNIEnv *, const jclass, const jlong, const jlong);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_get
+ * Signature: (JI[BI)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get(JNIEnv *, const jclass, const jlong, const jint, const jbyteArray, const jint);
+
 /*
  * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
  * Method:    c_put
@@ -206,6 +366,22 @@ Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1long_1volatile(const JNIE
 JNIEXPORT void JNICALL
 Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put(JNIEnv *, const jclass, const jlong, const jint, const jbyteArray, const jint);
 
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_get_buffer
+ * Signature: (JILjava/nio/ByteBuffer;I)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1get_1buffer(JNIEnv *, const jclass, const jlong, const jint, const jobject, const jint);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_put_buffer
+ * Signature: (JILjava/nio/ByteBuffer;I)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put_1buffer(JNIEnv *, const jclass, const jlong, const jint, const jobject, const jint);
+
 /*
  * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
  * Method:    c_virt2phys
@@ -214,6 +390,118 @@ Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1put(JNIEnv *, const jclass, co
 JNIEXPORT jlong JNICALL
 Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1virt2phys(const JNIEnv *, const jclass, const jlong);
 
+/*
+ * Class:     de_tum_in_net_ixy_memory_JniMemoryManager
+ * Method:    c_virt2phys_bulk
+ * Signature: (JJIJ[J)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_JniMemoryManager_c_1virt2phys_1bulk(JNIEnv *, const jclass, const jlong, const jlong, const jint, const jlong, const jlongArray);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_TlbCounter
+ * Method:    c_dtlb_misses
+ * Signature: (JJJI)J
+ */
+JNIEXPORT jlong JNICALL
+Java_de_tum_in_net_ixy_memory_TlbCounter_c_1dtlb_1misses(const JNIEnv *, const jclass, const jlong, const jlong, const jlong, const jint);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_PacketKernels
+ * Method:    c_kernel
+ * Signature: ()I
+ */
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_PacketKernels_c_1kernel(const JNIEnv *, const jclass);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_PacketKernels
+ * Method:    c_fill
+ * Signature: ([JIIIB)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_PacketKernels_c_1fill(JNIEnv *, const jclass, const jlongArray, const jint, const jint, const jint, const jbyte);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_PacketKernels
+ * Method:    c_copy
+ * Signature: ([JII[BI)V
+ */
+JNIEXPORT void JNICALL
+Java_de_tum_in_net_ixy_memory_PacketKernels_c_1copy(JNIEnv *, const jclass, const jlongArray, const jint, const jint, const jbyteArray, const jint);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_PacketKernels
+ * Method:    c_patch
+ * Signature: ([JI[BIII)I
+ */
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_PacketKernels_c_1patch(JNIEnv *, const jclass, const jlongArray, const jint, const jbyteArray, const jint, const jint, jint);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_Checksums
+ * Method:    c_sum
+ * Signature: (JI)I
+ */
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_Checksums_c_1sum(const JNIEnv *, const jclass, const jlong, const jint);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_VarHandleMemoryManager
+ * Method:    c_is_valid
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL
+Java_de_tum_in_net_ixy_memory_VarHandleMemoryManager_c_1is_1valid(const JNIEnv *, const jclass);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_VarHandleMemoryManager
+ * Method:    c_address_size
+ * Signature: ()I
+ */
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_VarHandleMemoryManager_c_1address_1size(const JNIEnv *, const jclass);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_VarHandleMemoryManager
+ * Method:    c_page_size
+ * Signature: ()I
+ */
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_memory_VarHandleMemoryManager_c_1page_1size(const JNIEnv *, const jclass);
+
+/*
+ * Class:     de_tum_in_net_ixy_memory_VarHandleMemoryManager
+ * Method:    c_address
+ * Signature: (Ljava/nio/ByteBuffer;)J
+ */
+JNIEXPORT jlong JNICALL
+Java_de_tum_in_net_ixy_memory_VarHandleMemoryManager_c_1address(JNIEnv *, const jclass, const jobject);
+
+/*
+ * Class:     de_tum_in_net_ixy_ixgbe_IxgbeDevice
+ * Method:    c_rx_batch
+ * Signature: (JII[J[JII)I
+ */
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_ixgbe_IxgbeDevice_c_1rx_1batch(JNIEnv *, const jclass, const jlong, const jint, const jint, const jlongArray, const jlongArray, const jint, const jint);
+
+/*
+ * Class:     de_tum_in_net_ixy_ixgbe_IxgbeDevice
+ * Method:    c_rx_refill
+ * Signature: (JII[J[JI)I
+ */
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_ixgbe_IxgbeDevice_c_1rx_1refill(JNIEnv *, const jclass, const jlong, jint, const jint, const jlongArray, const jlongArray, const jint);
+
+/*
+ * Class:     de_tum_in_net_ixy_ixgbe_IxgbeDevice
+ * Method:    c_tx_batch
+ * Signature: (JIII[J[JIIII)I
+ */
+JNIEXPORT jint JNICALL
+Java_de_tum_in_net_ixy_ixgbe_IxgbeDevice_c_1tx_1batch(JNIEnv *, const jclass, const jlong, jint, const jint, jint, const jlongArray, const jlongArray, const jint, const jint, const jint, const jint);
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,6 +5,7 @@ import de.tum.in.net.ixy.memory.MemoryManager;
 import de.tum.in.net.ixy.memory.PacketBufferWrapper;
 import de.tum.in.net.ixy.memory.SmartJniMemoryManager;
 import de.tum.in.net.ixy.memory.SmartUnsafeMemoryManager;
+import de.tum.in.net.ixy.memory.VarHandleMemoryManager;
 import de.tum.in.net.ixy.utils.Threads;
 
 import java.io.Closeable;
@@ -19,6 +20,8 @@ import java.nio.channels.FileChannel;
 import java.nio.channels.SeekableByteChannel;
 import java.nio.charset.StandardCharsets;
 import java.nio.file.Files;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.Path;
 import java.nio.file.Paths;
 import java.util.Collections;
 import java.util.List;
@@ -41,6 +44,7 @@ import static de.tum.in.net.ixy.BuildConfig.MEMORY_MANAGER;
 import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
 import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI;
 import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_VARHANDLE;
 import static de.tum.in.net.ixy.utils.Strings.leftPad;
 
 import static java.io.File.separator;
@@ -87,6 +91,9 @@ public abstract class Device implements Closeable {
 	/** The resource file {@code unbind}. */
 	private static final @NotNull String PCI_RES_UNBIND = "unbind";
 
+	/** The resource file {@code numa_node}. */
+	private static final @NotNull String PCI_RES_NUMA = "numa_node";
+
 	////////////////////////////////////////////////////// BYTES ///////////////////////////////////////////////////////
 
 	/** The minimum capacity a {@link ByteBuffer} needs to read the vendor id. */
@@ -175,6 +182,8 @@ public abstract class Device implements Closeable {
 			? JniMemoryManager.getSingleton()
 			: MEMORY_MANAGER == PREFER_JNI
 			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
 			: SmartUnsafeMemoryManager.getSingleton();
 
 	/** Holds the name of the device. */
@@ -368,6 +377,19 @@ public abstract class Device implements Closeable {
 		return (buffer.reset().getInt() & 0x00000001) == 0;
 	}
 
+	/**
+	 * Returns the NUMA node the PCI device is attached to.
+	 * <p>
+	 * Machines with a single NUMA node usually report {@code -1}, which means that any memory is equally close.
+	 *
+	 * @return The NUMA node or {@code -1} if it is unknown.
+	 */
+	@Contract(pure = true)
+	public int getNumaNode() {
+		if (DEBUG >= LOG_DEBUG) log.debug("Reading NUMA node of '{}'.", name);
+		return readNumaNode(Paths.get(String.format(PCI_RES_PATH_FMT, name, PCI_RES_NUMA)));
+	}
+
 	/**
 	 * Returns the memory of the PCI device mapped.
 	 *
@@ -400,6 +422,25 @@ public abstract class Device implements Closeable {
 		unbindChannel.close();
 	}
 
+	/**
+	 * Parses a {@code numa_node} resource file of a PCI device.
+	 *
+	 * @param path The path of the resource file.
+	 * @return The NUMA node or {@code -1} if the file does not exist or cannot be parsed.
+	 */
+	@Contract(pure = true)
+	static int readNumaNode(final @NotNull Path path) {
+		try {
+			val node = Integer.parseInt(new String(Files.readAllBytes(path), StandardCharsets.US_ASCII).trim());
+			return node < 0 ? -1 : node;
+		} catch (final NoSuchFileException e) {
+			if (DEBUG >= LOG_DEBUG) log.debug("The resource '{}' does not exist.", path);
+		} catch (final IOException | NumberFormatException e) {
+			if (DEBUG >= LOG_ERROR) log.error("The resource '{}' cannot be read or parsed.", path, e);
+		}
+		return -1;
+	}
+
 	/**
 	 * Returns the value of the field {@code command}.
 	 *
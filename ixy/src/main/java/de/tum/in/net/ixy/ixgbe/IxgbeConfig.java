@@ -0,0 +1,351 @@
+package de.tum.in.net.ixy.ixgbe;
+
+import lombok.Getter;
+import lombok.extern.slf4j.Slf4j;
+
+import org.jetbrains.annotations.Contract;
+import org.jetbrains.annotations.NotNull;
+
+import static de.tum.in.net.ixy.BuildConfig.DEBUG;
+import static de.tum.in.net.ixy.BuildConfig.LOG_DEBUG;
+
+/**
+ * The configuration of the queues of an {@link IxgbeDevice}, which is read when the device is created.
+ * <p>
+ * Small descriptor rings keep the packets in flight, and therefore the latency, low, while big ones absorb bigger
+ * bursts before the NIC starts dropping packets. Every value is validated against the limits of the NIC when it is set,
+ * and the device validates the combination of all of them when it is created. Unlike the hot paths of the driver, the
+ * validation is not skipped in optimized builds, because it only runs while configuring the device.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@Slf4j
+@SuppressWarnings({"ConstantConditions", "JavaDoc", "PMD.BeanMembersShouldSerialize"})
+public final class IxgbeConfig {
+
+	///////////////////////////////////////////////// STATIC VARIABLES /////////////////////////////////////////////////
+
+	/** The minimum number of entries of a descriptor ring. */
+	public static final int MIN_ENTRIES = 64;
+
+	/** The maximum number of entries of an RX descriptor ring. */
+	public static final int RX_MAX_ENTRIES = 4096;
+
+	/** The maximum number of entries of a TX descriptor ring. */
+	public static final int TX_MAX_ENTRIES = 4096;
+
+	/** The default number of entries of an RX descriptor ring. */
+	public static final int DEFAULT_RX_ENTRIES = 512;
+
+	/** The default number of entries of a TX descriptor ring. */
+	public static final int DEFAULT_TX_ENTRIES = 512;
+
+	/** The minimum size of a packet buffer, which fits a segment of 1 KB after the header. */
+	public static final int MIN_BUFFER_SIZE = 2048;
+
+	/** The maximum size of a packet buffer, limited by the 16 KB the NIC can be told about. */
+	public static final int MAX_BUFFER_SIZE = 16384;
+
+	/** The default size of a packet buffer, which fits a frame of the default MTU in the whole KBs after the header. */
+	public static final int DEFAULT_BUFFER_SIZE = 4096;
+
+	/** The default minimum number of entries of a memory pool. */
+	public static final int DEFAULT_MEMPOOL_ENTRIES = 4096;
+
+	/** The default number of transmitted packets to clean per batch. */
+	public static final int DEFAULT_TX_CLEAN_BATCH = 32;
+
+	/** The maximum value of a threshold of the {@code TXDCTL} register, which are 7 bits wide. */
+	private static final int TXDCTL_THRESHOLD_MASK = 0x7F;
+
+	/** The number of descriptors of the on-chip cache of a TX queue, which bounds the TX thresholds. */
+	public static final int TX_DESCRIPTOR_CACHE = 40;
+
+	/** The default prefetch threshold of a TX queue. */
+	public static final int DEFAULT_TX_PREFETCH_THRESHOLD = 36;
+
+	/** The default host threshold of a TX queue. */
+	public static final int DEFAULT_TX_HOST_THRESHOLD = 8;
+
+	/** The default writeback threshold of a TX queue. */
+	public static final int DEFAULT_TX_WRITEBACK_THRESHOLD = 4;
+
+	///////////////////////////////////////////////// MEMBER VARIABLES /////////////////////////////////////////////////
+
+	/**
+	 * The number of entries of every RX descriptor ring.
+	 * -- GETTER --
+	 * Returns the number of entries of every RX descriptor ring.
+	 *
+	 * @return The number of entries of every RX descriptor ring.
+	 */
+	@Getter
+	private int rxEntries = DEFAULT_RX_ENTRIES;
+
+	/**
+	 * The number of entries of every TX descriptor ring.
+	 * -- GETTER --
+	 * Returns the number of entries of every TX descriptor ring.
+	 *
+	 * @return The number of entries of every TX descriptor ring.
+	 */
+	@Getter
+	private int txEntries = DEFAULT_TX_ENTRIES;
+
+	/**
+	 * The size of the packet buffers of the RX memory pools.
+	 * -- GETTER --
+	 * Returns the size of the packet buffers of the RX memory pools.
+	 *
+	 * @return The size of the packet buffers of the RX memory pools.
+	 */
+	@Getter
+	private int bufferSize = DEFAULT_BUFFER_SIZE;
+
+	/**
+	 * The minimum number of entries of the memory pool of every RX queue.
+	 * -- GETTER --
+	 * Returns the minimum number of entries of the memory pool of every RX queue.
+	 *
+	 * @return The minimum number of entries of the memory pool of every RX queue.
+	 */
+	@Getter
+	private int mempoolEntries = DEFAULT_MEMPOOL_ENTRIES;
+
+	/**
+	 * The number of transmitted packets to clean per batch.
+	 * -- GETTER --
+	 * Returns the number of transmitted packets to clean per batch.
+	 *
+	 * @return The number of transmitted packets to clean per batch.
+	 */
+	@Getter
+	private int txCleanBatch = DEFAULT_TX_CLEAN_BATCH;
+
+	/**
+	 * The number of free descriptors in the on-chip cache below which a TX queue prefetches more.
+	 * -- GETTER --
+	 * Returns the prefetch threshold of every TX queue.
+	 *
+	 * @return The prefetch threshold of every TX queue.
+	 */
+	@Getter
+	private int txPrefetchThreshold = DEFAULT_TX_PREFETCH_THRESHOLD;
+
+	/**
+	 * The minimum number of descriptors available in host memory for a TX queue to prefetch them.
+	 * -- GETTER --
+	 * Returns the host threshold of every TX queue.
+	 *
+	 * @return The host threshold of every TX queue.
+	 */
+	@Getter
+	private int txHostThreshold = DEFAULT_TX_HOST_THRESHOLD;
+
+	/**
+	 * The number of processed descriptors a TX queue accumulates before writing them back.
+	 * -- GETTER --
+	 * Returns the writeback threshold of every TX queue.
+	 *
+	 * @return The writeback threshold of every TX queue.
+	 */
+	@Getter
+	private int txWritebackThreshold = DEFAULT_TX_WRITEBACK_THRESHOLD;
+
+	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
+
+	/** Creates a configuration with the default values. */
+	public IxgbeConfig() {
+		// Every field is initialized with its default value
+	}
+
+	/**
+	 * Creates a copy of another configuration.
+	 *
+	 * @param config The configuration to copy.
+	 */
+	public IxgbeConfig(final @NotNull IxgbeConfig config) {
+		if (config == null) throw new NullPointerException("The parameter 'config' MUST NOT be null.");
+		rxEntries = config.rxEntries;
+		txEntries = config.txEntries;
+		bufferSize = config.bufferSize;
+		mempoolEntries = config.mempoolEntries;
+		txCleanBatch = config.txCleanBatch;
+		txPrefetchThreshold = config.txPrefetchThreshold;
+		txHostThreshold = config.txHostThreshold;
+		txWritebackThreshold = config.txWritebackThreshold;
+	}
+
+	/**
+	 * Sets the number of entries of every RX descriptor ring, which is {@link #DEFAULT_RX_ENTRIES} by default.
+	 *
+	 * @param rxEntries The number of entries, a power of two inside [{@link #MIN_ENTRIES}, {@link #RX_MAX_ENTRIES}].
+	 * @return This configuration.
+	 */
+	@Contract(value = "_ -> this", mutates = "this")
+	public @NotNull IxgbeConfig setRxEntries(final int rxEntries) {
+		checkEntries(rxEntries, RX_MAX_ENTRIES);
+		if (DEBUG >= LOG_DEBUG) log.debug("Setting the number of RX entries to {}.", rxEntries);
+		this.rxEntries = rxEntries;
+		return this;
+	}
+
+	/**
+	 * Sets the number of entries of every TX descriptor ring, which is {@link #DEFAULT_TX_ENTRIES} by default.
+	 *
+	 * @param txEntries The number of entries, a power of two inside [{@link #MIN_ENTRIES}, {@link #TX_MAX_ENTRIES}].
+	 * @return This configuration.
+	 */
+	@Contract(value = "_ -> this", mutates = "this")
+	public @NotNull IxgbeConfig setTxEntries(final int txEntries) {
+		checkEntries(txEntries, TX_MAX_ENTRIES);
+		if (DEBUG >= LOG_DEBUG) log.debug("Setting the number of TX entries to {}.", txEntries);
+		this.txEntries = txEntries;
+		return this;
+	}
+
+	/**
+	 * Sets the size of the packet buffers of the RX memory pools, which is {@link #DEFAULT_BUFFER_SIZE} by default.
+	 * <p>
+	 * Bigger packet buffers store jumbo frames in fewer segments at the cost of more memory per packet. The size must
+	 * be a power of two so the packet buffers never cross a huge memory page. The NIC can only use the whole KBs left
+	 * after the header of a packet buffer, so the device uses bigger packet buffers when the frames of the MTU do not
+	 * fit in them.
+	 *
+	 * @param bufferSize The size, a power of two inside [{@link #MIN_BUFFER_SIZE}, {@link #MAX_BUFFER_SIZE}].
+	 * @return This configuration.
+	 */
+	@Contract(value = "_ -> this", mutates = "this")
+	public @NotNull IxgbeConfig setBufferSize(final int bufferSize) {
+		if (bufferSize < MIN_BUFFER_SIZE || bufferSize > MAX_BUFFER_SIZE) {
+			throw new IllegalArgumentException("The parameter 'bufferSize' MUST be inside [MIN_BUFFER_SIZE, "
+					+ "MAX_BUFFER_SIZE].");
+		}
+		if ((bufferSize & (bufferSize - 1)) != 0) {
+			throw new IllegalArgumentException("The parameter 'bufferSize' MUST be a power of two.");
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Setting the packet buffer size to {} bytes.", bufferSize);
+		this.bufferSize = bufferSize;
+		return this;
+	}
+
+	/**
+	 * Sets the minimum number of entries of the memory pool of every RX queue, which is {@link
+	 * #DEFAULT_MEMPOOL_ENTRIES} by default.
+	 * <p>
+	 * The memory pool always has at least as many entries as both descriptor rings, so the rings can be filled. The
+	 * value is ignored when the RX queues use a memory pool shared with other devices.
+	 *
+	 * @param mempoolEntries The minimum number of entries.
+	 * @return This configuration.
+	 */
+	@Contract(value = "_ -> this", mutates = "this")
+	public @NotNull IxgbeConfig setMempoolEntries(final int mempoolEntries) {
+		if (mempoolEntries <= 0) {
+			throw new IllegalArgumentException("The parameter 'mempoolEntries' MUST be positive.");
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Setting the number of memory pool entries to {}.", mempoolEntries);
+		this.mempoolEntries = mempoolEntries;
+		return this;
+	}
+
+	/**
+	 * Sets the number of transmitted packets to clean per batch, which is {@link #DEFAULT_TX_CLEAN_BATCH} by default.
+	 * <p>
+	 * Bigger batches read fewer descriptors but return the packet buffers to their memory pool later.
+	 *
+	 * @param txCleanBatch The number of packets, which must be smaller than the number of TX entries.
+	 * @return This configuration.
+	 */
+	@Contract(value = "_ -> this", mutates = "this")
+	public @NotNull IxgbeConfig setTxCleanBatch(final int txCleanBatch) {
+		if (txCleanBatch <= 0 || txCleanBatch >= TX_MAX_ENTRIES) {
+			throw new IllegalArgumentException("The parameter 'txCleanBatch' MUST be inside [1, TX_MAX_ENTRIES).");
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Setting the TX clean batch to {} packets.", txCleanBatch);
+		this.txCleanBatch = txCleanBatch;
+		return this;
+	}
+
+	/**
+	 * Sets the thresholds of the {@code TXDCTL} register of every TX queue.
+	 * <p>
+	 * A queue prefetches descriptors when fewer than {@code prefetch} are cached and at least {@code host} are
+	 * available, and writes the processed ones back after {@code writeback} of them. A writeback threshold of {@code
+	 * 0} writes every descriptor back as soon as it is processed, which lowers the latency but increases the traffic
+	 * over PCIe.
+	 *
+	 * @param prefetch  The prefetch threshold, inside [0, {@link #TX_DESCRIPTOR_CACHE}].
+	 * @param host      The host threshold, inside [0, 127].
+	 * @param writeback The writeback threshold, inside [0, {@link #TX_DESCRIPTOR_CACHE}].
+	 * @return This configuration.
+	 */
+	@Contract(value = "_, _, _ -> this", mutates = "this")
+	public @NotNull IxgbeConfig setTxThresholds(final int prefetch, final int host, final int writeback) {
+		if (prefetch < 0 || prefetch > TX_DESCRIPTOR_CACHE) {
+			throw new IllegalArgumentException("The parameter 'prefetch' MUST be inside [0, TX_DESCRIPTOR_CACHE].");
+		}
+		if (host < 0 || host > TXDCTL_THRESHOLD_MASK) {
+			throw new IllegalArgumentException("The parameter 'host' MUST be inside [0, 127].");
+		}
+		if (writeback < 0 || writeback > TX_DESCRIPTOR_CACHE) {
+			throw new IllegalArgumentException("The parameter 'writeback' MUST be inside [0, TX_DESCRIPTOR_CACHE].");
+		}
+		if (DEBUG >= LOG_DEBUG) {
+			log.debug("Setting the TX thresholds to prefetch={}, host={}, writeback={}.", prefetch, host, writeback);
+		}
+		txPrefetchThreshold = prefetch;
+		txHostThreshold = host;
+		txWritebackThreshold = writeback;
+		return this;
+	}
+
+	/**
+	 * Checks that the combination of all the values is supported by the NIC.
+	 *
+	 * @throws IllegalArgumentException If the combination is not supported.
+	 */
+	@Contract(pure = true)
+	void check() {
+		if (txCleanBatch >= txEntries) {
+			throw new IllegalArgumentException("The TX clean batch MUST be smaller than the number of TX entries.");
+		}
+		if (txPrefetchThreshold >= txEntries || txWritebackThreshold >= txEntries) {
+			throw new IllegalArgumentException("The TX thresholds MUST be smaller than the number of TX entries.");
+		}
+	}
+
+	/**
+	 * Checks that the number of entries of a descriptor ring is supported.
+	 *
+	 * @param entries The number of entries.
+	 * @param max     The maximum number of entries.
+	 */
+	private static void checkEntries(final int entries, final int max) {
+		if (entries < MIN_ENTRIES || entries > max) {
+			throw new IllegalArgumentException("The number of entries MUST be inside [MIN_ENTRIES, " + max + "].");
+		}
+		if ((entries & (entries - 1)) != 0) {
+			throw new IllegalArgumentException("The number of entries MUST be a power of two.");
+		}
+	}
+
+	//////////////////////////////////////////////// OVERRIDDEN METHODS ////////////////////////////////////////////////
+
+	@Override
+	@Contract(pure = true)
+	public @NotNull String toString() {
+		return "IxgbeConfig"
+				+ "("
+				+ "rxEntries=" + rxEntries
+				+ ", txEntries=" + txEntries
+				+ ", bufferSize=" + bufferSize
+				+ ", mempoolEntries=" + mempoolEntries
+				+ ", txCleanBatch=" + txCleanBatch
+				+ ", txPrefetchThreshold=" + txPrefetchThreshold
+				+ ", txHostThreshold=" + txHostThreshold
+				+ ", txWritebackThreshold=" + txWritebackThreshold
+				+ ")";
+	}
+
+}
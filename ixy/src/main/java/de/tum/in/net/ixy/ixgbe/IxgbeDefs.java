@@ -95,6 +95,31 @@ final class IxgbeDefs {
 	static final int RDRXCTL = 0x02F00;
 	static final int RXCTRL = 0x03000;
 	// ...
+	static final int RSCDBU = 0x03028;
+	// ...
+	static final int RXCSUM = 0x05000;
+	static final int RFCTL = 0x05008;
+	static final int MRQC = 0x05818;
+	// ...
+	static final int FDIRCTRL = 0x0EE00;
+	static final int FDIRHKEY = 0x0EE68;
+	static final int FDIRSKEY = 0x0EE6C;
+	static final int FDIRDIP4M = 0x0EE3C;
+	static final int FDIRSIP4M = 0x0EE40;
+	static final int FDIRTCPM = 0x0EE44;
+	static final int FDIRUDPM = 0x0EE48;
+	static final int FDIRM = 0x0EE70;
+	// ...
+	static final int FDIRFREE = 0x0EE38;
+	static final int FDIRMATCH = 0x0EE58;
+	static final int FDIRMISS = 0x0EE5C;
+	// ...
+	static final int FDIRIPSA = 0x0EE18;
+	static final int FDIRIPDA = 0x0EE1C;
+	static final int FDIRPORT = 0x0EE20;
+	static final int FDIRVLAN = 0x0EE24;
+	static final int FDIRHASH = 0x0EE28;
+	static final int FDIRCMD = 0x0EE2C;
 	static final int FCTRL = 0x05080;
 	// ...
 	static final int DMATXCTL = 0x04A80;
@@ -116,6 +141,8 @@ final class IxgbeDefs {
 	// ...
 	static final int HLREG0 = 0x04240;
 	// ...
+	static final int MAXFRS = 0x04268;
+	// ...
 	static final int AUTOC = 0x042A0;
 	static final int LINKS = 0x042A4;
 	// ...
@@ -129,6 +156,11 @@ final class IxgbeDefs {
 	// ...
 	static final int RDRXCTL_DMAIDONE = 0x00000008;
 	// ...
+	static final int RDRXCTL_RSCFRSTSIZE = 0x003E0000;
+	// ...
+	static final int RDRXCTL_RSCACKC = 0x02000000;
+	static final int RDRXCTL_FCOE_WRFIX = 0x04000000;
+	// ...
 	private static final int CTRL_LNK_RST = 0x00000008;
 	private static final int CTRL_RST = 0x04000000;
 	static final int CTRL_RST_MASK = (CTRL_LNK_RST | CTRL_RST);
@@ -141,9 +173,12 @@ final class IxgbeDefs {
 	// ...
 	static final int HLREG0_TXCRCEN = 0x00000001;
 	static final int HLREG0_RXCRCSTRP = 0x00000002;
+	static final int HLREG0_JUMBOEN = 0x00000004;
 	// ...
 	static final int HLREG0_TXPADEN = 0x00000400;
 	// ...
+	static final int MAXFRS_MFS_SHIFT = 16;
+	// ...
 	static final int AUTOC_AN_RESTART = 0x00001000;
 	// ...
 	static final int AUTOC_10G_PMA_PMD_MASK = 0x00000180;
@@ -167,34 +202,149 @@ final class IxgbeDefs {
 	static final int FCTRL_UPE = 0x00000200;
 	static final int FCTRL_BAM = 0x00000400;
 	// ...
+	static final int RXCSUM_PCSD = 0x00002000;
+	// ...
+	static final int RFCTL_RSC_DIS = 0x00000020;
+	// ...
+	static final int RSCDBU_RSCACKDIS = 0x00000080;
+	// ...
+	static final int RSCCTL_RSCEN = 0x00000001;
+	static final int RSCCTL_MAXDESC_1 = 0x00000000;
+	static final int RSCCTL_MAXDESC_4 = 0x00000004;
+	static final int RSCCTL_MAXDESC_8 = 0x00000008;
+	static final int RSCCTL_MAXDESC_16 = 0x0000000C;
+	// ...
+	static final int PSRTYPE_TCPHDR = 0x00000010;
+	// ...
+	static final int EITR_ITR_INT_MASK = 0x00000FF8;
+	static final int EITR_ITR_INT_SHIFT = 3;
+	static final int EITR_CNT_WDIS = 0x80000000;
+	// ...
+	static final int IVAR_ALLOC_VAL = 0x00000080;
+	// ...
+	static final int MRQC_RSSEN = 0x00000001;
+	static final int MRQC_RSS_FIELD_IPV4_TCP = 0x00010000;
+	static final int MRQC_RSS_FIELD_IPV4 = 0x00020000;
+	static final int MRQC_RSS_FIELD_IPV6_EX_TCP = 0x00040000;
+	static final int MRQC_RSS_FIELD_IPV6_EX = 0x00080000;
+	static final int MRQC_RSS_FIELD_IPV6 = 0x00100000;
+	static final int MRQC_RSS_FIELD_IPV6_TCP = 0x00200000;
+	static final int MRQC_RSS_FIELD_IPV4_UDP = 0x00400000;
+	static final int MRQC_RSS_FIELD_IPV6_UDP = 0x00800000;
+	static final int MRQC_RSS_FIELD_IPV6_EX_UDP = 0x01000000;
+	static final int MRQC_RSS_FIELD_MASK = 0xFFFF0000;
+	// ...
+	static final int FDIRCTRL_PBALLOC_64K = 0x00000001;
+	static final int FDIRCTRL_INIT_DONE = 0x00000008;
+	static final int FDIRCTRL_PERFECT_MATCH = 0x00000010;
+	static final int FDIRCTRL_FLEX_SHIFT = 16;
+	static final int FDIRCTRL_MAX_LENGTH_SHIFT = 24;
+	static final int FDIRCTRL_FULL_THRESH_SHIFT = 28;
+	// ...
+	static final int FDIRM_VLANID = 0x00000001;
+	static final int FDIRM_VLANP = 0x00000002;
+	static final int FDIRM_POOL = 0x00000004;
+	// ...
+	static final int FDIRM_FLEX = 0x00000010;
+	// ...
+	static final int FDIRFREE_FREE_MASK = 0x0000FFFF;
+	// ...
+	static final int FDIRPORT_DESTINATION_SHIFT = 16;
+	// ...
+	static final int FDIRHASH_SIG_SW_INDEX_SHIFT = 16;
+	// ...
+	static final int FDIRCMD_CMD_MASK = 0x00000003;
+	static final int FDIRCMD_CMD_ADD_FLOW = 0x00000001;
+	static final int FDIRCMD_CMD_REMOVE_FLOW = 0x00000002;
+	static final int FDIRCMD_CMD_QUERY_REM_FILT = 0x00000003;
+	static final int FDIRCMD_FILTER_VALID = 0x00000004;
+	static final int FDIRCMD_FILTER_UPDATE = 0x00000008;
+	// ...
+	static final int FDIRCMD_CLEARHT = 0x00000100;
+	// ...
+	static final int FDIRCMD_LAST = 0x00000800;
+	// ...
+	static final int FDIRCMD_QUEUE_EN = 0x00008000;
+	static final int FDIRCMD_FLOW_TYPE_SHIFT = 5;
+	static final int FDIRCMD_RX_QUEUE_SHIFT = 16;
+	// ...
+	static final int ATR_BUCKET_HASH_KEY = 0x3DAD14E2;
+	static final int ATR_SIGNATURE_HASH_KEY = 0x174D3614;
+	static final int ATR_COMMON_HASH_KEY = ATR_BUCKET_HASH_KEY & ATR_SIGNATURE_HASH_KEY;
+	// ...
+	static final int ATR_FLOW_TYPE_UDPV4 = 0x1;
+	static final int ATR_FLOW_TYPE_TCPV4 = 0x2;
+	// ...
 	private static final int TXD_CMD_EOP = 0x01000000;
 	private static final int TXD_CMD_IFCS = 0x02000000;
 	// ...
 	private static final int TXD_CMD_RS = 0x08000000;
 	private static final int TXD_CMD_DEXT = 0x20000000;
 	// ...
+	private static final int TXD_CMD_TSE = 0x80000000;
+	// ...
 	private static final int TXD_STAT_DD = 0x00000001;
 	// ...
 	private static final int RXD_STAT_DD = 0x01;
 	private static final int RXD_STAT_EOP = 0x02;
 	// ...
+	private static final int RXD_STAT_VP = 0x08;
+	// ...
+	private static final int RXD_STAT_L4CS = 0x20;
+	private static final int RXD_STAT_IPCS = 0x40;
+	// ...
+	static final int SRRCTL_BSIZEPKT_SHIFT = 10;
+	static final int SRRCTL_BSIZEPKT_MASK = 0x0000007F;
+	// ...
 	static final int SRRCTL_DROP_EN = 0x10000000;
 	// ...
 	static final int SRRCTL_DESCTYPE_ADV_ONEBUF = 0x02000000;
 	// ...
 	static final int SRRCTL_DESCTYPE_MASK = 0x0E000000;
 	// ...
+	static final int ADVTXD_DTYP_CTXT = 0x00200000;
 	static final int ADVTXD_DTYP_DATA = 0x00300000;
 	// ...
 	static final int RXDADV_STAT_DD = RXD_STAT_DD;
 	static final int RXDADV_STAT_EOP = RXD_STAT_EOP;
+	static final int RXDADV_STAT_VP = RXD_STAT_VP;
+	static final int RXDADV_STAT_L4CS = RXD_STAT_L4CS;
+	static final int RXDADV_STAT_IPCS = RXD_STAT_IPCS;
+	// ...
+	static final int RXDADV_ERR_TCPE = 0x40000000;
+	static final int RXDADV_ERR_IPE = 0x80000000;
+	// ...
+	static final int RXDADV_NEXTP_MASK = 0x000FFFF0;
+	static final int RXDADV_NEXTP_SHIFT = 4;
+	// ...
+	static final int RXDADV_RSCCNT_MASK = 0x001E0000;
+	static final int RXDADV_RSCCNT_SHIFT = 17;
+	// ...
+	static final int RXDADV_RSSTYPE_MASK = 0x0000000F;
+	static final int RXDADV_PKTTYPE_IPV4 = 0x00000010;
+	static final int RXDADV_PKTTYPE_IPV4_EX = 0x00000020;
+	static final int RXDADV_PKTTYPE_IPV6 = 0x00000040;
+	static final int RXDADV_PKTTYPE_IPV6_EX = 0x00000080;
+	static final int RXDADV_PKTTYPE_TCP = 0x00000100;
+	static final int RXDADV_PKTTYPE_UDP = 0x00000200;
+	static final int RXDADV_PKTTYPE_SCTP = 0x00000400;
+	static final int RXDADV_PKTTYPE_ETQF = 0x00008000;
 	// ...
 	static final int ADVTXD_STAT_DD = TXD_STAT_DD;
 	static final int ADVTXD_DCMD_EOP = TXD_CMD_EOP;
 	static final int ADVTXD_DCMD_IFCS = TXD_CMD_IFCS;
 	static final int ADVTXD_DCMD_RS = TXD_CMD_RS;
 	static final int ADVTXD_DCMD_DEXT = TXD_CMD_DEXT;
+	static final int ADVTXD_DCMD_TSE = TXD_CMD_TSE;
 	static final int ADVTXD_PAYLEN_SHIFT = 14;
+	static final int ADVTXD_CC = 0x00000080;
+	static final int ADVTXD_POPTS_IXSM = 0x00000100;
+	static final int ADVTXD_POPTS_TXSM = 0x00000200;
+	static final int ADVTXD_TUCMD_IPV4 = 0x00000400;
+	static final int ADVTXD_TUCMD_L4T_UDP = 0x00000000;
+	static final int ADVTXD_TUCMD_L4T_TCP = 0x00000800;
+	static final int ADVTXD_L4LEN_SHIFT = 8;
+	static final int ADVTXD_MSS_SHIFT = 16;
 
 	/**
 	 * Returns the offset of the register <em>Split Receive Control Registers</em> for the given {@code queue}.
@@ -226,6 +376,52 @@ final class IxgbeDefs {
 		return 0x0D00C + (queue - 64) * 0x40;
 	}
 
+	/**
+	 * Returns the offset of the register <em>RSC Control</em> for the given {@code queue}.
+	 *
+	 * @param queue The queue id.
+	 * @return The register offset.
+	 */
+	static int RSCCTL(final int queue) {
+		if (Integer.compareUnsigned(queue, 64) < 0) {
+			return 0x0102C + queue * 0x40;
+		}
+		return 0x0D02C + (queue - 64) * 0x40;
+	}
+
+	/**
+	 * Returns the offset of the register <em>Packet Split Receive Type</em> for the given {@code queue}.
+	 *
+	 * @param queue The queue id.
+	 * @return The register offset.
+	 */
+	static int PSRTYPE(final int queue) {
+		return 0x0EA00 + queue * 4;
+	}
+
+	/**
+	 * Returns the offset of the register <em>Extended Interrupt Throttle</em> for the given {@code vector}.
+	 *
+	 * @param vector The interrupt vector.
+	 * @return The register offset.
+	 */
+	static int EITR(final int vector) {
+		if (Integer.compareUnsigned(vector, 23) <= 0) {
+			return 0x00820 + vector * 4;
+		}
+		return 0x012300 + (vector - 24) * 4;
+	}
+
+	/**
+	 * Returns the offset of the register <em>Interrupt Vector Allocation</em> for the given pair of {@code queues}.
+	 *
+	 * @param queues The pair of queues.
+	 * @return The register offset.
+	 */
+	static int IVAR(final int queues) {
+		return 0x00900 + queues * 4;
+	}
+
 	/**
 	 * Returns the offset of the register <em>Receive Packet Buffer Size</em> for the given {@code queue}.
 	 *
@@ -246,6 +442,37 @@ final class IxgbeDefs {
 		return 0x0CC00 + queue * 4;
 	}
 
+	/**
+	 * Returns the offset of the register <em>Redirection Table</em> for the given group of four {@code entries}.
+	 *
+	 * @param entries The group of entries.
+	 * @return The register offset.
+	 */
+	static int RETA(final int entries) {
+		return 0x05C00 + entries * 4;
+	}
+
+	/**
+	 * Returns the offset of the register <em>RSS Random Key</em> for the given group of four {@code bytes}.
+	 *
+	 * @param bytes The group of bytes.
+	 * @return The register offset.
+	 */
+	static int RSSRK(final int bytes) {
+		return 0x05C80 + bytes * 4;
+	}
+
+	/**
+	 * Returns the offset of the register <em>Flow Director Filters Source IPv6</em> for the given group of four {@code
+	 * bytes}.
+	 *
+	 * @param bytes The group of bytes.
+	 * @return The register offset.
+	 */
+	static int FDIRSIPv6(final int bytes) {
+		return 0x0EE0C + bytes * 4;
+	}
+
 	/**
 	 * Returns the offset of the register <em>Receive Descriptor Base Address Low</em> for the given {@code queue}.
 	 *
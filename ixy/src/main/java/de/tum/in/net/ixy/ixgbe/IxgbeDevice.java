@@ -2,10 +2,13 @@ package de.tum.in.net.ixy.ixgbe;
 
 import de.tum.in.net.ixy.Device;
 import de.tum.in.net.ixy.Stats;
+import de.tum.in.net.ixy.memory.Checksums;
+import de.tum.in.net.ixy.memory.DmaArena;
 import de.tum.in.net.ixy.memory.Mempool;
 import de.tum.in.net.ixy.memory.PacketBufferWrapper;
 import de.tum.in.net.ixy.memory.PacketBufferWrapperConstants;
 import de.tum.in.net.ixy.utils.Threads;
+import de.tum.in.net.ixy.utils.Toeplitz;
 
 import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
 
@@ -13,10 +16,12 @@ import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
+import java.util.Arrays;
 
 import lombok.extern.slf4j.Slf4j;
 import lombok.val;
 
+import org.jetbrains.annotations.Contract;
 import org.jetbrains.annotations.NotNull;
 import org.jetbrains.annotations.Nullable;
 
@@ -25,7 +30,9 @@ import static de.tum.in.net.ixy.BuildConfig.LOG_DEBUG;
 import static de.tum.in.net.ixy.BuildConfig.LOG_INFO;
 import static de.tum.in.net.ixy.BuildConfig.LOG_TRACE;
 import static de.tum.in.net.ixy.BuildConfig.LOG_WARN;
+import static de.tum.in.net.ixy.BuildConfig.MEMORY_MANAGER;
 import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI_FULL;
 import static de.tum.in.net.ixy.utils.Strings.leftPad;
 
 /**
@@ -42,29 +49,20 @@ public final class IxgbeDevice extends Device {
 	/** The maximum number of queues supported. */
 	private static final int MAX_QUEUES = 64;
 
-	/** The minimum number of entries of the memory pool. */
-	private static final int MIN_MEMPOOL_ENTRIES = 4096;
-
-	/** The maximum number of entries per RX queue. */
-	private static final short RX_MAX_ENTRIES = 4096;
-
-	/** The maximum number of entries per TX queue. */
-	private static final short TX_MAX_ENTRIES = 4096;
-
-	/** The number of entries per RX queue. */
-	private static final short RX_ENTRIES = 512;
-
-	/** The number of entries per TX queue. */
-	private static final short TX_ENTRIES = 512;
-
 	/** The size of a descriptor of the RX queue. */
 	private static final int RX_DESCRIPTOR_SIZE = 16;
 
 	/** The size of a descriptor of the TX queue. */
 	private static final int TX_DESCRIPTOR_SIZE = 16;
 
-	/** The amount of packets to clean per batch. */
-	private static final short TX_CLEAN_BATCH = 32;
+	/** The alignment of the base address of a descriptor ring. */
+	private static final int RING_ALIGNMENT = 128;
+
+	/** The maximum number of data descriptors of a packet that is not segmented by the NIC. */
+	private static final int TX_MAX_SEGMENTS = 40;
+
+	/** The maximum TCP payload length of a packet that is segmented by the NIC. */
+	private static final int TSO_MAX_PAYLOAD = (1 << 18) - 1;
 
 	/** The factor used to transform Mbps to bps. */
 	private static final int CLASS_NIC = 0x02;
@@ -72,12 +70,147 @@ public final class IxgbeDevice extends Device {
 	/** The number of milliseconds to wait for the link to come up. */
 	private static final int WAIT_LINK_MS = 10_000;
 
-	////////////////////////////////////////////////// STATIC METHODS //////////////////////////////////////////////////
+	/** The default MTU of Ethernet. */
+	public static final int DEFAULT_MTU = 1500;
 
-	static {
-		if (RX_ENTRIES > RX_MAX_ENTRIES) throw new IllegalStateException("The number of RX entries is too big.");
-		if (TX_ENTRIES > TX_MAX_ENTRIES) throw new IllegalStateException("The number of TX entries is too big.");
-	}
+	/** The minimum MTU, which is the one required by IPv4. */
+	public static final int MIN_MTU = 68;
+
+	/** The maximum MTU, which keeps the frames inside the 9.5 KB the NIC accepts. */
+	public static final int MAX_MTU = 9710;
+
+	/** The bytes an Ethernet frame adds to its payload: the header and the CRC. */
+	private static final int FRAME_OVERHEAD = 18;
+
+	/** The bytes an 802.1Q tag adds to an Ethernet frame, which the NIC accepts on top of the maximum frame size. */
+	private static final int VLAN_OVERHEAD = 4;
+
+	/** The minimum size of a packet buffer of the RX memory pools when the frames have to be split. */
+	private static final int RX_JUMBO_BUFFER_SIZE = 4096;
+
+	/** The granularity of the size of the packet buffers the NIC is told about. */
+	private static final int RX_SEGMENT_GRANULARITY = 1 << IxgbeDefs.SRRCTL_BSIZEPKT_SHIFT;
+
+	/** The maximum size of a packet coalesced by RSC, which limits the number of descriptors it can use. */
+	private static final int RSC_MAX_BYTES = 0xFFFF;
+
+	/**
+	 * The interval in microseconds of the interrupt throttling timer, which closes the RSC contexts that are still open
+	 * when it expires, so it bounds the latency RSC adds to a flow.
+	 */
+	private static final int RSC_ITR_INTERVAL = 500;
+
+	/** The number of entries of the RSS redirection table. */
+	public static final int RETA_ENTRIES = 128;
+
+	/** The maximum number of RX queues RSS can spread the traffic over, limited by the size of a table entry. */
+	public static final int RSS_MAX_QUEUES = 16;
+
+	/** The RSS hash type that hashes the addresses of IPv4 packets. */
+	public static final int RSS_IPV4 = IxgbeDefs.MRQC_RSS_FIELD_IPV4;
+
+	/** The RSS hash type that hashes the addresses and ports of TCP over IPv4 packets. */
+	public static final int RSS_IPV4_TCP = IxgbeDefs.MRQC_RSS_FIELD_IPV4_TCP;
+
+	/** The RSS hash type that hashes the addresses and ports of UDP over IPv4 packets. */
+	public static final int RSS_IPV4_UDP = IxgbeDefs.MRQC_RSS_FIELD_IPV4_UDP;
+
+	/** The RSS hash type that hashes the addresses of IPv6 packets. */
+	public static final int RSS_IPV6 = IxgbeDefs.MRQC_RSS_FIELD_IPV6 | IxgbeDefs.MRQC_RSS_FIELD_IPV6_EX;
+
+	/** The RSS hash type that hashes the addresses and ports of TCP over IPv6 packets. */
+	public static final int RSS_IPV6_TCP = IxgbeDefs.MRQC_RSS_FIELD_IPV6_TCP | IxgbeDefs.MRQC_RSS_FIELD_IPV6_EX_TCP;
+
+	/** The RSS hash type that hashes the addresses and ports of UDP over IPv6 packets. */
+	public static final int RSS_IPV6_UDP = IxgbeDefs.MRQC_RSS_FIELD_IPV6_UDP | IxgbeDefs.MRQC_RSS_FIELD_IPV6_EX_UDP;
+
+	/**
+	 * The RSS hash types used by default, which leave UDP out because fragmented datagrams would be hashed without
+	 * ports and reordered.
+	 */
+	public static final int RSS_DEFAULT = RSS_IPV4 | RSS_IPV4_TCP | RSS_IPV6 | RSS_IPV6_TCP;
+
+	/** All the RSS hash types. */
+	private static final int RSS_ALL = RSS_DEFAULT | RSS_IPV4_UDP | RSS_IPV6_UDP;
+
+	/** The number of perfect-match filters that fit in the 64 KB the Flow Director reserves, minus two reserved. */
+	public static final int FDIR_PERFECT_CAPACITY = 2046;
+
+	/** The number of signature filters that fit in the 64 KB the Flow Director reserves, minus two reserved. */
+	public static final int FDIR_SIGNATURE_CAPACITY = 8190;
+
+	/** The mask of the bucket hash of a perfect-match filter. */
+	private static final int FDIR_PERFECT_HASH_MASK = 0x1FFF;
+
+	/** The mask of the bucket and signature hashes of a signature filter. */
+	private static final int FDIR_SIGNATURE_HASH_MASK = 0x7FFF;
+
+	////////////////////////////////////////////////// NATIVE METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Collects the packets received by an RX queue in a single call.
+	 * <p>
+	 * The virtual addresses of the received packet buffers are stored in {@code received} and their sizes are copied
+	 * from the descriptors to the packet buffers. The descriptors are not refilled, which should be done with {@link
+	 * #c_rx_refill(long, int, int, long[], long[], int)}.
+	 * <p>
+	 * The segments of a packet that spans several descriptors are stored one after the other and linked, and the packet
+	 * is only collected once all of them have been written back. The number of packets is bounded by {@code length},
+	 * while the number of descriptors is only bounded by {@code budget}, so a packet with more segments than {@code
+	 * length} is still collected.
+	 *
+	 * @param ring     The virtual address of the descriptor ring.
+	 * @param index    The index of the first descriptor to process.
+	 * @param capacity The capacity of the descriptor ring.
+	 * @param buffers  The virtual addresses of the packet buffers of the descriptor ring.
+	 * @param received The virtual addresses of the received packet buffers.
+	 * @param budget   The maximum number of descriptors to collect, which must not exceed the size of {@code received}.
+	 * @param length   The maximum number of packets to collect.
+	 * @return The number of collected descriptors.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	static native int c_rx_batch(long ring, int index, int capacity, @NotNull long[] buffers, @NotNull long[] received,
+								 int budget, int length);
+
+	/**
+	 * Registers new packet buffers in the descriptors of an RX queue in a single call.
+	 *
+	 * @param ring     The virtual address of the descriptor ring.
+	 * @param index    The index of the first descriptor to refill.
+	 * @param capacity The capacity of the descriptor ring.
+	 * @param buffers  The virtual addresses of the packet buffers of the descriptor ring.
+	 * @param fresh    The virtual addresses of the packet buffers to register.
+	 * @param length   The number of descriptors to refill.
+	 * @return The index of the next descriptor to process.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native int c_rx_refill(long ring, int index, int capacity, @NotNull long[] buffers,
+										  @NotNull long[] fresh, int length);
+
+	/**
+	 * Writes the descriptors of a TX queue for a batch of packets in a single call.
+	 * <p>
+	 * A context descriptor is written before every packet whose offload flags or, when segmentation is requested,
+	 * maximum segment size differ from the ones programmed in the context of the queue. Context descriptors are
+	 * registered in the descriptor ring with a {@code 0} virtual address, and the segments of a chain that are not the
+	 * last one with {@link IxgbeTxQueue#MORE_SEGMENTS}. The packets that do not fit in the free descriptors are not
+	 * sent.
+	 *
+	 * @param ring     The virtual address of the descriptor ring.
+	 * @param index    The index of the first descriptor to write.
+	 * @param capacity The capacity of the descriptor ring.
+	 * @param free     The number of free descriptors.
+	 * @param buffers  The virtual addresses of the packet buffers of the descriptor ring.
+	 * @param packets  The virtual addresses of the packet buffers to send.
+	 * @param length   The number of packets to send.
+	 * @param flags    The command flags of every data descriptor.
+	 * @param context  The offload flags programmed in the context of the queue.
+	 * @param mss      The maximum segment size programmed in the context of the queue.
+	 * @return The index of the next descriptor to write.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native int c_tx_batch(long ring, int index, int capacity, int free, @NotNull long[] buffers,
+										 @NotNull long[] packets, int length, int flags, int context, int mss);
 
 	///////////////////////////////////////////////// MEMBER VARIABLES /////////////////////////////////////////////////
 
@@ -97,18 +230,91 @@ public final class IxgbeDevice extends Device {
 	/** The memory mapping of the PCI resource. */
 	private long mapResource;
 
+	/** The NUMA node the descriptor rings and the memory pools are bound to, which is the one of the NIC. */
+	private final int numaNode;
+
+	/** The DMA arena where the descriptor rings and the memory pools are allocated. */
+	private final @NotNull DmaArena arena;
+
+	/** The sizes of the huge memory pages that can be reserved, in ascending order. */
+	private final @NotNull long[] hugepageSizes;
+
+	/** The DMA arenas of the memory pools backed by other huge memory page sizes, indexed like the sizes. */
+	private final @NotNull DmaArena[] mempoolArenas;
+
+	/** The RSS hash types, or {@code 0} if RSS is disabled. */
+	private int rssHashTypes;
+
+	/** The RSS key. */
+	private final @NotNull byte[] rssKey;
+
+	/** The RSS redirection table, which maps the 7 least significant bits of the RSS hash to an RX queue. */
+	private final @NotNull byte[] redirectionTable;
+
+	/**
+	 * The Flow Director filters indexed by their id, or {@code null} if the Flow Director is disabled.
+	 * <p>
+	 * Every filter stores its flow type in the upper 32 bits and the value of its {@code FDIRHASH} register in the lower
+	 * 32 bits, which identify it when it has to be removed. Free ids are marked with {@code -1}.
+	 */
+	private @Nullable long[] fdirFilters;
+
+	/** Whether the Flow Director uses perfect-match filters instead of signature filters. */
+	private boolean fdirPerfect;
+
+	/** The number of packets that matched a Flow Director filter. */
+	private long fdirMatches;
+
+	/** The number of packets that did not match any Flow Director filter. */
+	private long fdirMisses;
+
+	/** The configuration of the queues. */
+	private final @NotNull IxgbeConfig config;
+
+	/** The maximum transmission unit, which is applied when the device is configured. */
+	private int mtu;
+
+	/** The size of a packet buffer of the RX memory pools, which depends on the MTU. */
+	private int rxBufferSize;
+
+	/** Whether the NIC coalesces the TCP segments of the same flow, which is applied when the device is configured. */
+	private boolean coalescing;
+
+	/** The memory pool shared by all the RX queues with other devices, or {@code null} to allocate one per queue. */
+	private @Nullable Mempool mempool;
+
 	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
 
+	/**
+	 * Creates a device driver for Intel Ixgbe devices with the default configuration.
+	 *
+	 * @param name     The device name.
+	 * @param rxQueues The number of read queues.
+	 * @param txQueues The number of write queues.
+	 * @throws FileNotFoundException If the device does not exist.
+	 */
+	public IxgbeDevice(final @NotNull String name, final int rxQueues, final int txQueues)
+			throws FileNotFoundException {
+		this(name, rxQueues, txQueues, new IxgbeConfig());
+	}
+
 	/**
 	 * Creates a device driver for Intel Ixgbe devices.
+	 * <p>
+	 * The configuration is copied, so modifying it afterwards does not affect the device.
 	 *
 	 * @param name     The device name.
 	 * @param rxQueues The number of read queues.
 	 * @param txQueues The number of write queues.
+	 * @param config   The configuration of the queues.
 	 * @throws FileNotFoundException If the device does not exist.
 	 */
-	public IxgbeDevice(final @NotNull String name, int rxQueues, int txQueues) throws FileNotFoundException {
+	public IxgbeDevice(final @NotNull String name, int rxQueues, int txQueues, final @NotNull IxgbeConfig config)
+			throws FileNotFoundException {
 		super(name, "ixgbe");
+		// The configuration is validated even in optimized builds, creating a device is not a hot path
+		if (config == null) throw new NullPointerException("The parameter 'config' MUST NOT be null.");
+		config.check();
 		if (!OPTIMIZED) {
 			if (rxQueues < 0 || txQueues < 0) {
 				throw new NegativeArraySizeException("The parameter 'rxQueues' and 'txQueues' MUST be positive.");
@@ -124,8 +330,20 @@ public final class IxgbeDevice extends Device {
 		}
 		this.rxQueues = new IxgbeRxQueue[rxQueues];
 		this.txQueues = new IxgbeTxQueue[txQueues];
-		this.cleanablePool = new PacketBufferWrapper[txQueues][TX_ENTRIES];
+		this.config = new IxgbeConfig(config);
+		this.cleanablePool = new PacketBufferWrapper[txQueues][config.getTxEntries()];
 		mapResource = super.map();
+		numaNode = getNumaNode();
+		if (DEBUG >= LOG_DEBUG) log.debug("Placing the descriptor rings and memory pools on NUMA node {}.", numaNode);
+		arena = new DmaArena(mmanager, 0, 0, numaNode);
+		hugepageSizes = mmanager.getHugepageSizes();
+		mempoolArenas = new DmaArena[hugepageSizes.length];
+		rssHashTypes = rxQueues > 1 ? RSS_DEFAULT : 0;
+		rssKey = Toeplitz.getDefaultKey();
+		redirectionTable = new byte[RETA_ENTRIES];
+		val spread = Math.max(1, Math.min(rxQueues, RSS_MAX_QUEUES));
+		for (var i = 0; i < RETA_ENTRIES; i += 1) redirectionTable[i] = (byte) (i % spread);
+		mtu = DEFAULT_MTU;
 	}
 
 	/** Does all the appropriate calls to reset and initialize the link properly. */
@@ -141,6 +359,7 @@ public final class IxgbeDevice extends Device {
 		// Initialize the structures of the queues
 		initRx();
 		initTx();
+		if (DEBUG >= LOG_DEBUG) log.debug("DMA arena usage: {}", arena);
 
 		// Start all Rx/Tx queues
 		for (var i = 0; i < rxQueues.length; i += 1) {
@@ -220,6 +439,60 @@ public final class IxgbeDevice extends Device {
 		if (DEBUG >= LOG_TRACE) log.trace("Accepting broadcast packets.");
 		setFlags(IxgbeDefs.FCTRL, IxgbeDefs.FCTRL_BAM);
 
+		// Frames that do not fit in a single packet buffer are split into segments of a multiple of 1 KB
+		val maxFrameSize = mtu + FRAME_OVERHEAD;
+		rxBufferSize = computeRxBufferSize();
+		if (mempool != null) {
+			val entrySize = mempool.getEntrySize();
+			if (entrySize < rxBufferSize || entrySize > IxgbeConfig.MAX_BUFFER_SIZE) {
+				throw new IllegalStateException("The packet buffers of the shared memory pool MUST be allocated and "
+						+ "inside [" + rxBufferSize + ", MAX_BUFFER_SIZE] bytes for the MTU.");
+			}
+			rxBufferSize = entrySize;
+		}
+		val segmentKb = rxSegmentKb(rxBufferSize);
+		if (DEBUG >= LOG_TRACE) log.trace("Setting the maximum frame size to {} bytes.", maxFrameSize);
+		setRegister(IxgbeDefs.MAXFRS, (getRegister(IxgbeDefs.MAXFRS) & 0xFFFF)
+				| maxFrameSize << IxgbeDefs.MAXFRS_MFS_SHIFT);
+		if (mtu > DEFAULT_MTU) {
+			if (DEBUG >= LOG_TRACE) log.trace("Enabling jumbo frames.");
+			setFlags(IxgbeDefs.HLREG0, IxgbeDefs.HLREG0_JUMBOEN);
+		} else {
+			clearFlags(IxgbeDefs.HLREG0, IxgbeDefs.HLREG0_JUMBOEN);
+		}
+
+		// RSC needs the CRC to be stripped, and coalesced packets are limited to 64 KB
+		val rscDescriptors = RSC_MAX_BYTES / (segmentKb * RX_SEGMENT_GRANULARITY);
+		val rscMaxDesc = rscDescriptors >= 16
+				? IxgbeDefs.RSCCTL_MAXDESC_16
+				: rscDescriptors >= 8
+				? IxgbeDefs.RSCCTL_MAXDESC_8
+				: rscDescriptors >= 4 ? IxgbeDefs.RSCCTL_MAXDESC_4 : IxgbeDefs.RSCCTL_MAXDESC_1;
+		if (coalescing) {
+			if (DEBUG >= LOG_TRACE) log.trace("Enabling RSC without coalescing pure ACKs.");
+			clearFlags(IxgbeDefs.RFCTL, IxgbeDefs.RFCTL_RSC_DIS);
+			setRegister(IxgbeDefs.RDRXCTL, (getRegister(IxgbeDefs.RDRXCTL) & ~IxgbeDefs.RDRXCTL_RSCFRSTSIZE)
+					| IxgbeDefs.RDRXCTL_RSCACKC | IxgbeDefs.RDRXCTL_FCOE_WRFIX);
+			setFlags(IxgbeDefs.RSCDBU, IxgbeDefs.RSCDBU_RSCACKDIS);
+
+			if (DEBUG >= LOG_TRACE) log.trace("Closing the RSC contexts every {} us.", RSC_ITR_INTERVAL);
+			val interval = (RSC_ITR_INTERVAL / 2) << IxgbeDefs.EITR_ITR_INT_SHIFT;
+			setRegister(IxgbeDefs.EITR(0), (interval & IxgbeDefs.EITR_ITR_INT_MASK) | IxgbeDefs.EITR_CNT_WDIS);
+		} else {
+			setFlags(IxgbeDefs.RFCTL, IxgbeDefs.RFCTL_RSC_DIS);
+		}
+
+		if (DEBUG >= LOG_TRACE) log.trace("Reporting the RSS hash instead of the fragment checksum.");
+		setFlags(IxgbeDefs.RXCSUM, IxgbeDefs.RXCSUM_PCSD);
+
+		if (DEBUG >= LOG_TRACE) log.trace("Configuring RSS.");
+		for (var i = 0; i < Toeplitz.KEY_BYTES / Integer.BYTES; i += 1) writeRssKey(i);
+		for (var i = 0; i < RETA_ENTRIES / Integer.BYTES; i += 1) writeRedirectionTable(i);
+		writeRssHashTypes();
+
+		if (DEBUG >= LOG_TRACE) log.trace("The reset disabled the Flow Director.");
+		fdirFilters = null;
+
 		if (DEBUG >= LOG_DEBUG) log.trace("Configuring all RX queues:");
 		for (var i = 0; i < rxQueues.length; i += 1) {
 			if (DEBUG >= LOG_DEBUG) log.debug(">>> Initializing RX queue #{}.", i);
@@ -227,12 +500,27 @@ public final class IxgbeDevice extends Device {
 			if (DEBUG >= LOG_TRACE) log.trace("Enabling advanced RX descriptors.");
 			setRegister(IxgbeDefs.SRRCTL(i), ((getRegister(IxgbeDefs.SRRCTL(i)) & ~IxgbeDefs.SRRCTL_DESCTYPE_MASK)) | IxgbeDefs.SRRCTL_DESCTYPE_ADV_ONEBUF);
 
+			if (DEBUG >= LOG_TRACE) log.trace("Setting the packet buffer size to {} KB.", segmentKb);
+			setRegister(IxgbeDefs.SRRCTL(i), (getRegister(IxgbeDefs.SRRCTL(i)) & ~IxgbeDefs.SRRCTL_BSIZEPKT_MASK)
+					| segmentKb);
+
 			if (DEBUG >= LOG_TRACE) log.trace("Dropping packets if not descriptors available.");
 			setFlags(IxgbeDefs.SRRCTL(i), IxgbeDefs.SRRCTL_DROP_EN);
 
+			if (coalescing) {
+				if (DEBUG >= LOG_TRACE) log.trace("Enabling RSC and mapping the queue to the throttled vector.");
+				setRegister(IxgbeDefs.RSCCTL(i), IxgbeDefs.RSCCTL_RSCEN | rscMaxDesc);
+				setFlags(IxgbeDefs.PSRTYPE(i), IxgbeDefs.PSRTYPE_TCPHDR);
+				val shift = (i & 1) * 2 * Byte.SIZE;
+				setRegister(IxgbeDefs.IVAR(i >>> 1), (getRegister(IxgbeDefs.IVAR(i >>> 1)) & ~(0xFF << shift))
+						| IxgbeDefs.IVAR_ALLOC_VAL << shift);
+			} else {
+				setRegister(IxgbeDefs.RSCCTL(i), 0);
+			}
+
 			if (DEBUG >= LOG_TRACE) log.trace("Enabling descriptor ring.");
-			val ringSizeBytes = RX_ENTRIES * RX_DESCRIPTOR_SIZE;
-			val dma = mmanager.dmaAllocate(ringSizeBytes, true, true);
+			val ringSizeBytes = config.getRxEntries() * RX_DESCRIPTOR_SIZE;
+			val dma = arena.allocate(ringSizeBytes, RING_ALIGNMENT);
 
 			if (DEBUG >= LOG_TRACE) log.trace("Setting everything to -1.");
 			var addr = dma.getVirtual();
@@ -255,8 +543,9 @@ public final class IxgbeDevice extends Device {
 			setRegister(IxgbeDefs.RDH(i), 0);
 			setRegister(IxgbeDefs.RDT(i), 0);
 
-			val queue = new IxgbeRxQueue(dma.getVirtual(), RX_ENTRIES);
+			val queue = new IxgbeRxQueue(dma.getVirtual(), (short) config.getRxEntries());
 			queue.index = 0;
+			queue.chains = coalescing ? new long[queue.capacity] : null;
 			rxQueues[i] = queue;
 		}
 
@@ -294,8 +583,8 @@ public final class IxgbeDevice extends Device {
 			if (DEBUG >= LOG_DEBUG) log.debug(">>> Initializing TX queue #{}.", i);
 
 			if (DEBUG >= LOG_TRACE) log.trace("Allocating memory for descriptor ring.");
-			val ringSizeBytes = TX_ENTRIES * TX_DESCRIPTOR_SIZE;
-			var dma = mmanager.dmaAllocate(ringSizeBytes, true, true);
+			val ringSizeBytes = config.getTxEntries() * TX_DESCRIPTOR_SIZE;
+			var dma = arena.allocate(ringSizeBytes, RING_ALIGNMENT);
 
 			if (DEBUG >= LOG_TRACE) log.trace("Setting everything to -1.");
 			var addr = dma.getVirtual();
@@ -315,13 +604,15 @@ public final class IxgbeDevice extends Device {
 				log.info("TX ring {} physical address 0x{}.", i, leftPad(dma.getPhysical()));
 			}
 
-			if (DEBUG >= LOG_TRACE) log.trace("Enabling writeback magic values.");
+			if (DEBUG >= LOG_TRACE) log.trace("Setting the prefetch, host and writeback thresholds.");
 			var txdctl = getRegister(IxgbeDefs.TXDCTL(i));
 			txdctl &= ~((0x7F << 16) | (0x7F << 8) | 0x7F);
-			txdctl |= ((4 << 16) | (8 << 8) | 36);
+			txdctl |= config.getTxWritebackThreshold() << 16
+					| config.getTxHostThreshold() << 8
+					| config.getTxPrefetchThreshold();
 			setRegister(IxgbeDefs.TXDCTL(i), txdctl);
 
-			var queue = new IxgbeTxQueue(dma.getVirtual(), TX_ENTRIES);
+			var queue = new IxgbeTxQueue(dma.getVirtual(), (short) config.getTxEntries());
 			queue.index = 0;
 			txQueues[i] = queue;
 		}
@@ -340,9 +631,14 @@ public final class IxgbeDevice extends Device {
 		if (DEBUG >= LOG_DEBUG) log.debug("Starting RX queue #{}.", queueId);
 		val queue = rxQueues[queueId];
 
-		if (DEBUG >= LOG_TRACE) log.trace("Allocating memory pool.");
-		val  mempoolSize = RX_ENTRIES + TX_ENTRIES;
-		queue.mempool = allocateMempool(Math.max(MIN_MEMPOOL_ENTRIES, mempoolSize), 2048);
+		if (mempool == null) {
+			if (DEBUG >= LOG_TRACE) log.trace("Allocating memory pool.");
+			val mempoolSize = Math.max(config.getMempoolEntries(), config.getRxEntries() + config.getTxEntries());
+			queue.mempool = allocateMempool(new Mempool(mempoolSize), rxBufferSize);
+		} else {
+			if (DEBUG >= LOG_TRACE) log.trace("Using the shared memory pool.");
+			queue.mempool = mempool;
+		}
 
 		if (DEBUG >= LOG_DEBUG) log.debug("Setting descriptor addresses:");
 		for (var i = 0; i < queue.capacity; i += 1) {
@@ -421,24 +717,92 @@ public final class IxgbeDevice extends Device {
 	}
 
 	/**
-	 * Creates a memory pool of the given capacity and packet buffer wrapper size.
+	 * Computes the size of a packet buffer of the RX memory pools for the current MTU.
+	 *
+	 * @return The size of a packet buffer.
+	 * @see #computeRxBufferSize(int, int)
+	 */
+	@Contract(pure = true)
+	private int computeRxBufferSize() {
+		return computeRxBufferSize(mtu, config.getBufferSize());
+	}
+
+	/**
+	 * Computes the size of a packet buffer of the RX memory pools for an MTU.
+	 * <p>
+	 * The configured size is used when the frames fit in a single segment of {@link #rxSegmentKb(int)}, otherwise the
+	 * packet buffers are big enough to split the frames in a few segments. A frame that barely misses the segment of
+	 * the configured size gets a single bigger segment that way, instead of a segment the NIC would fill past the end of
+	 * the packet buffer.
+	 *
+	 * @param mtu        The maximum transmission unit.
+	 * @param bufferSize The configured size of a packet buffer.
+	 * @return The size of a packet buffer.
+	 */
+	@Contract(pure = true)
+	static int computeRxBufferSize(final int mtu, final int bufferSize) {
+		val frameBytes = mtu + FRAME_OVERHEAD + VLAN_OVERHEAD;
+		return frameBytes <= rxSegmentKb(bufferSize) * RX_SEGMENT_GRANULARITY
+				? bufferSize
+				: Math.max(bufferSize, RX_JUMBO_BUFFER_SIZE);
+	}
+
+	/**
+	 * Computes the size of the segments the NIC writes to the packet buffers, the value of {@code SRRCTL.BSIZEPKT}.
+	 * <p>
+	 * The NIC fills every packet buffer up to that size, so it is rounded down to the whole KBs that fit after the
+	 * header of the packet buffer.
 	 *
-	 * @param capacity  The capacity of the queue.
-	 * @param entrySize The number of entries this queue has.
+	 * @param bufferSize The size of a packet buffer.
+	 * @return The size of a segment in KB.
+	 */
+	@Contract(pure = true)
+	static int rxSegmentKb(final int bufferSize) {
+		return (bufferSize - PacketBufferWrapperConstants.PAYLOAD_OFFSET) / RX_SEGMENT_GRANULARITY;
+	}
+
+	/**
+	 * Allocates the packet buffers of a memory pool with the given packet buffer wrapper size.
+	 *
+	 * @param mempool   The memory pool.
+	 * @param entrySize The size of a packet buffer wrapper.
 	 * @return The memory pool.
 	 */
 	@SuppressFBWarnings("ICAST_INTEGER_MULTIPLY_CAST_TO_LONG")
-	private @NotNull Mempool allocateMempool(final int capacity, final int entrySize) {
-		if (mmanager.getHugepageSize() % entrySize != 0) {
+	private @NotNull Mempool allocateMempool(final @NotNull Mempool mempool, final int entrySize) {
+		val capacity = mempool.getCapacity();
+		val bytes = (long) capacity * entrySize;
+		val mempoolArena = selectArena(bytes);
+		if (!mempoolArena.isHuge() || mempoolArena.getGranularity() % entrySize != 0) {
 			throw new IllegalArgumentException("The buffer size of a packet buffer wrapper MUST be"
 					+ " a divisor of the size of a huge memory page.");
 		}
-		val dma = mmanager.dmaAllocate((long) capacity * entrySize, true, true);
-		val mempool = new Mempool(capacity);
-		mempool.allocate(entrySize, dma);
+		val dma = mempoolArena.allocate(bytes, entrySize);
+		mempool.allocate(entrySize, dma, mempoolArena.getGranularity());
 		return mempool;
 	}
 
+	/**
+	 * Selects the DMA arena of a memory pool of the given size.
+	 * <p>
+	 * The biggest huge memory page size that does not exceed the size of the memory pool is used, so big memory pools
+	 * need fewer TLB entries while small ones do not waste a whole huge memory page. Memory pools that fit the default
+	 * huge memory page size share the arena of the descriptor rings.
+	 *
+	 * @param bytes The size of the memory pool.
+	 * @return The DMA arena.
+	 */
+	private @NotNull DmaArena selectArena(final long bytes) {
+		var index = -1;
+		for (var i = 0; i < hugepageSizes.length && hugepageSizes[i] <= bytes; i += 1) index = i;
+		if (index == -1 || hugepageSizes[index] <= arena.getGranularity()) return arena;
+		if (mempoolArenas[index] == null) {
+			if (DEBUG >= LOG_DEBUG) log.debug("Creating DMA arena of {} byte huge memory pages.", hugepageSizes[index]);
+			mempoolArenas[index] = new DmaArena(mmanager, 0, hugepageSizes[index], numaNode);
+		}
+		return mempoolArenas[index];
+	}
+
 	//////////////////////////////////////////////// OVERRIDDEN METHODS ////////////////////////////////////////////////
 
 	/** {@inheritDoc} */
@@ -567,6 +931,28 @@ public final class IxgbeDevice extends Device {
 		mmanager.putIntVolatile(mapResource + offset, value);
 	}
 
+	/**
+	 * Writes a tail register with release semantics.
+	 * <p>
+	 * The tail registers are the doorbells that hand the descriptors over to the NIC, so the only ordering needed is
+	 * that all the previous descriptor writes are visible before the NIC sees the new tail.
+	 *
+	 * @param offset The offset of the tail register.
+	 * @param value  The new value of the tail register.
+	 */
+	@SuppressWarnings("PMD.AvoidLiteralsInIfCondition")
+	private void setTailRegister(final int offset, final int value) {
+		if (!OPTIMIZED) {
+			if (mapResource == 0L) throw new IllegalStateException("the memory MUST be mapped.");
+			if (offset < 0) throw new IllegalArgumentException("The parameter 'offset' MUST NOT be negative.");
+		}
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Writing value 0x{} to tail register @ 0x{} + 0x{}.",
+					leftPad(value), leftPad(mapResource), leftPad(offset));
+		}
+		mmanager.putIntRelease(mapResource + offset, value);
+	}
+
 	/** {@inheritDoc} */
 	@Override
 	public boolean isPromiscuousEnabled() {
@@ -590,6 +976,616 @@ public final class IxgbeDevice extends Device {
 		clearFlags(IxgbeDefs.FCTRL, IxgbeDefs.FCTRL_MPE | IxgbeDefs.FCTRL_UPE);
 	}
 
+	/**
+	 * Returns the maximum transmission unit.
+	 *
+	 * @return The MTU.
+	 */
+	@Contract(pure = true)
+	public int getMtu() {
+		return mtu;
+	}
+
+	/**
+	 * Sets the maximum transmission unit, which is {@link #DEFAULT_MTU} by default.
+	 * <p>
+	 * Bigger MTUs enable jumbo frames, which are received in a chain of packet buffers when they do not fit in a single
+	 * one. The MTU is applied the next time the device is configured, because the size of the packet buffers of the RX
+	 * memory pools depends on it.
+	 *
+	 * @param mtu The MTU.
+	 */
+	public void setMtu(final int mtu) {
+		if (!OPTIMIZED && (mtu < MIN_MTU || mtu > MAX_MTU)) {
+			throw new IllegalArgumentException("The parameter 'mtu' MUST be inside [MIN_MTU, MAX_MTU].");
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Setting MTU to {} bytes.", mtu);
+		this.mtu = mtu;
+	}
+
+	/**
+	 * Checks if the NIC coalesces the TCP segments it receives.
+	 *
+	 * @return Whether Receive Side Coalescing is enabled.
+	 */
+	@Contract(pure = true)
+	public boolean isCoalescing() {
+		return coalescing;
+	}
+
+	/**
+	 * Sets whether the NIC coalesces the TCP segments of the same flow it receives, which is disabled by default.
+	 * <p>
+	 * Receive Side Coalescing merges consecutive segments of a TCP flow into a single packet of up to 64 KB stored in a
+	 * chain of packet buffers, so the application handles one packet instead of dozens. The setting is applied the next
+	 * time the device is configured. The coalesced packets are reassembled in Java even when the {@code native} batches
+	 * are preferred, because their segments do not use consecutive descriptors.
+	 *
+	 * @param coalescing Whether the segments are coalesced.
+	 */
+	public void setCoalescing(final boolean coalescing) {
+		if (DEBUG >= LOG_DEBUG) log.debug("{} Receive Side Coalescing.", coalescing ? "Enabling" : "Disabling");
+		this.coalescing = coalescing;
+	}
+
+	/**
+	 * Returns the number of packets coalesced by RSC that an RX queue received since it was configured.
+	 *
+	 * @param queueId The queue id.
+	 * @return The number of coalesced packets.
+	 */
+	public long getCoalescedPackets(final int queueId) {
+		if (!OPTIMIZED && (queueId < 0 || queueId >= rxQueues.length)) {
+			throw new ArrayIndexOutOfBoundsException("The parameter 'queueId' MUST be in the range [0, rxQueues).");
+		}
+		return rxQueues[queueId].coalescedPackets;
+	}
+
+	/**
+	 * Returns the number of TCP segments RSC coalesced into the packets an RX queue received since it was configured.
+	 * <p>
+	 * Dividing it by {@link #getCoalescedPackets(int)} gives the average number of segments per coalesced packet.
+	 *
+	 * @param queueId The queue id.
+	 * @return The number of coalesced segments.
+	 */
+	public long getCoalescedSegments(final int queueId) {
+		if (!OPTIMIZED && (queueId < 0 || queueId >= rxQueues.length)) {
+			throw new ArrayIndexOutOfBoundsException("The parameter 'queueId' MUST be in the range [0, rxQueues).");
+		}
+		return rxQueues[queueId].coalescedSegments;
+	}
+
+	/**
+	 * Creates a single-threaded memory pool that other devices can share with this one.
+	 * <p>
+	 * The memory pool is placed on the NUMA node of this device, so one memory pool per NUMA node can be shared by all
+	 * the devices attached to it. The packet buffers are sized for the current MTU and the configured buffer size. A
+	 * single-threaded memory pool can only be shared by queues that are polled by the same thread.
+	 *
+	 * @param capacity The capacity of the memory pool.
+	 * @return The memory pool.
+	 * @see #setMempool(Mempool)
+	 */
+	public @NotNull Mempool createMempool(final int capacity) {
+		if (!OPTIMIZED && capacity <= 0) {
+			throw new IllegalArgumentException("The parameter 'capacity' MUST be positive.");
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Creating shared memory pool of {} packet buffers.", capacity);
+		return allocateMempool(new Mempool(capacity), computeRxBufferSize());
+	}
+
+	/**
+	 * Creates a concurrent memory pool that other devices can share with this one.
+	 * <p>
+	 * The memory pool is placed on the NUMA node of this device and its packet buffers are sized for the current MTU
+	 * and the configured buffer size, like the ones of {@link #createMempool(int)}, but it can be shared by queues that
+	 * are polled by different threads.
+	 *
+	 * @param capacity  The capacity of the memory pool.
+	 * @param cacheSize The size of the per-thread caches, {@code 0} to disable them.
+	 * @return The memory pool.
+	 * @see #setMempool(Mempool)
+	 */
+	public @NotNull Mempool createMempool(final int capacity, final int cacheSize) {
+		if (!OPTIMIZED && capacity <= 0) {
+			throw new IllegalArgumentException("The parameter 'capacity' MUST be positive.");
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Creating shared concurrent memory pool of {} packet buffers.", capacity);
+		return allocateMempool(new Mempool(capacity, cacheSize), computeRxBufferSize());
+	}
+
+	/**
+	 * Returns the memory pool shared by all the RX queues.
+	 *
+	 * @return The shared memory pool, or {@code null} if every RX queue allocates its own.
+	 */
+	@Contract(pure = true)
+	public @Nullable Mempool getMempool() {
+		return mempool;
+	}
+
+	/**
+	 * Sets the memory pool shared by all the RX queues, which is {@code null} by default so every RX queue allocates
+	 * its own.
+	 * <p>
+	 * Sharing a memory pool among queues and devices bounds the memory used for packet buffers, which otherwise grows
+	 * with the number of queues even if most of them are idle. The descriptor rings of this device reserve as many
+	 * packet buffers as they can hold, so the memory pool must be big enough to fill all the descriptor rings of all
+	 * the devices that use it. The memory pool is used the next time the device is configured, and its packet buffers
+	 * must fit the frames of the MTU.
+	 * <p>
+	 * The packet buffers held by the per-thread caches of a concurrent memory pool cannot fill any descriptor ring, so
+	 * every RX queue also reserves {@code 2 * cacheSize} packet buffers, assuming it is polled by its own thread. Queues
+	 * polled by the same thread share a single cache, which makes the reservation conservative.
+	 *
+	 * @param mempool The shared memory pool, or {@code null} to allocate one per RX queue.
+	 * @throws IllegalStateException If the memory pool cannot fill the descriptor rings.
+	 */
+	public void setMempool(final @Nullable Mempool mempool) {
+		if (mempool == this.mempool) return;
+		if (mempool != null) {
+			val demand = demand(mempool);
+			if (DEBUG >= LOG_DEBUG) log.debug("Sharing memory pool {} for {} descriptors.", mempool.getId(), demand);
+			mempool.reserve(demand);
+		}
+		if (this.mempool != null) this.mempool.release(demand(this.mempool));
+		this.mempool = mempool;
+	}
+
+	/**
+	 * Computes the number of packet buffers this device reserves from a shared memory pool.
+	 *
+	 * @param mempool The shared memory pool.
+	 * @return The descriptors of all the rings plus the per-thread cache headroom of every RX queue.
+	 */
+	@Contract(pure = true)
+	private int demand(final @NotNull Mempool mempool) {
+		val rings = rxQueues.length * config.getRxEntries() + txQueues.length * config.getTxEntries();
+		return rings + rxQueues.length * 2 * mempool.getCacheSize();
+	}
+
+	/**
+	 * Returns the RSS hash types, which select the packets whose headers are hashed to choose their RX queue.
+	 *
+	 * @return A combination of the {@code RSS_*} hash types, or {@code 0} if RSS is disabled.
+	 */
+	@Contract(pure = true)
+	public int getRssHashTypes() {
+		return rssHashTypes;
+	}
+
+	/**
+	 * Sets the RSS hash types, which select the packets whose headers are hashed to choose their RX queue.
+	 * <p>
+	 * The packets that are not hashed are received by the queue {@code 0}. RSS is enabled by default with {@link
+	 * #RSS_DEFAULT} when the device has more than one RX queue.
+	 *
+	 * @param types A combination of the {@code RSS_*} hash types, or {@code 0} to disable RSS.
+	 */
+	public void setRssHashTypes(final int types) {
+		if (!OPTIMIZED && (types & ~RSS_ALL) != 0) {
+			throw new IllegalArgumentException("The parameter 'types' MUST be a combination of the RSS hash types.");
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Setting RSS hash types 0x{}.", leftPad(types));
+		rssHashTypes = types;
+		writeRssHashTypes();
+	}
+
+	/**
+	 * Returns a copy of the RSS key.
+	 *
+	 * @return The RSS key.
+	 */
+	@Contract(value = " -> new", pure = true)
+	public @NotNull byte[] getRssKey() {
+		return rssKey.clone();
+	}
+
+	/**
+	 * Sets the RSS key, which is {@link Toeplitz#getDefaultKey()} by default.
+	 *
+	 * @param key The RSS key.
+	 */
+	public void setRssKey(final @NotNull byte[] key) {
+		if (!OPTIMIZED) {
+			if (key == null) throw new NullPointerException("The parameter 'key' MUST NOT be null.");
+			if (key.length != Toeplitz.KEY_BYTES) {
+				throw new IllegalArgumentException("The parameter 'key' MUST have 40 bytes.");
+			}
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Setting RSS key.");
+		System.arraycopy(key, 0, rssKey, 0, Toeplitz.KEY_BYTES);
+		for (var i = 0; i < Toeplitz.KEY_BYTES / Integer.BYTES; i += 1) writeRssKey(i);
+	}
+
+	/**
+	 * Returns a copy of the RSS redirection table.
+	 *
+	 * @return The RSS redirection table.
+	 */
+	@Contract(value = " -> new", pure = true)
+	public @NotNull byte[] getRedirectionTable() {
+		return redirectionTable.clone();
+	}
+
+	/**
+	 * Sets the RSS redirection table, which maps the 7 least significant bits of the RSS hash to an RX queue.
+	 * <p>
+	 * The table can be rebalanced while the device is receiving packets; only the registers whose entries changed are
+	 * written. By default the entries are distributed round-robin among the first {@link #RSS_MAX_QUEUES} RX queues.
+	 *
+	 * @param table The RSS redirection table.
+	 */
+	public void setRedirectionTable(final @NotNull byte[] table) {
+		if (!OPTIMIZED) {
+			if (table == null) throw new NullPointerException("The parameter 'table' MUST NOT be null.");
+			if (table.length != RETA_ENTRIES) {
+				throw new IllegalArgumentException("The parameter 'table' MUST have 128 entries.");
+			}
+			for (val queue : table) checkRssQueue(queue);
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Setting RSS redirection table.");
+		for (var i = 0; i < RETA_ENTRIES; i += Integer.BYTES) {
+			var changed = false;
+			for (var j = i; j < i + Integer.BYTES; j += 1) {
+				changed |= redirectionTable[j] != table[j];
+				redirectionTable[j] = table[j];
+			}
+			if (changed) writeRedirectionTable(i / Integer.BYTES);
+		}
+	}
+
+	/**
+	 * Sets a single entry of the RSS redirection table.
+	 *
+	 * @param index The index of the entry.
+	 * @param queue The RX queue.
+	 */
+	public void setRedirectionEntry(final int index, final int queue) {
+		if (!OPTIMIZED) {
+			if (index < 0 || index >= RETA_ENTRIES) {
+				throw new IllegalArgumentException("The parameter 'index' MUST be inside [0, 128).");
+			}
+			checkRssQueue(queue);
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Redirecting RSS entry {} to RX queue {}.", index, queue);
+		redirectionTable[index] = (byte) queue;
+		writeRedirectionTable(index / Integer.BYTES);
+	}
+
+	/**
+	 * Returns the RX queue that receives the packets with a given RSS hash.
+	 * <p>
+	 * Combined with {@link Toeplitz} and {@link #getRssKey()}, this predicts the RX queue of a flow.
+	 *
+	 * @param hash The RSS hash.
+	 * @return The RX queue.
+	 */
+	@Contract(pure = true)
+	public int getRssQueue(final int hash) {
+		return redirectionTable[hash & (RETA_ENTRIES - 1)];
+	}
+
+	/** Writes the RSS hash types to the device. */
+	private void writeRssHashTypes() {
+		setRegister(IxgbeDefs.MRQC, rssHashTypes == 0 ? 0 : IxgbeDefs.MRQC_RSSEN | rssHashTypes);
+	}
+
+	/**
+	 * Writes a group of four bytes of the RSS key to the device, the first one in the least significant byte.
+	 *
+	 * @param group The group of bytes.
+	 */
+	private void writeRssKey(final int group) {
+		val base = group * Integer.BYTES;
+		var value = 0;
+		for (var i = Integer.BYTES - 1; i >= 0; i -= 1) value = value << Byte.SIZE | rssKey[base + i] & 0xFF;
+		setRegister(IxgbeDefs.RSSRK(group), value);
+	}
+
+	/**
+	 * Writes a group of four entries of the RSS redirection table to the device, the first one in the least significant
+	 * byte.
+	 *
+	 * @param group The group of entries.
+	 */
+	private void writeRedirectionTable(final int group) {
+		val base = group * Integer.BYTES;
+		var value = 0;
+		for (var i = Integer.BYTES - 1; i >= 0; i -= 1) value = value << Byte.SIZE | redirectionTable[base + i] & 0xFF;
+		setRegister(IxgbeDefs.RETA(group), value);
+	}
+
+	/**
+	 * Checks that an RX queue can be stored in the RSS redirection table.
+	 *
+	 * @param queue The RX queue.
+	 */
+	private void checkRssQueue(final int queue) {
+		if (queue < 0 || queue >= Math.min(rxQueues.length, RSS_MAX_QUEUES)) {
+			throw new IllegalArgumentException("The RSS redirection table entries MUST be valid RX queues below 16.");
+		}
+	}
+
+	/**
+	 * Enables the Flow Director, which steers the IPv4 TCP and UDP flows that match a filter to a given RX queue
+	 * regardless of RSS.
+	 * <p>
+	 * Perfect-match filters compare the whole 5-tuple, while signature filters only compare a hash of it and may steer
+	 * a colliding flow too, but four times as many fit in the table. The mode cannot be changed until the device is
+	 * configured again; enabling the Flow Director again in the same mode removes all the filters.
+	 *
+	 * @param perfect Whether to use perfect-match filters instead of signature filters.
+	 */
+	public void enableFlowDirector(final boolean perfect) {
+		if (!OPTIMIZED && fdirFilters != null && fdirPerfect != perfect) {
+			throw new IllegalStateException("The Flow Director mode MUST NOT change until the device is configured.");
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Enabling Flow Director with {} filters.", perfect ? "perfect" : "signature");
+		val fdirctrl = IxgbeDefs.FDIRCTRL_PBALLOC_64K
+				| (perfect ? IxgbeDefs.FDIRCTRL_PERFECT_MATCH : 0)
+				| 0x6 << IxgbeDefs.FDIRCTRL_FLEX_SHIFT
+				| 0xA << IxgbeDefs.FDIRCTRL_MAX_LENGTH_SHIFT
+				| 0x4 << IxgbeDefs.FDIRCTRL_FULL_THRESH_SHIFT;
+		if (fdirFilters == null) {
+			if (DEBUG >= LOG_TRACE) log.trace("Matching the addresses, ports and L4 type only.");
+			setRegister(IxgbeDefs.FDIRM, IxgbeDefs.FDIRM_VLANID | IxgbeDefs.FDIRM_VLANP | IxgbeDefs.FDIRM_POOL
+					| IxgbeDefs.FDIRM_FLEX);
+			setRegister(IxgbeDefs.FDIRSIP4M, 0);
+			setRegister(IxgbeDefs.FDIRDIP4M, 0);
+			setRegister(IxgbeDefs.FDIRTCPM, 0);
+			setRegister(IxgbeDefs.FDIRUDPM, 0);
+			setRegister(IxgbeDefs.FDIRHKEY, IxgbeDefs.ATR_BUCKET_HASH_KEY);
+			setRegister(IxgbeDefs.FDIRSKEY, IxgbeDefs.ATR_SIGNATURE_HASH_KEY);
+		} else {
+			// The initialization cannot be restarted unless the hash table is cleared first (82599 errata)
+			if (DEBUG >= LOG_TRACE) log.trace("Clearing the Flow Director table.");
+			waitFlowDirectorCommand();
+			setFlags(IxgbeDefs.FDIRCMD, IxgbeDefs.FDIRCMD_CLEARHT);
+			clearFlags(IxgbeDefs.FDIRCMD, IxgbeDefs.FDIRCMD_CLEARHT);
+			setRegister(IxgbeDefs.FDIRHASH, 0);
+		}
+		setRegister(IxgbeDefs.FDIRCTRL, fdirctrl);
+		waitSetFlags(IxgbeDefs.FDIRCTRL, IxgbeDefs.FDIRCTRL_INIT_DONE);
+
+		// The statistics are cleared when they are read
+		getRegister(IxgbeDefs.FDIRMATCH);
+		getRegister(IxgbeDefs.FDIRMISS);
+		fdirMatches = 0;
+		fdirMisses = 0;
+		fdirPerfect = perfect;
+		fdirFilters = new long[perfect ? FDIR_PERFECT_CAPACITY : FDIR_SIGNATURE_CAPACITY];
+		Arrays.fill(fdirFilters, -1);
+	}
+
+	/**
+	 * Adds a Flow Director filter that steers an IPv4 flow to an RX queue.
+	 * <p>
+	 * The addresses and ports are the ones of the received packets, in host byte order.
+	 *
+	 * @param id              The id of the filter, which must be inside [0, {@link #getFlowDirectorCapacity()}).
+	 * @param protocol        The L4 protocol, either {@link Checksums#PROTOCOL_TCP} or {@link Checksums#PROTOCOL_UDP}.
+	 * @param source          The source address.
+	 * @param destination     The destination address.
+	 * @param sourcePort      The source port.
+	 * @param destinationPort The destination port.
+	 * @param queue           The RX queue.
+	 */
+	@SuppressWarnings("PMD.ExcessiveParameterList")
+	public void addFlowDirectorFilter(final int id, final int protocol, final int source, final int destination,
+									  final int sourcePort, final int destinationPort, final int queue) {
+		if (!OPTIMIZED) {
+			checkFlowDirectorId(id);
+			if (fdirFilters[id] != -1) throw new IllegalArgumentException("The parameter 'id' MUST be free.");
+			if (protocol != Checksums.PROTOCOL_TCP && protocol != Checksums.PROTOCOL_UDP) {
+				throw new IllegalArgumentException("The parameter 'protocol' MUST be TCP or UDP.");
+			}
+			if (queue < 0 || queue >= rxQueues.length) {
+				throw new IllegalArgumentException("The parameter 'queue' MUST be inside [0, rxQueues).");
+			}
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Adding Flow Director filter {} to RX queue {}.", id, queue);
+		val flowType = protocol == Checksums.PROTOCOL_TCP
+				? IxgbeDefs.ATR_FLOW_TYPE_TCPV4
+				: IxgbeDefs.ATR_FLOW_TYPE_UDPV4;
+		val ports = (sourcePort & 0xFFFF) << Short.SIZE | destinationPort & 0xFFFF;
+		val common = source ^ destination ^ ports;
+		final int fdirhash;
+		if (fdirPerfect) {
+			fdirhash = fdirPerfectHash(flowType, common) | id << IxgbeDefs.FDIRHASH_SIG_SW_INDEX_SHIFT;
+			for (var i = 0; i < 3; i += 1) setRegister(IxgbeDefs.FDIRSIPv6(i), 0);
+			setRegister(IxgbeDefs.FDIRIPSA, fdirAddress(source));
+			setRegister(IxgbeDefs.FDIRIPDA, fdirAddress(destination));
+			setRegister(IxgbeDefs.FDIRPORT, fdirPorts(sourcePort, destinationPort));
+			setRegister(IxgbeDefs.FDIRVLAN, 0);
+		} else {
+			fdirhash = fdirSignatureHash(flowType, common);
+		}
+		setRegister(IxgbeDefs.FDIRHASH, fdirhash);
+		setRegister(IxgbeDefs.FDIRCMD, IxgbeDefs.FDIRCMD_CMD_ADD_FLOW
+				| IxgbeDefs.FDIRCMD_FILTER_UPDATE
+				| IxgbeDefs.FDIRCMD_LAST
+				| IxgbeDefs.FDIRCMD_QUEUE_EN
+				| flowType << IxgbeDefs.FDIRCMD_FLOW_TYPE_SHIFT
+				| queue << IxgbeDefs.FDIRCMD_RX_QUEUE_SHIFT);
+		waitFlowDirectorCommand();
+		fdirFilters[id] = (long) flowType << Integer.SIZE | fdirhash & 0xFFFFFFFFL;
+	}
+
+	/**
+	 * Removes a Flow Director filter.
+	 *
+	 * @param id The id of the filter.
+	 */
+	public void removeFlowDirectorFilter(final int id) {
+		if (!OPTIMIZED) {
+			checkFlowDirectorId(id);
+			if (fdirFilters[id] == -1) throw new IllegalArgumentException("The parameter 'id' MUST be in use.");
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Removing Flow Director filter {}.", id);
+		val filter = fdirFilters[id];
+		val fdirhash = (int) filter;
+		val flowType = (int) (filter >>> Integer.SIZE) << IxgbeDefs.FDIRCMD_FLOW_TYPE_SHIFT;
+		setRegister(IxgbeDefs.FDIRHASH, fdirhash);
+		setRegister(IxgbeDefs.FDIRCMD, IxgbeDefs.FDIRCMD_CMD_QUERY_REM_FILT | flowType);
+		if ((waitFlowDirectorCommand() & IxgbeDefs.FDIRCMD_FILTER_VALID) != 0) {
+			setRegister(IxgbeDefs.FDIRHASH, fdirhash);
+			setRegister(IxgbeDefs.FDIRCMD, IxgbeDefs.FDIRCMD_CMD_REMOVE_FLOW | flowType);
+			waitFlowDirectorCommand();
+		} else if (DEBUG >= LOG_WARN) {
+			log.warn("The Flow Director filter {} was not found in the table.", id);
+		}
+		fdirFilters[id] = -1;
+	}
+
+	/**
+	 * Returns the number of Flow Director filters that fit in the table.
+	 *
+	 * @return The capacity of the table, or {@code 0} if the Flow Director is disabled.
+	 */
+	@Contract(pure = true)
+	public int getFlowDirectorCapacity() {
+		return fdirFilters == null ? 0 : fdirFilters.length;
+	}
+
+	/**
+	 * Returns the number of Flow Director filters that can still be added, as reported by the device.
+	 * <p>
+	 * Signature filters whose hashes collide share the same slot, so this can differ from the number of free ids.
+	 *
+	 * @return The number of free filters, or {@code 0} if the Flow Director is disabled.
+	 */
+	public int getFlowDirectorFree() {
+		return fdirFilters == null ? 0 : getRegister(IxgbeDefs.FDIRFREE) & IxgbeDefs.FDIRFREE_FREE_MASK;
+	}
+
+	/**
+	 * Returns the number of packets that matched a Flow Director filter since it was enabled.
+	 *
+	 * @return The number of hits.
+	 */
+	public long getFlowDirectorMatches() {
+		fdirMatches += Integer.toUnsignedLong(getRegister(IxgbeDefs.FDIRMATCH));
+		return fdirMatches;
+	}
+
+	/**
+	 * Returns the number of packets that did not match any Flow Director filter since it was enabled.
+	 *
+	 * @return The number of misses.
+	 */
+	public long getFlowDirectorMisses() {
+		fdirMisses += Integer.toUnsignedLong(getRegister(IxgbeDefs.FDIRMISS));
+		return fdirMisses;
+	}
+
+	/**
+	 * Checks that the Flow Director is enabled and that a filter id is inside the table.
+	 *
+	 * @param id The id of the filter.
+	 */
+	private void checkFlowDirectorId(final int id) {
+		if (fdirFilters == null) throw new IllegalStateException("The Flow Director MUST be enabled.");
+		if (id < 0 || id >= fdirFilters.length) {
+			throw new IllegalArgumentException("The parameter 'id' MUST be inside [0, capacity).");
+		}
+	}
+
+	/**
+	 * Spins until the device finishes processing the last Flow Director command, which takes a few microseconds.
+	 *
+	 * @return The final value of the {@code FDIRCMD} register.
+	 */
+	private int waitFlowDirectorCommand() {
+		var fdircmd = getRegister(IxgbeDefs.FDIRCMD);
+		while ((fdircmd & IxgbeDefs.FDIRCMD_CMD_MASK) != 0) {
+			Thread.onSpinWait();
+			fdircmd = getRegister(IxgbeDefs.FDIRCMD);
+		}
+		return fdircmd;
+	}
+
+	/**
+	 * Computes the value of the {@code FDIRIPSA} or {@code FDIRIPDA} register of a perfect-match filter.
+	 * <p>
+	 * The device compares these registers against the addresses as they appear in the packet, so they are written in
+	 * network byte order, like the Linux driver does with {@code IXGBE_WRITE_REG_BE32}.
+	 *
+	 * @param address The address in host byte order.
+	 * @return The value of the register.
+	 */
+	@Contract(pure = true)
+	static int fdirAddress(final int address) {
+		return Integer.reverseBytes(address);
+	}
+
+	/**
+	 * Computes the value of the {@code FDIRPORT} register of a perfect-match filter, which takes the ports in host
+	 * byte order.
+	 *
+	 * @param sourcePort      The source port.
+	 * @param destinationPort The destination port.
+	 * @return The value of the register.
+	 */
+	@Contract(pure = true)
+	static int fdirPorts(final int sourcePort, final int destinationPort) {
+		return (destinationPort & 0xFFFF) << IxgbeDefs.FDIRPORT_DESTINATION_SHIFT | sourcePort & 0xFFFF;
+	}
+
+	/**
+	 * Computes the bucket hash of a perfect-match filter the same way the device does.
+	 * <p>
+	 * The VM pool, the VLAN and the flexible bytes are masked, so the flow type is the only extra input.
+	 *
+	 * @param flowType The flow type.
+	 * @param common   The XOR of the addresses and the ports.
+	 * @return The bucket hash.
+	 */
+	@Contract(pure = true)
+	static int fdirPerfectHash(final int flowType, final int common) {
+		val flowVmVlan = flowType << Short.SIZE;
+		val hi = common ^ flowVmVlan ^ flowVmVlan >>> Short.SIZE;
+		var lo = common >>> Short.SIZE | common << Short.SIZE;
+		var bucket = 0;
+		for (var n = 0; n < Short.SIZE; n += 1) {
+			// The flow type is not applied to the low word until the bit 0 has been processed
+			if (n == 1) lo ^= flowVmVlan ^ flowVmVlan << Short.SIZE;
+			if ((IxgbeDefs.ATR_BUCKET_HASH_KEY & 1 << n) != 0) bucket ^= lo >>> n;
+			if ((IxgbeDefs.ATR_BUCKET_HASH_KEY & 1 << n + Short.SIZE) != 0) bucket ^= hi >>> n;
+		}
+		return bucket & FDIR_PERFECT_HASH_MASK;
+	}
+
+	/**
+	 * Computes the signature and bucket hashes of a signature filter the same way the device does.
+	 *
+	 * @param flowType The flow type.
+	 * @param common   The XOR of the addresses and the ports.
+	 * @return The signature hash in the upper 16 bits and the bucket hash in the lower 16 bits.
+	 */
+	@Contract(pure = true)
+	static int fdirSignatureHash(final int flowType, final int common) {
+		val flowVmVlan = flowType << Short.SIZE;
+		val hi = common ^ flowVmVlan ^ flowVmVlan >>> Short.SIZE;
+		var lo = common >>> Short.SIZE | common << Short.SIZE;
+		var shared = 0;
+		var bucket = 0;
+		var signature = 0;
+		for (var n = 0; n < Short.SIZE; n += 1) {
+			if (n == 1) lo ^= flowVmVlan ^ flowVmVlan << Short.SIZE;
+			if ((IxgbeDefs.ATR_COMMON_HASH_KEY & 1 << n) != 0) shared ^= lo >>> n;
+			else if ((IxgbeDefs.ATR_BUCKET_HASH_KEY & 1 << n) != 0) bucket ^= lo >>> n;
+			else if ((IxgbeDefs.ATR_SIGNATURE_HASH_KEY & 1 << n) != 0) signature ^= lo << Short.SIZE - n;
+			if ((IxgbeDefs.ATR_COMMON_HASH_KEY & 1 << n + Short.SIZE) != 0) shared ^= hi >>> n;
+			else if ((IxgbeDefs.ATR_BUCKET_HASH_KEY & 1 << n + Short.SIZE) != 0) bucket ^= hi >>> n;
+			else if ((IxgbeDefs.ATR_SIGNATURE_HASH_KEY & 1 << n + Short.SIZE) != 0) signature ^= hi << Short.SIZE - n;
+		}
+		bucket = (bucket ^ shared) & FDIR_SIGNATURE_HASH_MASK;
+		signature = (signature ^ shared << Short.SIZE) & FDIR_SIGNATURE_HASH_MASK << Short.SIZE;
+		return signature | bucket;
+	}
+
 	/** {@inheritDoc} */
 	@Override
 	public long getLinkSpeed() {
@@ -641,6 +1637,12 @@ public final class IxgbeDevice extends Device {
 			if (length == 0) return 0;
 		}
 
+		// Coalesced packets do not use consecutive descriptors, so they are reassembled following the writeback
+		if (rxQueues[queueId].chains != null) return rxBatchCoalesced(queueId, buffers, offset, length);
+
+		// Let the native library process the whole batch if we are allowed to use it
+		if (MEMORY_MANAGER == PREFER_JNI_FULL) return rxBatchNative(queueId, buffers, offset, length);
+
 		// Prepare for the loop
 		val queue = rxQueues[queueId];
 		var rxIndex = queue.index;
@@ -658,36 +1660,56 @@ public final class IxgbeDevice extends Device {
 			// If we don't have packets, stop processing
 			if ((status & IxgbeDefs.RXDADV_STAT_DD) == 0) break;
 
-			// If there is no End of Packet, we need to stop, because we haven't implemented multi-segment packets
+			// If there is no End of Packet, the packet spans several descriptors and only the last one has its metadata
+			var segments = 1;
+			var lastAddr = descAddr;
+			var lastStatus = status;
 			if ((status & IxgbeDefs.RXDADV_STAT_EOP) == 0) {
-				throw new UnsupportedOperationException("Multisegment pkts. NOT supported; incr. buffer or decr. MTU.");
+				segments = queue.countSegments(rxIndex);
+				if (segments == 0) break;
+				lastAddr = queue.getDescriptorAddress((rxIndex + segments - 1) & (queue.capacity - 1));
+				lastStatus = queue.getWritebackErrorStatus(lastAddr);
 			}
 
-			// There is a packet, read and copy the whole descriptor
-			val packetBuffer = new PacketBufferWrapper(queue.buffers[rxIndex]);
-			packetBuffer.setSize(queue.getWritebackLength(descAddr));
-
-			// This would be the place to implement RX offloading by translating the device-specific
-			// flags to an independent representation in that buffer (similar to how DPDK works)
-			val newBuf = queue.mempool.pop();
-			if (newBuf == null) {
-				throw new OutOfMemoryError("Failed to allocate buffer for RX; memory leaking or small memory pool.");
+			// There is a packet, reuse its wrapper
+			val packetBuffer = queue.mempool.wrap(queue.buffers[rxIndex]);
+			packetBuffer.setOffload(0);
+			packetBuffer.setSegments(segments);
+
+			// Translate the device-specific writeback to an independent representation (similar to how DPDK works)
+			packetBuffer.setRxFlags(IxgbeRxQueue.getRxFlags(queue.getWritebackPacketInfo(lastAddr), lastStatus));
+			packetBuffer.setRssHash(queue.getWritebackRssHash(lastAddr));
+			packetBuffer.setVlanTag(queue.getWritebackVlanTag(lastAddr));
+
+			// Link the segments and register new packet buffers in their descriptors
+			var segment = packetBuffer;
+			for (var i = 1; ; i += 1) {
+				val segmentAddr = queue.getDescriptorAddress(rxIndex);
+				segment.setSize(queue.getWritebackLength(segmentAddr));
+				val newBuf = queue.mempool.pop();
+				if (newBuf == null) {
+					throw new OutOfMemoryError("Failed to allocate buffer for RX; memory leaking or small memory pool.");
+				}
+				queue.setPacketBufferAddress(segmentAddr,
+						newBuf.getPhysicalAddress() + PacketBufferWrapperConstants.PAYLOAD_OFFSET);
+				queue.setPacketBufferHeaderAddress(segmentAddr, 0);
+				queue.buffers[rxIndex] = newBuf.getVirtualAddress();
+
+				// Want to read the next one in the next iteration but we still need the current one to update RDT later
+				lastRxIndex = rxIndex;
+				rxIndex = wrapRing(rxIndex, queue.capacity);
+				if (i == segments) break;
+				val next = queue.mempool.wrap(queue.buffers[rxIndex]);
+				segment.setNext(next.getVirtualAddress());
+				segment = next;
 			}
-
-			// Register the packet in the RX queue
-			queue.setPacketBufferAddress(descAddr, newBuf.getPhysicalAddress() + PacketBufferWrapperConstants.PAYLOAD_OFFSET);
-			queue.setPacketBufferHeaderAddress(descAddr, 0);
-			queue.buffers[rxIndex] = newBuf.getVirtualAddress();
+			segment.setNext(0);
 			buffers[bufInd] = packetBuffer;
-
-			// Want to read the next one in the next iteration but we still need the current one to update RDT later
-			lastRxIndex = rxIndex;
-			rxIndex = wrapRing(rxIndex, queue.capacity);
 		}
 
 		// Notify the hardware that we are done
 		if (rxIndex != lastRxIndex) {
-			setRegister(IxgbeDefs.RDT(queueId), lastRxIndex);
+			setTailRegister(IxgbeDefs.RDT(queueId), lastRxIndex);
 			queue.index = rxIndex;
 		}
 
@@ -717,12 +1739,14 @@ public final class IxgbeDevice extends Device {
 				length = diff;
 			}
 			if (length == 0) return 0;
+			for (var i = offset; i < offset + length; i += 1) checkTxPacket(buffers[i]);
 		}
 
 		// Prepare for the loop
 		val queue = txQueues[queueId];
 		var cleanIndex = queue.cleanIndex;
 		var currentIndex = queue.index;
+		val cleanBatch = config.getTxCleanBatch();
 		val cmdTypeFlags = IxgbeDefs.ADVTXD_DCMD_EOP | IxgbeDefs.ADVTXD_DCMD_RS | IxgbeDefs.ADVTXD_DCMD_IFCS | IxgbeDefs.ADVTXD_DCMD_DEXT | IxgbeDefs.ADVTXD_DTYP_DATA;
 
 		// All packet buffers that will be handled here will belong to the same mempool
@@ -736,13 +1760,16 @@ public final class IxgbeDevice extends Device {
 			// Invariant: currentIndex is always ahead of clean, therefore we can calculate how many packets to clean
 			var cleanable = currentIndex - cleanIndex;
 			if (cleanable < 0) cleanable = queue.capacity + cleanable;
-			if (cleanable < TX_CLEAN_BATCH) break;
+			if (cleanable < cleanBatch) break;
 
 			// Calculate the index of the last descriptor in the clean batch
 			// We can't check all descriptors for performance reasons
-			var cleanupTo = cleanIndex + TX_CLEAN_BATCH - 1;
+			var cleanupTo = cleanIndex + cleanBatch - 1;
 			if (cleanupTo >= queue.capacity) cleanupTo -= queue.capacity;
 
+			// Only the last descriptor of a packet has its status written back, so check that one instead
+			cleanupTo = queue.getPacketEnd(cleanupTo);
+
 			// Get the descriptor and its status
 			val descAddr = queue.getDescriptorAddress(cleanupTo);
 			val status = queue.getOffloadInfoStatus(descAddr);
@@ -753,12 +1780,14 @@ public final class IxgbeDevice extends Device {
 			var i = cleanIndex;
 			while (true) {
 				val packetBuffer = cleanablePool[queueId][i];
-				if (pool == null) {
-					pool = Mempool.find(packetBuffer);
-					if (pool == null) throw new IllegalStateException("Could NOT find mempool with the given id.");
+				if (packetBuffer != null) {
+					if (pool == null) {
+						pool = Mempool.find(packetBuffer);
+						if (pool == null) throw new IllegalStateException("Could NOT find mempool with the given id.");
+					}
+					pool.push(packetBuffer);
+					cleanablePool[queueId][i] = null;
 				}
-				pool.push(packetBuffer);
-				cleanablePool[queueId][i] = null;
 				if (i == cleanupTo) break;
 				i = wrapRing(i, queue.capacity);
 			}
@@ -770,43 +1799,75 @@ public final class IxgbeDevice extends Device {
 		// Update the clean index
 		queue.cleanIndex = cleanIndex;
 
+		// Let the native library write the whole batch if we are allowed to use it
+		if (MEMORY_MANAGER == PREFER_JNI_FULL) {
+			return txBatchNative(queueId, buffers, offset, length, cmdTypeFlags);
+		}
+
 		// Step 2: Send out as many of our packets as possible
 		var sent = offset;
 		val max = offset + length;
 		for (; sent < max; sent += 1) {
 			// Get next descriptor index
-			val nextIndex = wrapRing(currentIndex, queue.capacity);
+			var nextIndex = wrapRing(currentIndex, queue.capacity);
 
 			// We are full if the next index is the one we are trying to reclaim
 			if (cleanIndex == nextIndex) break;
 
-			// Get the packet buffer, remove it from the original array and cache it for cleaning purposes
-			var buffer = buffers[sent];
+			// Program the offloads in a context descriptor only when they differ from the ones of the last packet
+			val buffer = buffers[sent];
+			val offload = buffer.getOffload();
+			val mss = (offload & PacketBufferWrapperConstants.OFL_TSO) != 0 ? buffer.getMss() : 0;
+			val context = queue.needsContext(offload, mss);
+
+			// Packets stored in a chain of packet buffers need a data descriptor for every segment, and all of them must
+			// fit in the ring because the NIC only starts sending a packet once it has all its descriptors
+			val segments = buffer.getSegments();
+			if (segments > 1) {
+				val free = (cleanIndex - currentIndex - 1) & (queue.capacity - 1);
+				if (free < (context ? segments + 1 : segments)) break;
+			}
+			if (context) {
+				val dataIndex = wrapRing(nextIndex, queue.capacity);
+				if (cleanIndex == dataIndex) break;
+				cleanablePool[queueId][currentIndex] = null;
+				queue.buffers[currentIndex] = 0;
+				queue.setContext(queue.getDescriptorAddress(currentIndex), offload, mss);
+				currentIndex = nextIndex;
+				nextIndex = dataIndex;
+			}
+			val flags = cmdTypeFlags | IxgbeTxQueue.getOffloadCommand(offload);
+			if (segments > 1) {
+				buffers[sent] = null;
+				currentIndex = txChain(queueId, currentIndex, buffer, segments, flags);
+				continue;
+			}
+
+			// Remove the packet buffer from the original array and cache it for cleaning purposes
 			buffers[sent] = null;
 			cleanablePool[queueId][currentIndex] = buffer;
 
 			// Remember the virtual address to clean it up later
 			queue.buffers[currentIndex] = buffer.getVirtualAddress();
-			queue.index = wrapRing(queue.index, queue.capacity);
 
 			// NIC will read the data from here
 			val descAddr = queue.getDescriptorAddress(currentIndex);
 			queue.setPacketBufferAddress(descAddr, buffer.getPhysicalAddress() + PacketBufferWrapperConstants.PAYLOAD_OFFSET);
 
-			// Always the same flags: One buffer (EOP), advanced data descriptor, CRC offload, data length
-			var bufSize = buffer.getSize();
-			queue.setCmdTypeLength(descAddr, cmdTypeFlags | bufSize);
+			// Always the same flags: One buffer (EOP), advanced data descriptor, CRC offload, segmentation, data length
+			val bufSize = buffer.getSize();
+			queue.setCmdTypeLength(descAddr, flags | bufSize);
 
-			// No fancy offloading - only the total payload length
-			// implement offloading flags here:
-			// - IP checksum offloading is trivial: just set the offset
-			// - TCP/UDP checksum offloading is more annoying, you have to pre-calculate the pseudo-header checksum
-			queue.setOffloadInfoStatus(descAddr, bufSize << IxgbeDefs.ADVTXD_PAYLEN_SHIFT);
+			// The total payload length and the checksums the NIC has to insert using the context
+			val payload = IxgbeTxQueue.getPayloadLength(offload, bufSize);
+			val options = IxgbeTxQueue.getOffloadOptions(offload);
+			queue.setOffloadInfoStatus(descAddr, (payload << IxgbeDefs.ADVTXD_PAYLEN_SHIFT) | options);
 			currentIndex = nextIndex;
 		}
+		queue.index = currentIndex;
 
 		// Send out by advancing tail, i.e. pass control of the bus to the NIC
-		setRegister(IxgbeDefs.TDT(queueId), queue.index);
+		setTailRegister(IxgbeDefs.TDT(queueId), queue.index);
 		return sent - offset;
 	}
 
@@ -836,6 +1897,287 @@ public final class IxgbeDevice extends Device {
 				+ ")";
 	}
 
+	/**
+	 * Native counterpart of {@link #rxBatch(int, PacketBufferWrapper[], int, int)}.
+	 * <p>
+	 * The descriptors are processed with two {@code native} calls per batch instead of several calls per packet.
+	 *
+	 * @param queueId The queue id.
+	 * @param buffers The packet buffer array.
+	 * @param offset  The offset of the packet buffer array.
+	 * @param length  The number of packets to receive.
+	 * @return The number of received packets.
+	 */
+	@SuppressWarnings("LawOfDemeter")
+	private int rxBatchNative(final int queueId, final @NotNull PacketBufferWrapper[] buffers, final int offset,
+							  final int length) {
+		val queue = rxQueues[queueId];
+		val scratch = queue.scratch;
+
+		// Collect the segments of the received packets, which are stored one after the other
+		val consumed = c_rx_batch(queue.virtual, queue.index, queue.capacity, queue.buffers, scratch, scratch.length,
+				length);
+		if (consumed == 0) return 0;
+
+		// Wrap the first segment of every received packet and replace all of them with new packet buffers
+		var received = 0;
+		for (var i = 0; i < consumed; received += 1) {
+			val packetBuffer = queue.mempool.wrap(scratch[i]);
+			buffers[offset + received] = packetBuffer;
+			i += packetBuffer.getSegments();
+		}
+		val popped = queue.mempool.pop(scratch, consumed);
+		if (popped != consumed) {
+			queue.mempool.push(scratch, popped);
+			throw new OutOfMemoryError("Failed to allocate buffer for RX; memory leaking or small memory pool.");
+		}
+		queue.index = (short) c_rx_refill(queue.virtual, queue.index, queue.capacity, queue.buffers, scratch, consumed);
+
+		// Notify the hardware that we are done
+		setTailRegister(IxgbeDefs.RDT(queueId), (queue.index - 1) & (queue.capacity - 1));
+		return received;
+	}
+
+	/**
+	 * Counterpart of {@link #rxBatch(int, PacketBufferWrapper[], int, int)} used when RSC is enabled.
+	 * <p>
+	 * Every descriptor is refilled as soon as the NIC is done with it. The segments of a packet that is not complete
+	 * yet are linked to the packet buffer posted in the descriptor of the next segment, which is the one the NIC will
+	 * fill, and the first segment is remembered there until the descriptor that ends the packet arrives, even if that
+	 * happens in a later batch.
+	 *
+	 * @param queueId The queue id.
+	 * @param buffers The packet buffer array.
+	 * @param offset  The offset of the packet buffer array.
+	 * @param length  The number of packets to receive.
+	 * @return The number of received packets.
+	 */
+	@SuppressWarnings("LawOfDemeter")
+	private int rxBatchCoalesced(final int queueId, final @NotNull PacketBufferWrapper[] buffers, final int offset,
+								 final int length) {
+		val queue = rxQueues[queueId];
+		val chains = queue.chains;
+		var rxIndex = queue.index;
+		var lastRxIndex = rxIndex;
+		var bufInd = offset;
+		val max = bufInd + length;
+		while (bufInd < max) {
+			// Get a descriptor and its status, and stop processing if the NIC is not done with it
+			val descAddr = queue.getDescriptorAddress(rxIndex);
+			val status = queue.getWritebackErrorStatus(descAddr);
+			if ((status & IxgbeDefs.RXDADV_STAT_DD) == 0) break;
+
+			// The segment either starts a packet or continues the one remembered in its descriptor
+			val info = queue.getWritebackPacketInfo(descAddr);
+			val coalesced = (info & IxgbeDefs.RXDADV_RSCCNT_MASK) >>> IxgbeDefs.RXDADV_RSCCNT_SHIFT;
+			val segment = queue.mempool.wrap(queue.buffers[rxIndex]);
+			segment.setSize(queue.getWritebackLength(descAddr));
+
+			// Reset the metadata of every segment, so walking a chain never finds the one of a previous use
+			segment.setOffload(0);
+			segment.setRxFlags(0);
+			segment.setSegments(1);
+			val first = chains[rxIndex];
+			chains[rxIndex] = 0;
+			PacketBufferWrapper packetBuffer;
+			if (first == 0) {
+				packetBuffer = segment;
+				if (coalesced != 0) queue.coalescedPackets += 1;
+			} else {
+				packetBuffer = queue.mempool.wrap(first);
+				packetBuffer.setSegments(packetBuffer.getSegments() + 1);
+			}
+			queue.coalescedSegments += coalesced;
+
+			// Link the segment to the packet buffer the NIC will fill with the next one, or finish the packet
+			if ((status & IxgbeDefs.RXDADV_STAT_EOP) == 0) {
+				val next = queue.getNextSegment(rxIndex, info, status);
+				segment.setNext(queue.buffers[next]);
+				chains[next] = packetBuffer.getVirtualAddress();
+			} else {
+				segment.setNext(0);
+				packetBuffer.setRxFlags(IxgbeRxQueue.getRxFlags(info, status));
+				packetBuffer.setRssHash(queue.getWritebackRssHash(descAddr));
+				packetBuffer.setVlanTag(queue.getWritebackVlanTag(descAddr));
+				buffers[bufInd] = packetBuffer;
+				bufInd += 1;
+			}
+
+			// Register a new packet buffer in the descriptor
+			val newBuf = queue.mempool.pop();
+			if (newBuf == null) {
+				throw new OutOfMemoryError("Failed to allocate buffer for RX; memory leaking or small memory pool.");
+			}
+			queue.setPacketBufferAddress(descAddr,
+					newBuf.getPhysicalAddress() + PacketBufferWrapperConstants.PAYLOAD_OFFSET);
+			queue.setPacketBufferHeaderAddress(descAddr, 0);
+			queue.buffers[rxIndex] = newBuf.getVirtualAddress();
+			lastRxIndex = rxIndex;
+			rxIndex = wrapRing(rxIndex, queue.capacity);
+		}
+
+		// Notify the hardware that we are done
+		if (rxIndex != lastRxIndex) {
+			setTailRegister(IxgbeDefs.RDT(queueId), lastRxIndex);
+			queue.index = rxIndex;
+		}
+		return bufInd - offset;
+	}
+
+	/**
+	 * Native counterpart of the sending step of {@link #txBatch(int, PacketBufferWrapper[], int, int)}.
+	 * <p>
+	 * The descriptors are written with a single {@code native} call per batch instead of several calls per packet.
+	 *
+	 * @param queueId The queue id.
+	 * @param buffers The packet buffer array.
+	 * @param offset  The offset of the packet buffer array.
+	 * @param length  The number of packets to send.
+	 * @param flags   The command flags of every descriptor.
+	 * @return The number of sent packets.
+	 */
+	@SuppressWarnings("LawOfDemeter")
+	private int txBatchNative(final int queueId, final @NotNull PacketBufferWrapper[] buffers, final int offset,
+							  final int length, final int flags) {
+		val queue = txQueues[queueId];
+		val scratch = queue.scratch;
+
+		// We can write as many descriptors as free ones, keeping one as a gap with the clean index
+		val free = (queue.cleanIndex - queue.index - 1) & (queue.capacity - 1);
+		val count = Math.min(length, free);
+		if (count == 0) return 0;
+		for (var i = 0; i < count; i += 1) scratch[i] = buffers[offset + i].getVirtualAddress();
+		val index = (short) c_tx_batch(queue.virtual, queue.index, queue.capacity, free, queue.buffers, scratch, count,
+				flags, queue.context, queue.mss);
+
+		// Remove the sent packet buffers from the original array and cache them for cleaning purposes
+		var sent = 0;
+		var context = false;
+		PacketBufferWrapper head = null;
+		for (var i = queue.index; i != index; i = wrapRing(i, queue.capacity)) {
+			val address = queue.buffers[i];
+			if (address == 0) {
+				cleanablePool[queueId][i] = null;
+				context = true;
+				continue;
+			}
+			if (head == null) {
+				head = buffers[offset + sent];
+				buffers[offset + sent] = null;
+				cleanablePool[queueId][i] = head;
+				if (context) {
+					queue.context = head.getOffload();
+					queue.mss = head.getMss();
+					context = false;
+				}
+			} else {
+				// The rest of the segments of a chain belong to the memory pool of the first one
+				val mempool = Mempool.find(head);
+				if (mempool == null) throw new IllegalStateException("Could NOT find mempool with the given id.");
+				cleanablePool[queueId][i] = mempool.wrap(address & ~IxgbeTxQueue.MORE_SEGMENTS);
+			}
+			if ((address & IxgbeTxQueue.MORE_SEGMENTS) == 0) {
+				head = null;
+				sent += 1;
+			}
+		}
+		queue.index = index;
+
+		// Send out by advancing tail, i.e. pass control of the bus to the NIC
+		setTailRegister(IxgbeDefs.TDT(queueId), queue.index);
+		return sent;
+	}
+
+	/**
+	 * Writes the data descriptors of a packet stored in a chain of packet buffers.
+	 * <p>
+	 * Only the first descriptor carries the payload length and the offload options, and only the last one ends the
+	 * packet and asks the NIC to report its status. The segments are unlinked while they are written, so they can be
+	 * reused as single segment packets once they are sent.
+	 *
+	 * @param queueId  The queue id.
+	 * @param index    The index of the first descriptor to write.
+	 * @param head     The packet buffer wrapper of the first segment.
+	 * @param segments The number of segments.
+	 * @param flags    The command flags of the last descriptor, including the segmentation flag if requested.
+	 * @return The index of the next descriptor to write.
+	 */
+	@SuppressWarnings("LawOfDemeter")
+	private short txChain(final int queueId, short index, final @NotNull PacketBufferWrapper head, final int segments,
+						  final int flags) {
+		val queue = txQueues[queueId];
+		val mempool = Mempool.find(head);
+		if (mempool == null) throw new IllegalStateException("Could NOT find mempool with the given id.");
+		val firstAddr = queue.getDescriptorAddress(index);
+		val segmentFlags = flags & ~(IxgbeDefs.ADVTXD_DCMD_EOP | IxgbeDefs.ADVTXD_DCMD_RS);
+		var segment = head;
+		var length = 0;
+		for (var i = 1; ; i += 1) {
+			val descAddr = queue.getDescriptorAddress(index);
+			val size = segment.getSize();
+			length += size;
+			cleanablePool[queueId][index] = segment;
+			queue.setPacketBufferAddress(descAddr,
+					segment.getPhysicalAddress() + PacketBufferWrapperConstants.PAYLOAD_OFFSET);
+			queue.setOffloadInfoStatus(descAddr, 0);
+			if (i == segments) {
+				queue.buffers[index] = segment.getVirtualAddress();
+				queue.setCmdTypeLength(descAddr, flags | size);
+				index = wrapRing(index, queue.capacity);
+				break;
+			}
+			queue.buffers[index] = segment.getVirtualAddress() | IxgbeTxQueue.MORE_SEGMENTS;
+			queue.setCmdTypeLength(descAddr, segmentFlags | size);
+			index = wrapRing(index, queue.capacity);
+			val next = segment.getNext();
+			segment.setNext(0);
+			segment = mempool.wrap(next);
+		}
+		head.setSegments(1);
+
+		// The total payload length and the checksums the NIC has to insert using the context
+		val offload = head.getOffload();
+		val payload = IxgbeTxQueue.getPayloadLength(offload, length);
+		val options = IxgbeTxQueue.getOffloadOptions(offload);
+		queue.setOffloadInfoStatus(firstAddr, (payload << IxgbeDefs.ADVTXD_PAYLEN_SHIFT) | options);
+		return index;
+	}
+
+	/**
+	 * Checks that a packet can be sent, which means that the NIC supports its number of descriptors and, if it has to
+	 * be segmented, its maximum segment size and payload length.
+	 *
+	 * @param packet The packet buffer wrapper of the first segment.
+	 */
+	private void checkTxPacket(final @NotNull PacketBufferWrapper packet) {
+		if (packet == null) throw new NullPointerException("The packets to send MUST NOT be null.");
+		val segments = packet.getSegments();
+		if (segments + 1 >= config.getTxEntries()) {
+			throw new IllegalArgumentException("The number of segments MUST be less than the TX ring size minus one.");
+		}
+		val offload = packet.getOffload();
+		if ((offload & PacketBufferWrapperConstants.OFL_TSO) == 0) {
+			if (segments > TX_MAX_SEGMENTS) {
+				throw new IllegalArgumentException("An unsegmented packet MUST NOT have more than 40 segments.");
+			}
+			return;
+		}
+		if ((offload & PacketBufferWrapperConstants.OFL_TCP_CHECKSUM) == 0) {
+			throw new IllegalArgumentException("A segmented packet MUST request the TCP checksum offload.");
+		}
+		if (packet.getMss() == 0) throw new IllegalArgumentException("A segmented packet MUST have a positive MSS.");
+		val mempool = Mempool.find(packet);
+		if (mempool == null) throw new IllegalStateException("Could NOT find mempool with the given id.");
+		var length = 0;
+		for (var segment = packet; ; segment = mempool.wrap(segment.getNext())) {
+			length += segment.getSize();
+			if (segment.getNext() == 0) break;
+		}
+		if (IxgbeTxQueue.getPayloadLength(offload, length) > TSO_MAX_PAYLOAD) {
+			throw new IllegalArgumentException("The TCP payload of a segmented packet MUST fit in 256 KB.");
+		}
+	}
+
 	/**
 	 * Computes the next index of a ring buffer.
 	 *
@@ -4,6 +4,7 @@ import de.tum.in.net.ixy.memory.JniMemoryManager;
 import de.tum.in.net.ixy.memory.MemoryManager;
 import de.tum.in.net.ixy.memory.SmartJniMemoryManager;
 import de.tum.in.net.ixy.memory.SmartUnsafeMemoryManager;
+import de.tum.in.net.ixy.memory.VarHandleMemoryManager;
 
 import lombok.extern.slf4j.Slf4j;
 import lombok.val;
@@ -17,6 +18,7 @@ import static de.tum.in.net.ixy.BuildConfig.MEMORY_MANAGER;
 import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
 import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI;
 import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_VARHANDLE;
 import static de.tum.in.net.ixy.utils.Strings.leftPad;
 
 /**
@@ -45,16 +47,21 @@ abstract class IxgbeQueue {
 	short index;
 
 	/** The virtual address where all the descriptors are stored. */
-	private final long virtual;
+	final long virtual;
 
 	/** The virtual addresses of the packet buffer wrappers in the queue. */
 	final @NotNull long[] buffers;
 
+	/** Scratch space used to exchange virtual addresses with the {@code native} batch methods. */
+	final @NotNull long[] scratch;
+
 	/** The memory manager. */
 	protected @NotNull MemoryManager mmanager = MEMORY_MANAGER == PREFER_JNI_FULL
 			? JniMemoryManager.getSingleton()
 			: MEMORY_MANAGER == PREFER_JNI
 			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
 			: SmartUnsafeMemoryManager.getSingleton();
 
 	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
@@ -81,6 +88,7 @@ abstract class IxgbeQueue {
 		this.virtual = virtual;
 		this.capacity = capacity;
 		buffers = new long[capacity];
+		scratch = new long[capacity];
 	}
 
 	/**
@@ -119,6 +127,9 @@ abstract class IxgbeQueue {
 
 	/**
 	 * Sets the packet buffer virtual address stored inside a descriptor.
+	 * <p>
+	 * The NIC only reads the descriptor after the tail register is updated with a release store, so a plain write is
+	 * enough.
 	 *
 	 * @param descriptorAddress The descriptor virtual address.
 	 * @param bufferAddress     The packet buffer virtual address.
@@ -134,7 +145,7 @@ abstract class IxgbeQueue {
 			log.debug("Writing packet buffer virtual address 0x{} of descriptor @ 0x{} + 0.",
 					xbufferAddress, xdescriptorAddress);
 		}
-		mmanager.putLongVolatile(descriptorAddress, bufferAddress);
+		mmanager.putLong(descriptorAddress, bufferAddress);
 		if (!OPTIMIZED && mmanager.getLongVolatile(descriptorAddress) != bufferAddress) {
 			throw new IllegalStateException("Buffer address is not set.");
 		}
@@ -11,6 +11,17 @@ import static de.tum.in.net.ixy.BuildConfig.DEBUG;
 import static de.tum.in.net.ixy.BuildConfig.LOG_DEBUG;
 import static de.tum.in.net.ixy.BuildConfig.LOG_TRACE;
 import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.RXF_IPV4;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.RXF_IPV6;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.RXF_IP_CHECKSUM_BAD;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.RXF_IP_CHECKSUM_GOOD;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.RXF_L4_CHECKSUM_BAD;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.RXF_L4_CHECKSUM_GOOD;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.RXF_RSS_HASH;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.RXF_SCTP;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.RXF_TCP;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.RXF_UDP;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.RXF_VLAN;
 import static de.tum.in.net.ixy.utils.Strings.leftPad;
 
 /**
@@ -27,17 +38,42 @@ final class IxgbeRxQueue extends IxgbeQueue {
 	/** The offset of the address of the packet buffer header. */
 	private static final int OFFSET_HEADER = 8;
 
+	/** The offset of the write buffer packet type and RSS type. */
+	private static final int OFFSET_WRITEBACK_PACKET_INFO = 0;
+
+	/** The offset of the write buffer RSS hash. */
+	private static final int OFFSET_WRITEBACK_RSS_HASH = 4;
+
 	/** The offset of the write buffer error status. */
 	private static final int OFFSET_WRITEBACK_ERROR_STATUS = 8;
 
 	/** The offset of the write buffer length. */
 	private static final int OFFSET_WRITEBACK_LENGTH = 12;
 
+	/** The offset of the write buffer VLAN tag. */
+	private static final int OFFSET_WRITEBACK_VLAN_TAG = 14;
+
 	///////////////////////////////////////////////// MEMBER VARIABLES /////////////////////////////////////////////////
 
 	/** The memory pool. */
 	@Nullable Mempool mempool;
 
+	/**
+	 * The virtual address of the first segment of the packet continued by every descriptor, or {@code null} if RSC is
+	 * disabled.
+	 * <p>
+	 * The segments of a coalesced packet do not use consecutive descriptors, so every descriptor that is not the end of
+	 * a packet tells which descriptor holds the next segment, and the first segment is remembered there until the
+	 * whole packet is received.
+	 */
+	@Nullable long[] chains;
+
+	/** The number of received packets that were coalesced by RSC. */
+	long coalescedPackets;
+
+	/** The number of TCP segments that RSC coalesced into the received packets. */
+	long coalescedSegments;
+
 	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
 
 	/**
@@ -53,8 +89,76 @@ final class IxgbeRxQueue extends IxgbeQueue {
 		}
 	}
 
+	/**
+	 * Translates the writeback of a descriptor into the RX flags of its packet buffer.
+	 * <p>
+	 * The packet type is ignored when the packet matched an EtherType filter, because the NIC reuses the field to
+	 * report the filter instead.
+	 *
+	 * @param info   The writeback packet type and RSS type.
+	 * @param status The writeback error status.
+	 * @return The RX flags.
+	 */
+	static int getRxFlags(final int info, final int status) {
+		var flags = 0;
+		if ((info & IxgbeDefs.RXDADV_PKTTYPE_ETQF) == 0) {
+			if ((info & (IxgbeDefs.RXDADV_PKTTYPE_IPV4 | IxgbeDefs.RXDADV_PKTTYPE_IPV4_EX)) != 0) flags |= RXF_IPV4;
+			if ((info & (IxgbeDefs.RXDADV_PKTTYPE_IPV6 | IxgbeDefs.RXDADV_PKTTYPE_IPV6_EX)) != 0) flags |= RXF_IPV6;
+			if ((info & IxgbeDefs.RXDADV_PKTTYPE_TCP) != 0) flags |= RXF_TCP;
+			if ((info & IxgbeDefs.RXDADV_PKTTYPE_UDP) != 0) flags |= RXF_UDP;
+			if ((info & IxgbeDefs.RXDADV_PKTTYPE_SCTP) != 0) flags |= RXF_SCTP;
+		}
+		if ((status & IxgbeDefs.RXDADV_STAT_IPCS) != 0) {
+			flags |= (status & IxgbeDefs.RXDADV_ERR_IPE) == 0 ? RXF_IP_CHECKSUM_GOOD : RXF_IP_CHECKSUM_BAD;
+		}
+		if ((status & IxgbeDefs.RXDADV_STAT_L4CS) != 0) {
+			flags |= (status & IxgbeDefs.RXDADV_ERR_TCPE) == 0 ? RXF_L4_CHECKSUM_GOOD : RXF_L4_CHECKSUM_BAD;
+		}
+		if ((info & IxgbeDefs.RXDADV_RSSTYPE_MASK) != 0) flags |= RXF_RSS_HASH;
+		if ((status & IxgbeDefs.RXDADV_STAT_VP) != 0) flags |= RXF_VLAN;
+		return flags;
+	}
+
+	/**
+	 * Returns the index of the descriptor that holds the next segment of a packet.
+	 * <p>
+	 * Coalesced packets report the index in the writeback, and the rest of the packets continue in the next descriptor.
+	 *
+	 * @param index  The index of the descriptor of the current segment.
+	 * @param info   The writeback packet type and RSS type.
+	 * @param status The writeback error status.
+	 * @return The index of the descriptor of the next segment.
+	 */
+	int getNextSegment(final int index, final int info, final int status) {
+		if ((info & IxgbeDefs.RXDADV_RSCCNT_MASK) == 0) return (index + 1) & (capacity - 1);
+		return (status & IxgbeDefs.RXDADV_NEXTP_MASK) >>> IxgbeDefs.RXDADV_NEXTP_SHIFT;
+	}
+
+	/**
+	 * Counts the descriptors used by the packet that starts at a given descriptor.
+	 * <p>
+	 * A packet that does not fit in a single packet buffer is spread over consecutive descriptors, and only the last one
+	 * reports the end of the packet. The packet cannot be processed until the NIC is done with all of them.
+	 *
+	 * @param index The index of the first descriptor of the packet.
+	 * @return The number of descriptors of the packet, or {@code 0} if the NIC is not done with all of them yet.
+	 */
+	int countSegments(short index) {
+		var segments = 1;
+		var status = getWritebackErrorStatus(getDescriptorAddress(index));
+		while ((status & IxgbeDefs.RXDADV_STAT_DD) != 0 && (status & IxgbeDefs.RXDADV_STAT_EOP) == 0) {
+			index = (short) ((index + 1) & (capacity - 1));
+			status = getWritebackErrorStatus(getDescriptorAddress(index));
+			segments += 1;
+		}
+		return (status & IxgbeDefs.RXDADV_STAT_DD) == 0 ? 0 : segments;
+	}
+
 	/**
 	 * Sets the address of the packet buffer header stored inside a descriptor.
+	 * <p>
+	 * The NIC only reads the descriptor after the tail register is updated with a release store, so a plain write is
+	 * enough.
 	 *
 	 * @param descriptorAddress         The descriptor virtual address.
 	 * @param packetBufferHeaderAddress The packet buffer header virtual address.
@@ -69,7 +173,7 @@ final class IxgbeRxQueue extends IxgbeQueue {
 			log.trace("Writing packet buffer header virtual address 0x{} of descriptor @ 0x{} + {}.",
 					xpacketBufferHeaderAddress, xdescriptorAddress, OFFSET_HEADER);
 		}
-		mmanager.putLongVolatile(descriptorAddress + OFFSET_HEADER, packetBufferHeaderAddress);
+		mmanager.putLong(descriptorAddress + OFFSET_HEADER, packetBufferHeaderAddress);
 		if (!OPTIMIZED && mmanager.getLongVolatile(descriptorAddress + OFFSET_HEADER) != packetBufferHeaderAddress) {
 			throw new IllegalStateException("Header buffer address was NOT written.");
 		}
@@ -77,6 +181,9 @@ final class IxgbeRxQueue extends IxgbeQueue {
 
 	/**
 	 * Returns the writeback error status stored inside a descriptor.
+	 * <p>
+	 * The NIC writes the status back when it is done with the descriptor, so it is read with acquire semantics to
+	 * guarantee that the rest of the writeback is not read before it.
 	 *
 	 * @param descriptorAddress The descriptor virtual address.
 	 * @return The writeback error status.
@@ -90,11 +197,13 @@ final class IxgbeRxQueue extends IxgbeQueue {
 			log.trace("Reading writeback error status from descriptor @ 0x{} + {}.",
 					xdescriptorAddress, OFFSET_WRITEBACK_ERROR_STATUS);
 		}
-		return mmanager.getIntVolatile(descriptorAddress + OFFSET_WRITEBACK_ERROR_STATUS);
+		return mmanager.getIntAcquire(descriptorAddress + OFFSET_WRITEBACK_ERROR_STATUS);
 	}
 
 	/**
 	 * Returns the writeback length stored inside a descriptor.
+	 * <p>
+	 * The length is only valid after {@link #getWritebackErrorStatus(long)} reports it, so a plain read is enough.
 	 *
 	 * @param descriptorAddress The descriptor virtual address.
 	 * @return The write buffer length.
@@ -108,7 +217,67 @@ final class IxgbeRxQueue extends IxgbeQueue {
 			log.trace("Reading writeback length from descriptor @ 0x{} + {}.",
 					xdescriptorAddress, OFFSET_WRITEBACK_LENGTH);
 		}
-		return mmanager.getShortVolatile(descriptorAddress + OFFSET_WRITEBACK_LENGTH);
+		return mmanager.getShort(descriptorAddress + OFFSET_WRITEBACK_LENGTH);
+	}
+
+	/**
+	 * Returns the writeback packet type and RSS type stored inside a descriptor.
+	 * <p>
+	 * The value is only valid after {@link #getWritebackErrorStatus(long)} reports it, so a plain read is enough.
+	 *
+	 * @param descriptorAddress The descriptor virtual address.
+	 * @return The writeback packet type and RSS type.
+	 */
+	int getWritebackPacketInfo(final long descriptorAddress) {
+		if (!OPTIMIZED && descriptorAddress == 0) {
+			throw new IllegalArgumentException("The parameter 'descriptorAddress' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) {
+			val xdescriptorAddress = leftPad(descriptorAddress);
+			log.trace("Reading writeback packet info from descriptor @ 0x{} + {}.",
+					xdescriptorAddress, OFFSET_WRITEBACK_PACKET_INFO);
+		}
+		return mmanager.getInt(descriptorAddress + OFFSET_WRITEBACK_PACKET_INFO);
+	}
+
+	/**
+	 * Returns the writeback RSS hash stored inside a descriptor.
+	 * <p>
+	 * The hash is only valid after {@link #getWritebackErrorStatus(long)} reports it, so a plain read is enough.
+	 *
+	 * @param descriptorAddress The descriptor virtual address.
+	 * @return The writeback RSS hash.
+	 */
+	int getWritebackRssHash(final long descriptorAddress) {
+		if (!OPTIMIZED && descriptorAddress == 0) {
+			throw new IllegalArgumentException("The parameter 'descriptorAddress' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) {
+			val xdescriptorAddress = leftPad(descriptorAddress);
+			log.trace("Reading writeback RSS hash from descriptor @ 0x{} + {}.",
+					xdescriptorAddress, OFFSET_WRITEBACK_RSS_HASH);
+		}
+		return mmanager.getInt(descriptorAddress + OFFSET_WRITEBACK_RSS_HASH);
+	}
+
+	/**
+	 * Returns the writeback VLAN tag stored inside a descriptor.
+	 * <p>
+	 * The tag is only valid after {@link #getWritebackErrorStatus(long)} reports it, so a plain read is enough.
+	 *
+	 * @param descriptorAddress The descriptor virtual address.
+	 * @return The writeback VLAN tag.
+	 */
+	short getWritebackVlanTag(final long descriptorAddress) {
+		if (!OPTIMIZED && descriptorAddress == 0) {
+			throw new IllegalArgumentException("The parameter 'descriptorAddress' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) {
+			val xdescriptorAddress = leftPad(descriptorAddress);
+			log.trace("Reading writeback VLAN tag from descriptor @ 0x{} + {}.",
+					xdescriptorAddress, OFFSET_WRITEBACK_VLAN_TAG);
+		}
+		return mmanager.getShort(descriptorAddress + OFFSET_WRITEBACK_VLAN_TAG);
 	}
 
 }
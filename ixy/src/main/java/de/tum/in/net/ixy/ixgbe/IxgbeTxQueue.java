@@ -7,6 +7,17 @@ import static de.tum.in.net.ixy.BuildConfig.DEBUG;
 import static de.tum.in.net.ixy.BuildConfig.LOG_DEBUG;
 import static de.tum.in.net.ixy.BuildConfig.LOG_TRACE;
 import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_IPV6;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_IP_CHECKSUM;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_L2_LENGTH_MASK;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_L2_LENGTH_SHIFT;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_L3_LENGTH_MASK;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_L3_LENGTH_SHIFT;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_L4_LENGTH_MASK;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_L4_LENGTH_SHIFT;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_TCP_CHECKSUM;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_TSO;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_UDP_CHECKSUM;
 import static de.tum.in.net.ixy.utils.Strings.leftPad;
 
 /**
@@ -26,11 +37,38 @@ final class IxgbeTxQueue extends IxgbeQueue {
 	/** The offset of the write buffer error status. */
 	private static final int OFFLOAD_STATUS_OFFSET = 12;
 
+	/** The offset of the MAC and IP header lengths of a context descriptor. */
+	private static final int CONTEXT_LENS_OFFSET = 0;
+
+	/** The offset of the sequence number seed of a context descriptor. */
+	private static final int CONTEXT_SEED_OFFSET = 4;
+
+	/** The offset of the type and the checksum commands of a context descriptor. */
+	private static final int CONTEXT_TUCMD_OFFSET = 8;
+
+	/** The offset of the MSS, the layer 4 header length and the context index of a context descriptor. */
+	private static final int CONTEXT_MSS_OFFSET = 12;
+
+	/** The mask of the MAC and IP header lengths inside the offload flags. */
+	private static final int OFFLOAD_LENS_MASK = 0xFFFF;
+
+	/**
+	 * The flag added to the virtual address stored in {@link #buffers} when the packet buffer is not the last segment of
+	 * its packet, which never collides with an address because packet buffers are aligned.
+	 */
+	static final long MORE_SEGMENTS = 1;
+
 	///////////////////////////////////////////////// MEMBER VARIABLES /////////////////////////////////////////////////
 
 	/** The index of the first descriptor to clean. */
 	short cleanIndex;
 
+	/** The offload flags programmed in the context of the queue, {@code 0} if no context has been programmed yet. */
+	int context;
+
+	/** The maximum segment size programmed in the context of the queue. */
+	int mss;
+
 	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
 
 	/**
@@ -45,6 +83,76 @@ final class IxgbeTxQueue extends IxgbeQueue {
 			log.debug("Creating an TX Ixgbe queue with a capacity for {} packets @ 0x{}.", capacity, leftPad(virtual));
 		}
 		cleanIndex = 0;
+		context = 0;
+		mss = 0;
+	}
+
+	/**
+	 * Returns the index of the descriptor that ends the packet a given descriptor belongs to.
+	 * <p>
+	 * The NIC only writes back the status of the last data descriptor of a packet, so context descriptors, which are
+	 * stored as {@code 0} in {@link #buffers}, and the rest of the segments cannot tell whether the packet was sent.
+	 *
+	 * @param index The index of a descriptor of the packet.
+	 * @return The index of the last descriptor of the packet.
+	 */
+	int getPacketEnd(int index) {
+		while (buffers[index] == 0 || (buffers[index] & MORE_SEGMENTS) != 0) index = (index + 1) & (capacity - 1);
+		return index;
+	}
+
+	/**
+	 * Checks if a packet needs a context descriptor because its offloads differ from the ones programmed in the
+	 * context of the queue.
+	 *
+	 * @param offload The offload flags of the packet.
+	 * @param mss     The maximum segment size of the packet, which is only compared when segmentation is requested.
+	 * @return Whether a context descriptor has to be written before the packet.
+	 */
+	boolean needsContext(final int offload, final int mss) {
+		return offload != 0 && (offload != context || (offload & OFL_TSO) != 0 && mss != this.mss);
+	}
+
+	/**
+	 * Translates the offload flags of a packet buffer into the command flags of its data descriptors.
+	 *
+	 * @param offload The offload flags.
+	 * @return The command flags, which have to be combined with the rest of flags and the buffer length.
+	 */
+	static int getOffloadCommand(final int offload) {
+		return (offload & OFL_TSO) != 0 ? IxgbeDefs.ADVTXD_DCMD_TSE : 0;
+	}
+
+	/**
+	 * Computes the payload length of the first data descriptor of a packet.
+	 * <p>
+	 * When segmentation is requested, the NIC expects the length of the TCP payload only, without the headers that are
+	 * replicated in every segment.
+	 *
+	 * @param offload The offload flags.
+	 * @param length  The length of the whole packet.
+	 * @return The payload length.
+	 */
+	static int getPayloadLength(final int offload, final int length) {
+		if ((offload & OFL_TSO) == 0) return length;
+		val l2Length = (offload >>> OFL_L2_LENGTH_SHIFT) & OFL_L2_LENGTH_MASK;
+		val l3Length = (offload >>> OFL_L3_LENGTH_SHIFT) & OFL_L3_LENGTH_MASK;
+		val l4Length = (offload >>> OFL_L4_LENGTH_SHIFT) & OFL_L4_LENGTH_MASK;
+		return length - l2Length - l3Length - l4Length;
+	}
+
+	/**
+	 * Translates the offload flags of a packet buffer into the options of its data descriptor.
+	 *
+	 * @param offload The offload flags.
+	 * @return The options, which have to be combined with the payload length.
+	 */
+	static int getOffloadOptions(final int offload) {
+		if (offload == 0) return 0;
+		var options = IxgbeDefs.ADVTXD_CC;
+		if ((offload & OFL_IP_CHECKSUM) != 0) options |= IxgbeDefs.ADVTXD_POPTS_IXSM;
+		if ((offload & (OFL_UDP_CHECKSUM | OFL_TCP_CHECKSUM)) != 0) options |= IxgbeDefs.ADVTXD_POPTS_TXSM;
+		return options;
 	}
 
 	/**
@@ -66,6 +174,9 @@ final class IxgbeTxQueue extends IxgbeQueue {
 
 	/**
 	 * Sets the command type length stored inside a descriptor.
+	 * <p>
+	 * The NIC only reads the descriptor after the tail register is updated with a release store, so a plain write is
+	 * enough.
 	 *
 	 * @param descriptorAddress The descriptor virtual address.
 	 * @param cmdTypeLength     The command type length.
@@ -80,7 +191,7 @@ final class IxgbeTxQueue extends IxgbeQueue {
 			log.trace("Writing command type length 0x{} of descriptor @ 0x{} + {}.",
 					xcmdTypeLength, xdescriptorAddress, CMD_TYPE_LENGTH_OFFSET);
 		}
-		mmanager.putIntVolatile(descriptorAddress + CMD_TYPE_LENGTH_OFFSET, cmdTypeLength);
+		mmanager.putInt(descriptorAddress + CMD_TYPE_LENGTH_OFFSET, cmdTypeLength);
 		if (!OPTIMIZED && mmanager.getIntVolatile(descriptorAddress + CMD_TYPE_LENGTH_OFFSET) != cmdTypeLength) {
 			throw new IllegalStateException("Command type length was NOT written.");
 		}
@@ -88,6 +199,8 @@ final class IxgbeTxQueue extends IxgbeQueue {
 
 	/**
 	 * Returns the offloading status stored inside a descriptor.
+	 * <p>
+	 * The NIC writes the status back when it is done with the descriptor, so it is read with acquire semantics.
 	 *
 	 * @param descriptorAddress The descriptor virtual address.
 	 * @return The offloading status.
@@ -100,11 +213,14 @@ final class IxgbeTxQueue extends IxgbeQueue {
 			log.trace("Reading offloading info status from descriptor at @ 0x{} + {}.",
 					leftPad(descriptorAddress), OFFLOAD_STATUS_OFFSET);
 		}
-		return mmanager.getIntVolatile(descriptorAddress + OFFLOAD_STATUS_OFFSET);
+		return mmanager.getIntAcquire(descriptorAddress + OFFLOAD_STATUS_OFFSET);
 	}
 
 	/**
 	 * Sets the offloading status stored inside a descriptor.
+	 * <p>
+	 * The NIC only reads the descriptor after the tail register is updated with a release store, so a plain write is
+	 * enough.
 	 *
 	 * @param descriptorAddress    The descriptor virtual address.
 	 * @param offloadingStatusInfo The offloading status.
@@ -119,10 +235,40 @@ final class IxgbeTxQueue extends IxgbeQueue {
 			log.trace("Writing offloading info status 0x{} of descriptor at @ 0x{} + {}.",
 					xoffloadInfoStatus, xdescriptorAddress, OFFLOAD_STATUS_OFFSET);
 		}
-		mmanager.putIntVolatile(descriptorAddress + OFFLOAD_STATUS_OFFSET, offloadingStatusInfo);
+		mmanager.putInt(descriptorAddress + OFFLOAD_STATUS_OFFSET, offloadingStatusInfo);
 		if (!OPTIMIZED && mmanager.getIntVolatile(descriptorAddress + OFFLOAD_STATUS_OFFSET) != offloadingStatusInfo) {
 			throw new IllegalStateException("Offload info status WAS not written.");
 		}
 	}
 
+	/**
+	 * Writes a context descriptor that programs the offload flags of a packet buffer in the context of the queue.
+	 * <p>
+	 * The NIC only reads the descriptor after the tail register is updated with a release store, so plain writes are
+	 * enough.
+	 *
+	 * @param descriptorAddress The descriptor virtual address.
+	 * @param offload           The offload flags.
+	 * @param mss               The maximum segment size, which is only programmed when segmentation is requested.
+	 */
+	void setContext(final long descriptorAddress, final int offload, final int mss) {
+		if (!OPTIMIZED && descriptorAddress == 0) {
+			throw new IllegalArgumentException("The parameter 'descriptorAddress' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Writing context 0x{} to descriptor @ 0x{}.", leftPad(offload), leftPad(descriptorAddress));
+		}
+		var tucmd = IxgbeDefs.ADVTXD_DTYP_CTXT | IxgbeDefs.ADVTXD_DCMD_DEXT;
+		if ((offload & OFL_IPV6) == 0) tucmd |= IxgbeDefs.ADVTXD_TUCMD_IPV4;
+		tucmd |= (offload & OFL_TCP_CHECKSUM) != 0 ? IxgbeDefs.ADVTXD_TUCMD_L4T_TCP : IxgbeDefs.ADVTXD_TUCMD_L4T_UDP;
+		val l4Length = (offload >>> OFL_L4_LENGTH_SHIFT) & OFL_L4_LENGTH_MASK;
+		mmanager.putInt(descriptorAddress + CONTEXT_LENS_OFFSET, offload & OFFLOAD_LENS_MASK);
+		mmanager.putInt(descriptorAddress + CONTEXT_SEED_OFFSET, 0);
+		mmanager.putInt(descriptorAddress + CONTEXT_TUCMD_OFFSET, tucmd);
+		val mssL4Length = (offload & OFL_TSO) != 0 ? (mss & 0xFFFF) << IxgbeDefs.ADVTXD_MSS_SHIFT : 0;
+		mmanager.putInt(descriptorAddress + CONTEXT_MSS_OFFSET, mssL4Length | l4Length << IxgbeDefs.ADVTXD_L4LEN_SHIFT);
+		context = offload;
+		this.mss = mss;
+	}
+
 }
@@ -0,0 +1,625 @@
+package de.tum.in.net.ixy.memory;
+
+import de.tum.in.net.ixy.utils.Native;
+
+import java.nio.ByteOrder;
+
+import lombok.AccessLevel;
+import lombok.NoArgsConstructor;
+import lombok.extern.slf4j.Slf4j;
+import lombok.val;
+
+import org.jetbrains.annotations.Contract;
+import org.jetbrains.annotations.NotNull;
+
+import static de.tum.in.net.ixy.BuildConfig.DEBUG;
+import static de.tum.in.net.ixy.BuildConfig.LOG_TRACE;
+import static de.tum.in.net.ixy.BuildConfig.LOG_WARN;
+import static de.tum.in.net.ixy.BuildConfig.MEMORY_MANAGER;
+import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_VARHANDLE;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_IP_CHECKSUM;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_TCP_CHECKSUM;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_TSO;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_UDP_CHECKSUM;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.PAYLOAD_OFFSET;
+import static de.tum.in.net.ixy.utils.Strings.leftPad;
+
+/**
+ * Computes and updates the Internet checksum (RFC 1071) of IPv4 headers and UDP and TCP segments.
+ * <p>
+ * Every sum and checksum handled by this class is a 16 bit value in network byte order stored in the lower bits of an
+ * {@code int} or in a {@code short}, so it can be written directly into a packet with {@link #putNetworkShort}.
+ * Partial sums can be chained by passing the result of one call as the initial value of the next one, which allows
+ * to add the pseudo header of {@link #pseudoHeader(int, int, int, int)} to the sum of a segment. The checksums that
+ * only change because a field of the packet changed can be updated without reading the whole packet using {@link
+ * #update(short, short, short)}, as described in RFC 1624.
+ * <p>
+ * The sums of memory regions are computed by the {@code native} library using the widest kernels the CPU supports
+ * (AVX2, SSE2 or 32 bit words). When the library is not available, the sums fall back to the {@code Unsafe}-based
+ * memory manager, which reads the memory a {@code long} at a time.
+ * <p>
+ * Instead of computing the checksums, {@link #offload(PacketBufferWrapper, int)} prepares a packet so that the NIC
+ * inserts them when the packet is sent, and {@link #segmentation(PacketBufferWrapper, int, int)} prepares a large TCP
+ * packet so that the NIC also splits it in segments.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@Slf4j
+@NoArgsConstructor(access = AccessLevel.PRIVATE)
+@SuppressWarnings({"ConstantConditions", "Duplicates", "PMD.AvoidDuplicateLiterals"})
+public final class Checksums {
+
+	///////////////////////////////////////////////// STATIC VARIABLES /////////////////////////////////////////////////
+
+	/** The IPv4 protocol number of TCP. */
+	public static final int PROTOCOL_TCP = 6;
+
+	/** The IPv4 protocol number of UDP. */
+	public static final int PROTOCOL_UDP = 17;
+
+	/** The offset of the total length field inside the IPv4 header. */
+	private static final int IP_LENGTH_OFFSET = 2;
+
+	/** The offset of the protocol field inside the IPv4 header. */
+	private static final int IP_PROTOCOL_OFFSET = 9;
+
+	/** The offset of the checksum field inside the IPv4 header. */
+	private static final int IP_CHECKSUM_OFFSET = 10;
+
+	/** The offset of the source address field inside the IPv4 header. */
+	private static final int IP_SRC_OFFSET = 12;
+
+	/** The offset of the destination address field inside the IPv4 header. */
+	private static final int IP_DEST_OFFSET = 16;
+
+	/** The offset of the length field inside the UDP header. */
+	private static final int UDP_LENGTH_OFFSET = 4;
+
+	/** The offset of the checksum field inside the UDP header. */
+	private static final int UDP_CHECKSUM_OFFSET = 6;
+
+	/** The size of the UDP header. */
+	private static final int UDP_HEADER_LENGTH = 8;
+
+	/** The offset of the data offset field inside the TCP header. */
+	private static final int TCP_DATA_OFFSET_OFFSET = 12;
+
+	/** The offset of the checksum field inside the TCP header. */
+	private static final int TCP_CHECKSUM_OFFSET = 16;
+
+	/** The mask of a 16 bit word. */
+	private static final int MASK = 0xFFFF;
+
+	/** The mask of a 32 bit word. */
+	private static final long INT_MASK = 0xFFFFFFFFL;
+
+	/** Whether the native byte order is little endian, in which case the native sums have to be swapped. */
+	private static final boolean LITTLE_ENDIAN = ByteOrder.nativeOrder() == ByteOrder.LITTLE_ENDIAN;
+
+	/** The memory manager used when the {@code native} library is not available. */
+	@SuppressWarnings("NestedConditionalExpression")
+	private static final @NotNull MemoryManager mmanager = MEMORY_MANAGER == PREFER_JNI_FULL
+			? JniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_JNI
+			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
+			: SmartUnsafeMemoryManager.getSingleton();
+
+	/** Whether the {@code native} sum is available. */
+	private static final boolean available;
+
+	static {
+		Native.loadLibrary("ixy", "resources");
+		var loaded = false;
+		try {
+			loaded = c_sum(0, 0) == 0;
+		} catch (final UnsatisfiedLinkError e) {
+			if (DEBUG >= LOG_WARN) log.warn("The native checksum kernels are not available.", e);
+		}
+		available = loaded;
+	}
+
+	////////////////////////////////////////////////// NATIVE METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Computes the one's complement sum of a memory region.
+	 *
+	 * @param address The address of the memory region.
+	 * @param bytes   The size of the memory region.
+	 * @return The folded 16 bit sum in native byte order.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native int c_sum(long address, int bytes);
+
+	////////////////////////////////////////////////// STATIC METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Adds the one's complement sum of a memory region to a partial sum.
+	 *
+	 * @param address The address of the memory region.
+	 * @param bytes   The size of the memory region.
+	 * @param initial The partial sum.
+	 * @return The folded 16 bit sum.
+	 */
+	@Contract(pure = true)
+	public static int sum(final long address, final int bytes, final int initial) {
+		if (!OPTIMIZED) {
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+			if (bytes < 0) throw new IllegalArgumentException("The parameter 'bytes' MUST NOT be negative.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Summing {} bytes @ 0x{}.", bytes, leftPad(address));
+		val sum = available ? c_sum(address, bytes) : fold(sumWords(address, bytes));
+		return fold((initial & INT_MASK) + (LITTLE_ENDIAN ? swap(sum) : sum));
+	}
+
+	/**
+	 * Adds the one's complement sum of a region of a {@code byte[]} to a partial sum.
+	 *
+	 * @param data    The data.
+	 * @param offset  The offset of the region.
+	 * @param bytes   The size of the region.
+	 * @param initial The partial sum.
+	 * @return The folded 16 bit sum.
+	 */
+	@Contract(pure = true)
+	public static int sum(final @NotNull byte[] data, final int offset, final int bytes, final int initial) {
+		if (!OPTIMIZED) {
+			if (data == null) throw new NullPointerException("The parameter 'data' MUST NOT be null.");
+			if (offset < 0 || bytes < 0 || offset + bytes > data.length) {
+				throw new IllegalArgumentException("The region MUST be inside the array.");
+			}
+		}
+		var sum = initial & INT_MASK;
+		var i = offset;
+		val end = offset + bytes;
+		for (; i + 1 < end; i += 2) sum += ((data[i] & 0xFF) << Byte.SIZE) | (data[i + 1] & 0xFF);
+		if (i < end) sum += (data[i] & 0xFF) << Byte.SIZE;
+		return fold(sum);
+	}
+
+	/**
+	 * Computes the partial sum of the IPv4 pseudo header used by the UDP and TCP checksums.
+	 *
+	 * @param src      The source address.
+	 * @param dest     The destination address.
+	 * @param protocol The protocol number.
+	 * @param length   The length of the UDP datagram or TCP segment.
+	 * @return The folded 16 bit sum.
+	 */
+	@Contract(pure = true)
+	public static int pseudoHeader(final int src, final int dest, final int protocol, final int length) {
+		return fold((src >>> Short.SIZE) + (src & MASK) + (dest >>> Short.SIZE) + (dest & MASK)
+				+ (protocol & 0xFF) + (length & MASK));
+	}
+
+	/**
+	 * Folds the carries of a sum into its lower 16 bits.
+	 *
+	 * @param sum The sum.
+	 * @return The folded 16 bit sum.
+	 */
+	@Contract(pure = true)
+	public static int fold(long sum) {
+		while ((sum >>> Short.SIZE) != 0) sum = (sum & MASK) + (sum >>> Short.SIZE);
+		return (int) sum;
+	}
+
+	/**
+	 * Converts a sum into a checksum.
+	 *
+	 * @param sum The sum.
+	 * @return The checksum.
+	 */
+	@Contract(pure = true)
+	public static short finish(final int sum) {
+		return (short) ~fold(sum & INT_MASK);
+	}
+
+	/**
+	 * Computes the checksum of a memory region.
+	 *
+	 * @param address The address of the memory region.
+	 * @param bytes   The size of the memory region.
+	 * @return The checksum.
+	 */
+	@Contract(pure = true)
+	public static short checksum(final long address, final int bytes) {
+		return finish(sum(address, bytes, 0));
+	}
+
+	/**
+	 * Computes the checksum of a region of a {@code byte[]}.
+	 *
+	 * @param data   The data.
+	 * @param offset The offset of the region.
+	 * @param bytes  The size of the region.
+	 * @return The checksum.
+	 */
+	@Contract(pure = true)
+	public static short checksum(final @NotNull byte[] data, final int offset, final int bytes) {
+		return finish(sum(data, offset, bytes, 0));
+	}
+
+	/**
+	 * Updates a checksum after a 16 bit field of the checksummed data changed, following the equation 3 of RFC 1624.
+	 *
+	 * @param checksum The checksum.
+	 * @param previous The previous value of the field.
+	 * @param current  The current value of the field.
+	 * @return The updated checksum.
+	 */
+	@Contract(pure = true)
+	public static short update(final short checksum, final short previous, final short current) {
+		return finish((~checksum & MASK) + (~previous & MASK) + (current & MASK));
+	}
+
+	/**
+	 * Updates a checksum after a 32 bit field of the checksummed data changed, following the equation 3 of RFC 1624.
+	 * <p>
+	 * The field must start at an even offset of the checksummed data.
+	 *
+	 * @param checksum The checksum.
+	 * @param previous The previous value of the field.
+	 * @param current  The current value of the field.
+	 * @return The updated checksum.
+	 */
+	@Contract(pure = true)
+	public static short update(final short checksum, final int previous, final int current) {
+		return finish((~checksum & MASK) + (~previous >>> Short.SIZE) + (~previous & MASK)
+				+ (current >>> Short.SIZE) + (current & MASK));
+	}
+
+	/**
+	 * Computes and writes the checksum of an IPv4 header stored in the payload of a packet.
+	 *
+	 * @param packet The packet.
+	 * @param offset The offset of the IPv4 header inside the payload.
+	 * @return The checksum.
+	 */
+	public static short ipv4(final @NotNull PacketBufferWrapper packet, final int offset) {
+		if (!OPTIMIZED && packet == null) throw new NullPointerException("The parameter 'packet' MUST NOT be null.");
+		val address = packet.getVirtualAddress() + PAYLOAD_OFFSET + offset;
+		packet.putShort(offset + IP_CHECKSUM_OFFSET, (short) 0);
+		val checksum = checksum(address, headerLength(packet.getByte(offset)));
+		putNetworkShort(packet, offset + IP_CHECKSUM_OFFSET, checksum);
+		return checksum;
+	}
+
+	/**
+	 * Computes and writes the checksum of an IPv4 header stored in a {@code byte[]}.
+	 *
+	 * @param data   The data.
+	 * @param offset The offset of the IPv4 header.
+	 * @return The checksum.
+	 */
+	public static short ipv4(final @NotNull byte[] data, final int offset) {
+		if (!OPTIMIZED && data == null) throw new NullPointerException("The parameter 'data' MUST NOT be null.");
+		putNetworkShort(data, offset + IP_CHECKSUM_OFFSET, (short) 0);
+		val checksum = checksum(data, offset, headerLength(data[offset]));
+		putNetworkShort(data, offset + IP_CHECKSUM_OFFSET, checksum);
+		return checksum;
+	}
+
+	/**
+	 * Computes and writes the checksum of a UDP datagram transported by an IPv4 packet stored in the payload of a
+	 * packet.
+	 * <p>
+	 * A computed checksum of {@code 0x0000} is transmitted as {@code 0xFFFF}, as required by RFC 768.
+	 *
+	 * @param packet The packet.
+	 * @param offset The offset of the IPv4 header inside the payload.
+	 * @return The checksum.
+	 */
+	public static short udp(final @NotNull PacketBufferWrapper packet, final int offset) {
+		if (!OPTIMIZED && packet == null) throw new NullPointerException("The parameter 'packet' MUST NOT be null.");
+		val udp = offset + headerLength(packet.getByte(offset));
+		val length = getNetworkShort(packet, udp + UDP_LENGTH_OFFSET) & MASK;
+		val pseudo = pseudoHeader(getNetworkInt(packet, offset + IP_SRC_OFFSET),
+				getNetworkInt(packet, offset + IP_DEST_OFFSET), PROTOCOL_UDP, length);
+		packet.putShort(udp + UDP_CHECKSUM_OFFSET, (short) 0);
+		val checksum = udpChecksum(sum(packet.getVirtualAddress() + PAYLOAD_OFFSET + udp, length, pseudo));
+		putNetworkShort(packet, udp + UDP_CHECKSUM_OFFSET, checksum);
+		return checksum;
+	}
+
+	/**
+	 * Computes and writes the checksum of a UDP datagram transported by an IPv4 packet stored in a {@code byte[]}.
+	 * <p>
+	 * A computed checksum of {@code 0x0000} is transmitted as {@code 0xFFFF}, as required by RFC 768.
+	 *
+	 * @param data   The data.
+	 * @param offset The offset of the IPv4 header.
+	 * @return The checksum.
+	 */
+	public static short udp(final @NotNull byte[] data, final int offset) {
+		if (!OPTIMIZED && data == null) throw new NullPointerException("The parameter 'data' MUST NOT be null.");
+		val udp = offset + headerLength(data[offset]);
+		val length = getNetworkShort(data, udp + UDP_LENGTH_OFFSET) & MASK;
+		val pseudo = pseudoHeader(getNetworkInt(data, offset + IP_SRC_OFFSET),
+				getNetworkInt(data, offset + IP_DEST_OFFSET), PROTOCOL_UDP, length);
+		putNetworkShort(data, udp + UDP_CHECKSUM_OFFSET, (short) 0);
+		val checksum = udpChecksum(sum(data, udp, length, pseudo));
+		putNetworkShort(data, udp + UDP_CHECKSUM_OFFSET, checksum);
+		return checksum;
+	}
+
+	/**
+	 * Computes and writes the checksum of a TCP segment transported by an IPv4 packet stored in the payload of a
+	 * packet.
+	 * <p>
+	 * The length of the segment is derived from the total length of the IPv4 packet.
+	 *
+	 * @param packet The packet.
+	 * @param offset The offset of the IPv4 header inside the payload.
+	 * @return The checksum.
+	 */
+	public static short tcp(final @NotNull PacketBufferWrapper packet, final int offset) {
+		if (!OPTIMIZED && packet == null) throw new NullPointerException("The parameter 'packet' MUST NOT be null.");
+		val ihl = headerLength(packet.getByte(offset));
+		val tcp = offset + ihl;
+		val length = (getNetworkShort(packet, offset + IP_LENGTH_OFFSET) & MASK) - ihl;
+		val pseudo = pseudoHeader(getNetworkInt(packet, offset + IP_SRC_OFFSET),
+				getNetworkInt(packet, offset + IP_DEST_OFFSET), PROTOCOL_TCP, length);
+		packet.putShort(tcp + TCP_CHECKSUM_OFFSET, (short) 0);
+		val checksum = finish(sum(packet.getVirtualAddress() + PAYLOAD_OFFSET + tcp, length, pseudo));
+		putNetworkShort(packet, tcp + TCP_CHECKSUM_OFFSET, checksum);
+		return checksum;
+	}
+
+	/**
+	 * Prepares an IPv4 packet stored in the payload of a packet to let the NIC insert its checksums when it is sent.
+	 * <p>
+	 * The IPv4 checksum is cleared and, when the packet transports a UDP datagram or a TCP segment, its checksum is
+	 * replaced with the sum of the pseudo header, which the NIC completes with the sum of the datagram or segment. The
+	 * offloads are then requested in the header of the packet buffer.
+	 *
+	 * @param packet The packet.
+	 * @param offset The offset of the IPv4 header inside the payload, which is the length of the layer 2 header.
+	 * @return The offload flags of the packet.
+	 */
+	public static int offload(final @NotNull PacketBufferWrapper packet, final int offset) {
+		if (!OPTIMIZED && packet == null) throw new NullPointerException("The parameter 'packet' MUST NOT be null.");
+		val ihl = headerLength(packet.getByte(offset));
+		val l4 = offset + ihl;
+		val protocol = packet.getByte(offset + IP_PROTOCOL_OFFSET) & 0xFF;
+		packet.putShort(offset + IP_CHECKSUM_OFFSET, (short) 0);
+		var flags = OFL_IP_CHECKSUM;
+		var l4Length = 0;
+		if (protocol == PROTOCOL_UDP || protocol == PROTOCOL_TCP) {
+			val udp = protocol == PROTOCOL_UDP;
+			val length = udp
+					? getNetworkShort(packet, l4 + UDP_LENGTH_OFFSET) & MASK
+					: (getNetworkShort(packet, offset + IP_LENGTH_OFFSET) & MASK) - ihl;
+			val pseudo = pseudoHeader(getNetworkInt(packet, offset + IP_SRC_OFFSET),
+					getNetworkInt(packet, offset + IP_DEST_OFFSET), protocol, length);
+			putNetworkShort(packet, l4 + (udp ? UDP_CHECKSUM_OFFSET : TCP_CHECKSUM_OFFSET), (short) pseudo);
+			flags |= udp ? OFL_UDP_CHECKSUM : OFL_TCP_CHECKSUM;
+			l4Length = udp ? UDP_HEADER_LENGTH : tcpHeaderLength(packet.getByte(l4 + TCP_DATA_OFFSET_OFFSET));
+		}
+		val offload = PacketBufferWrapper.offload(offset, ihl, l4Length, flags);
+		packet.setOffload(offload);
+		return offload;
+	}
+
+	/**
+	 * Prepares an IPv4 packet stored in a {@code byte[]} to let the NIC insert its checksums when it is sent.
+	 * <p>
+	 * This is useful to prepare a template that is copied to many packets, which then only need the returned offload
+	 * flags to be set with {@link PacketBufferWrapper#setOffload(int)}.
+	 *
+	 * @param data   The data.
+	 * @param offset The offset of the IPv4 header, which is the length of the layer 2 header.
+	 * @return The offload flags of the packet.
+	 * @see #offload(PacketBufferWrapper, int)
+	 */
+	public static int offload(final @NotNull byte[] data, final int offset) {
+		if (!OPTIMIZED && data == null) throw new NullPointerException("The parameter 'data' MUST NOT be null.");
+		val ihl = headerLength(data[offset]);
+		val l4 = offset + ihl;
+		val protocol = data[offset + IP_PROTOCOL_OFFSET] & 0xFF;
+		putNetworkShort(data, offset + IP_CHECKSUM_OFFSET, (short) 0);
+		var flags = OFL_IP_CHECKSUM;
+		var l4Length = 0;
+		if (protocol == PROTOCOL_UDP || protocol == PROTOCOL_TCP) {
+			val udp = protocol == PROTOCOL_UDP;
+			val length = udp
+					? getNetworkShort(data, l4 + UDP_LENGTH_OFFSET) & MASK
+					: (getNetworkShort(data, offset + IP_LENGTH_OFFSET) & MASK) - ihl;
+			val pseudo = pseudoHeader(getNetworkInt(data, offset + IP_SRC_OFFSET),
+					getNetworkInt(data, offset + IP_DEST_OFFSET), protocol, length);
+			putNetworkShort(data, l4 + (udp ? UDP_CHECKSUM_OFFSET : TCP_CHECKSUM_OFFSET), (short) pseudo);
+			flags |= udp ? OFL_UDP_CHECKSUM : OFL_TCP_CHECKSUM;
+			l4Length = udp ? UDP_HEADER_LENGTH : tcpHeaderLength(data[l4 + TCP_DATA_OFFSET_OFFSET]);
+		}
+		return PacketBufferWrapper.offload(offset, ihl, l4Length, flags);
+	}
+
+	/**
+	 * Prepares a TCP over IPv4 packet stored in the payload of a packet to let the NIC split it in segments of at most
+	 * {@code mss} bytes of TCP payload when it is sent.
+	 * <p>
+	 * The NIC rewrites the total length of the IPv4 header and the length of the pseudo header of every segment, so the
+	 * checksum of the TCP header is replaced with the sum of the pseudo header without the length. The packet may be
+	 * stored in a chain of packet buffers, but the headers must be in the first one.
+	 *
+	 * @param packet The first packet buffer of the packet.
+	 * @param offset The offset of the IPv4 header inside the payload, which is the length of the layer 2 header.
+	 * @param mss    The maximum segment size.
+	 * @return The offload flags of the packet.
+	 */
+	public static int segmentation(final @NotNull PacketBufferWrapper packet, final int offset, final int mss) {
+		if (!OPTIMIZED) {
+			if (packet == null) throw new NullPointerException("The parameter 'packet' MUST NOT be null.");
+			if (mss <= 0 || mss > MASK) {
+				throw new IllegalArgumentException("The parameter 'mss' MUST be inside [1, 65535].");
+			}
+			if ((packet.getByte(offset + IP_PROTOCOL_OFFSET) & 0xFF) != PROTOCOL_TCP) {
+				throw new IllegalArgumentException("The packet MUST transport a TCP segment.");
+			}
+		}
+		val ihl = headerLength(packet.getByte(offset));
+		val l4 = offset + ihl;
+		packet.putShort(offset + IP_CHECKSUM_OFFSET, (short) 0);
+		val pseudo = pseudoHeader(getNetworkInt(packet, offset + IP_SRC_OFFSET),
+				getNetworkInt(packet, offset + IP_DEST_OFFSET), PROTOCOL_TCP, 0);
+		putNetworkShort(packet, l4 + TCP_CHECKSUM_OFFSET, (short) pseudo);
+		val l4Length = tcpHeaderLength(packet.getByte(l4 + TCP_DATA_OFFSET_OFFSET));
+		val offload = PacketBufferWrapper.offload(offset, ihl, l4Length, OFL_IP_CHECKSUM | OFL_TCP_CHECKSUM | OFL_TSO);
+		packet.setOffload(offload);
+		packet.setMss(mss);
+		return offload;
+	}
+
+	/**
+	 * Reads a {@code short} stored in network byte order from the payload of a packet.
+	 *
+	 * @param packet The packet.
+	 * @param offset The offset inside the payload.
+	 * @return The {@code short}.
+	 */
+	@Contract(pure = true)
+	public static short getNetworkShort(final @NotNull PacketBufferWrapper packet, final int offset) {
+		val value = packet.getShort(offset);
+		return LITTLE_ENDIAN ? Short.reverseBytes(value) : value;
+	}
+
+	/**
+	 * Writes a {@code short} in network byte order to the payload of a packet.
+	 *
+	 * @param packet The packet.
+	 * @param offset The offset inside the payload.
+	 * @param value  The {@code short}.
+	 */
+	public static void putNetworkShort(final @NotNull PacketBufferWrapper packet, final int offset, final short value) {
+		packet.putShort(offset, LITTLE_ENDIAN ? Short.reverseBytes(value) : value);
+	}
+
+	/**
+	 * Computes the sum of a memory region a {@code long} at a time.
+	 *
+	 * @param address The address of the memory region.
+	 * @param bytes   The size of the memory region.
+	 * @return The unfolded sum in native byte order.
+	 */
+	private static long sumWords(final long address, final int bytes) {
+		var sum = 0L;
+		var i = 0;
+		for (; i + Long.BYTES <= bytes; i += Long.BYTES) {
+			val word = mmanager.getLong(address + i);
+			sum += (word & INT_MASK) + (word >>> Integer.SIZE);
+		}
+		if (i + Integer.BYTES <= bytes) {
+			sum += mmanager.getInt(address + i) & INT_MASK;
+			i += Integer.BYTES;
+		}
+		if (i + Short.BYTES <= bytes) {
+			sum += mmanager.getShort(address + i) & MASK;
+			i += Short.BYTES;
+		}
+		if (i < bytes) {
+			val last = mmanager.getByte(address + i) & 0xFF;
+			sum += LITTLE_ENDIAN ? last : last << Byte.SIZE;
+		}
+		return sum;
+	}
+
+	/**
+	 * Swaps the bytes of a 16 bit value.
+	 *
+	 * @param value The 16 bit value.
+	 * @return The swapped 16 bit value.
+	 */
+	@Contract(pure = true)
+	private static int swap(final int value) {
+		return Integer.reverseBytes(value) >>> Short.SIZE;
+	}
+
+	/**
+	 * Computes the length in bytes of an IPv4 header.
+	 *
+	 * @param versionIhl The first byte of the IPv4 header, which contains the version and the IHL fields.
+	 * @return The length of the header.
+	 */
+	@Contract(pure = true)
+	private static int headerLength(final byte versionIhl) {
+		return (versionIhl & 0x0F) * Integer.BYTES;
+	}
+
+	/**
+	 * Computes the length in bytes of a TCP header.
+	 *
+	 * @param dataOffset The byte of the TCP header that contains the data offset field.
+	 * @return The length of the header.
+	 */
+	@Contract(pure = true)
+	private static int tcpHeaderLength(final byte dataOffset) {
+		return ((dataOffset & 0xF0) >>> 4) * Integer.BYTES;
+	}
+
+	/**
+	 * Converts a sum into a UDP checksum, which is never {@code 0x0000}.
+	 *
+	 * @param sum The sum.
+	 * @return The checksum.
+	 */
+	@Contract(pure = true)
+	private static short udpChecksum(final int sum) {
+		val checksum = finish(sum);
+		return checksum == 0 ? (short) MASK : checksum;
+	}
+
+	/**
+	 * Reads an {@code int} stored in network byte order from the payload of a packet.
+	 *
+	 * @param packet The packet.
+	 * @param offset The offset inside the payload.
+	 * @return The {@code int}.
+	 */
+	@Contract(pure = true)
+	private static int getNetworkInt(final @NotNull PacketBufferWrapper packet, final int offset) {
+		val value = packet.getInt(offset);
+		return LITTLE_ENDIAN ? Integer.reverseBytes(value) : value;
+	}
+
+	/**
+	 * Reads a {@code short} stored in network byte order from a {@code byte[]}.
+	 *
+	 * @param data   The data.
+	 * @param offset The offset.
+	 * @return The {@code short}.
+	 */
+	@Contract(pure = true)
+	private static short getNetworkShort(final @NotNull byte[] data, final int offset) {
+		return (short) (((data[offset] & 0xFF) << Byte.SIZE) | (data[offset + 1] & 0xFF));
+	}
+
+	/**
+	 * Reads an {@code int} stored in network byte order from a {@code byte[]}.
+	 *
+	 * @param data   The data.
+	 * @param offset The offset.
+	 * @return The {@code int}.
+	 */
+	@Contract(pure = true)
+	private static int getNetworkInt(final @NotNull byte[] data, final int offset) {
+		return (getNetworkShort(data, offset) << Short.SIZE) | (getNetworkShort(data, offset + Short.BYTES) & MASK);
+	}
+
+	/**
+	 * Writes a {@code short} in network byte order to a {@code byte[]}.
+	 *
+	 * @param data   The data.
+	 * @param offset The offset.
+	 * @param value  The {@code short}.
+	 */
+	private static void putNetworkShort(final @NotNull byte[] data, final int offset, final short value) {
+		data[offset] = (byte) (value >> Byte.SIZE);
+		data[offset + 1] = (byte) value;
+	}
+
+}
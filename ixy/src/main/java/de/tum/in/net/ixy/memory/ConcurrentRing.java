@@ -0,0 +1,181 @@
+package de.tum.in.net.ixy.memory;
+
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.atomic.AtomicLongArray;
+import java.util.concurrent.atomic.AtomicReferenceArray;
+
+import lombok.ToString;
+import lombok.val;
+
+import org.jetbrains.annotations.Contract;
+import org.jetbrains.annotations.NotNull;
+import org.jetbrains.annotations.Nullable;
+
+import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+
+/**
+ * A lock-free, bounded, multi-producer/multi-consumer ring for packet buffer wrappers.
+ * <p>
+ * Every slot has a sequence number that tells producers and consumers whether the slot can be written or read, so
+ * the only contended operations are the compare-and-swap of the head and the tail.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@ToString(doNotUseGetters = true, onlyExplicitlyIncluded = true)
+final class ConcurrentRing {
+
+	///////////////////////////////////////////////// MEMBER VARIABLES /////////////////////////////////////////////////
+
+	/** The capacity of the ring, which is always a power of two. */
+	@ToString.Include(rank = 2)
+	private final int capacity;
+
+	/** The mask used to compute the slot of a position. */
+	private final int mask;
+
+	/** The internal data store. */
+	private final @NotNull AtomicReferenceArray<PacketBufferWrapper> buffers;
+
+	/** The sequence number of every slot. */
+	private final @NotNull AtomicLongArray sequences;
+
+	/** The position of the next slot to read. */
+	@ToString.Include(rank = 1)
+	private final @NotNull AtomicLong head = new AtomicLong();
+
+	/** The position of the next slot to write. */
+	@ToString.Include(rank = 0)
+	private final @NotNull AtomicLong tail = new AtomicLong();
+
+	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Initializes the internal store with, at least, the given capacity.
+	 *
+	 * @param capacity The minimum capacity.
+	 */
+	ConcurrentRing(final int capacity) {
+		if (!OPTIMIZED && capacity <= 0) throw new IllegalArgumentException("The parameter 'capacity' MUST be positive.");
+		this.capacity = capacity == 1 ? 1 : Integer.highestOneBit(capacity - 1) << 1;
+		mask = this.capacity - 1;
+		buffers = new AtomicReferenceArray<>(this.capacity);
+		sequences = new AtomicLongArray(this.capacity);
+		for (var i = 0; i < this.capacity; i += 1) sequences.set(i, i);
+	}
+
+	/**
+	 * Inserts a {@link PacketBufferWrapper packet buffer wrapper}.
+	 *
+	 * @param packetBufferWrapper The packet buffer wrapper.
+	 * @return Whether the packet buffer wrapper could be inserted.
+	 */
+	boolean offer(final @NotNull PacketBufferWrapper packetBufferWrapper) {
+		if (!OPTIMIZED && packetBufferWrapper == null) {
+			throw new NullPointerException("The parameter 'packetBufferWrapper' MUST NOT be null.");
+		}
+		var position = tail.get();
+		while (true) {
+			val slot = (int) position & mask;
+			val diff = sequences.get(slot) - position;
+			if (diff == 0) {
+				if (tail.compareAndSet(position, position + 1)) {
+					buffers.lazySet(slot, packetBufferWrapper);
+					sequences.set(slot, position + 1);
+					return true;
+				}
+				position = tail.get();
+			} else if (diff < 0) {
+				return false;
+			} else {
+				position = tail.get();
+			}
+		}
+	}
+
+	/**
+	 * Removes a {@link PacketBufferWrapper packet buffer wrapper}.
+	 *
+	 * @return The packet buffer wrapper or {@code null} if the ring is empty.
+	 */
+	@Nullable PacketBufferWrapper poll() {
+		var position = head.get();
+		while (true) {
+			val slot = (int) position & mask;
+			val diff = sequences.get(slot) - (position + 1);
+			if (diff == 0) {
+				if (head.compareAndSet(position, position + 1)) {
+					val packetBufferWrapper = buffers.get(slot);
+					buffers.lazySet(slot, null);
+					sequences.set(slot, position + capacity);
+					return packetBufferWrapper;
+				}
+				position = head.get();
+			} else if (diff < 0) {
+				return null;
+			} else {
+				position = head.get();
+			}
+		}
+	}
+
+	/**
+	 * Inserts up to {@code size} packet buffer wrappers from the parameter {@code src}, starting at the index {@code
+	 * offset}.
+	 *
+	 * @param src    The packet buffer wrappers.
+	 * @param offset The offset to start reading from.
+	 * @param size   The number of packet buffer wrappers.
+	 * @return The number of inserted packet buffer wrappers.
+	 */
+	int offer(final @NotNull PacketBufferWrapper[] src, final int offset, final int size) {
+		var count = 0;
+		while (count < size && offer(src[offset + count])) count += 1;
+		return count;
+	}
+
+	/**
+	 * Removes up to {@code size} packet buffer wrappers and stores them in the parameter {@code dest}, starting at the
+	 * index {@code offset}.
+	 *
+	 * @param dest   The array where the packet buffer wrappers will be stored.
+	 * @param offset The offset to start storing to.
+	 * @param size   The maximum number of packet buffer wrappers.
+	 * @return The number of removed packet buffer wrappers.
+	 */
+	@Contract(mutates = "param1")
+	int poll(final @NotNull PacketBufferWrapper[] dest, final int offset, final int size) {
+		var count = 0;
+		while (count < size) {
+			val packetBufferWrapper = poll();
+			if (packetBufferWrapper == null) break;
+			dest[offset + count++] = packetBufferWrapper;
+		}
+		return count;
+	}
+
+	//////////////////////////////////////////////// COLLECTION METHODS ////////////////////////////////////////////////
+
+	/**
+	 * Returns the capacity of the ring.
+	 *
+	 * @return The capacity of the ring.
+	 */
+	@Contract(pure = true)
+	int capacity() {
+		return capacity;
+	}
+
+	/**
+	 * Returns the size of the ring.
+	 * <p>
+	 * The result is only a snapshot when other threads are using the ring.
+	 *
+	 * @return The size of the ring.
+	 */
+	@Contract(pure = true)
+	int size() {
+		val size = tail.get() - head.get();
+		return (int) Math.max(0, Math.min(size, capacity));
+	}
+
+}
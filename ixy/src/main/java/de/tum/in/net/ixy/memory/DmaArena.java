@@ -0,0 +1,363 @@
+package de.tum.in.net.ixy.memory;
+
+import java.util.Arrays;
+
+import lombok.Getter;
+import lombok.ToString;
+import lombok.extern.slf4j.Slf4j;
+import lombok.val;
+
+import org.jetbrains.annotations.Contract;
+import org.jetbrains.annotations.NotNull;
+
+import static de.tum.in.net.ixy.BuildConfig.DEBUG;
+import static de.tum.in.net.ixy.BuildConfig.LOG_DEBUG;
+import static de.tum.in.net.ixy.BuildConfig.LOG_ERROR;
+import static de.tum.in.net.ixy.BuildConfig.LOG_TRACE;
+import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+import static de.tum.in.net.ixy.utils.Strings.leftPad;
+
+/**
+ * An arena of DMA memory that reserves big regions backed by huge memory pages and hands out chunks of them.
+ * <p>
+ * Descriptor rings and memory pools are allocated once and live as long as the device does, so instead of creating a
+ * {@code hugetlbfs} file and a mapping per allocation, the arena reserves regions of several huge memory pages and
+ * sub-allocates aligned chunks with a bump pointer. Individual chunks are never released; {@link #free()} releases
+ * all the regions at once.
+ * <p>
+ * Huge memory pages are the only physically contiguous unit, so a chunk that fits in a huge memory page never crosses
+ * a huge memory page boundary, and bigger chunks start at one. If the memory manager does not support huge memory pages
+ * the regular memory page is used instead. An arena can also be backed by huge memory pages of a specific size, which
+ * lets big memory pools use bigger huge memory pages than the descriptor rings, and bound to a NUMA node, which keeps
+ * the memory close to the NIC that accesses it.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@Slf4j
+@ToString(onlyExplicitlyIncluded = true, doNotUseGetters = true)
+@SuppressWarnings({"ConstantConditions", "PMD.AvoidDuplicateLiterals"})
+public final class DmaArena {
+
+	///////////////////////////////////////////////// STATIC VARIABLES /////////////////////////////////////////////////
+
+	/** The default number of bytes reserved at once, unless a single huge memory page is bigger. */
+	private static final long DEFAULT_REGION_BYTES = 32 * 1024 * 1024;
+
+	/** The initial capacity of the region registry. */
+	private static final int INITIAL_REGIONS = 4;
+
+	///////////////////////////////////////////////// MEMBER VARIABLES /////////////////////////////////////////////////
+
+	/** The memory manager used to reserve the regions. */
+	private final @NotNull MemoryManager mmanager;
+
+	/**
+	 * Whether the regions are backed by huge memory pages.
+	 * -- GETTER --
+	 * Returns whether the regions are backed by huge memory pages.
+	 *
+	 * @return Whether the regions are backed by huge memory pages.
+	 */
+	@Getter
+	@ToString.Include(rank = 8)
+	private final boolean huge;
+
+	/** The explicit size of the huge memory pages that back the regions, or {@code 0} to use the default size. */
+	private final long pagesize;
+
+	/**
+	 * The NUMA node the regions are bound to, or {@code -1} if the default memory policy is used.
+	 * -- GETTER --
+	 * Returns the NUMA node the regions are bound to.
+	 *
+	 * @return The NUMA node or {@code -1} if the default memory policy is used.
+	 */
+	@Getter
+	@ToString.Include(rank = 9)
+	private final int node;
+
+	/**
+	 * The size of the physically contiguous unit of memory, which is the huge memory page size if supported.
+	 * -- GETTER --
+	 * Returns the size of the physically contiguous unit of memory.
+	 *
+	 * @return The size of the physically contiguous unit of memory.
+	 */
+	@Getter
+	@ToString.Include(rank = 7)
+	private final long granularity;
+
+	/**
+	 * The size of a regular region.
+	 * -- GETTER --
+	 * Returns the size of a regular region.
+	 *
+	 * @return The size of a regular region.
+	 */
+	@Getter
+	@ToString.Include(rank = 6)
+	private final long regionSize;
+
+	/** The base virtual addresses of the reserved regions. */
+	private @NotNull long[] bases = new long[INITIAL_REGIONS];
+
+	/** The sizes of the reserved regions. */
+	private @NotNull long[] sizes = new long[INITIAL_REGIONS];
+
+	/**
+	 * The number of reserved regions.
+	 * -- GETTER --
+	 * Returns the number of reserved regions.
+	 *
+	 * @return The number of reserved regions.
+	 */
+	@Getter
+	@ToString.Include(rank = 5)
+	private int regions;
+
+	/** The base virtual address of the region chunks are being allocated from, or {@code 0} if there is none. */
+	private long current;
+
+	/** The size of the region chunks are being allocated from. */
+	private long currentSize;
+
+	/** The offset of the first free byte of the region chunks are being allocated from. */
+	private long cursor;
+
+	/**
+	 * The number of reserved bytes.
+	 * -- GETTER --
+	 * Returns the number of reserved bytes.
+	 *
+	 * @return The number of reserved bytes.
+	 */
+	@Getter
+	@ToString.Include(rank = 4)
+	private long reserved;
+
+	/**
+	 * The number of bytes handed out.
+	 * -- GETTER --
+	 * Returns the number of bytes handed out.
+	 *
+	 * @return The number of bytes handed out.
+	 */
+	@Getter
+	@ToString.Include(rank = 3)
+	private long used;
+
+	/**
+	 * The number of bytes lost to alignment, huge memory page boundaries and the unused tail of retired regions.
+	 * -- GETTER --
+	 * Returns the number of bytes lost to alignment, huge memory page boundaries and the unused tail of retired
+	 * regions.
+	 *
+	 * @return The number of wasted bytes.
+	 */
+	@Getter
+	@ToString.Include(rank = 2)
+	private long wasted;
+
+	/**
+	 * The number of chunks handed out.
+	 * -- GETTER --
+	 * Returns the number of chunks handed out.
+	 *
+	 * @return The number of chunks handed out.
+	 */
+	@Getter
+	@ToString.Include(rank = 1)
+	private int allocations;
+
+	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Creates an arena that reserves regions of {@value #DEFAULT_REGION_BYTES} bytes or a single huge memory page,
+	 * whatever is bigger.
+	 *
+	 * @param mmanager The memory manager.
+	 */
+	public DmaArena(final @NotNull MemoryManager mmanager) {
+		this(mmanager, 0);
+	}
+
+	/**
+	 * Creates an arena that reserves regions of the given size, rounded up to the huge memory page size.
+	 *
+	 * @param mmanager   The memory manager.
+	 * @param regionSize The size of a region, or {@code 0} to use the default.
+	 */
+	public DmaArena(final @NotNull MemoryManager mmanager, final long regionSize) {
+		this(mmanager, regionSize, 0);
+	}
+
+	/**
+	 * Creates an arena backed by huge memory pages of the given size that reserves regions of the given size, rounded
+	 * up to the huge memory page size.
+	 *
+	 * @param mmanager   The memory manager.
+	 * @param regionSize The size of a region, or {@code 0} to use the default.
+	 * @param pagesize   The size of the huge memory pages, or {@code 0} to use the default size.
+	 */
+	public DmaArena(final @NotNull MemoryManager mmanager, final long regionSize, final long pagesize) {
+		this(mmanager, regionSize, pagesize, -1);
+	}
+
+	/**
+	 * Creates an arena backed by huge memory pages of the given size and bound to a NUMA node that reserves regions of
+	 * the given size, rounded up to the huge memory page size.
+	 * <p>
+	 * Only regions backed by huge memory pages can be bound to a NUMA node.
+	 *
+	 * @param mmanager   The memory manager.
+	 * @param regionSize The size of a region, or {@code 0} to use the default.
+	 * @param pagesize   The size of the huge memory pages, or {@code 0} to use the default size.
+	 * @param node       The NUMA node, or {@code -1} to use the default memory policy.
+	 */
+	public DmaArena(final @NotNull MemoryManager mmanager, final long regionSize, final long pagesize, final int node) {
+		if (!OPTIMIZED) {
+			if (mmanager == null) throw new NullPointerException("The parameter 'mmanager' MUST NOT be null.");
+			if (regionSize < 0) throw new IllegalArgumentException("The parameter 'regionSize' MUST NOT be negative.");
+			if (pagesize < 0 || Long.bitCount(pagesize) > 1) {
+				throw new IllegalArgumentException("The parameter 'pagesize' MUST be 0 or a power of two.");
+			}
+			if (node < -1) throw new IllegalArgumentException("The parameter 'node' MUST NOT be less than -1.");
+		}
+		this.mmanager = mmanager;
+		val hugepageSize = pagesize > 0 ? pagesize : mmanager.getHugepageSize();
+		huge = hugepageSize > 0;
+		this.pagesize = pagesize > 0 || huge && node >= 0 ? hugepageSize : 0;
+		this.node = huge ? node : -1;
+		granularity = huge ? hugepageSize : mmanager.getPageSize();
+		this.regionSize = align(regionSize == 0 ? DEFAULT_REGION_BYTES : regionSize, granularity);
+		if (DEBUG >= LOG_DEBUG) log.debug("Created DMA arena: {}", this);
+	}
+
+	/**
+	 * Allocates a chunk of DMA memory.
+	 * <p>
+	 * A chunk that fits in a huge memory page never crosses a huge memory page boundary, so its physical memory is
+	 * contiguous. Bigger chunks start at a huge memory page boundary.
+	 *
+	 * @param bytes     The number of bytes.
+	 * @param alignment The alignment of the chunk, which must be a power of two.
+	 * @return The DMA memory.
+	 */
+	@SuppressWarnings("PMD.AvoidSynchronizedAtMethodLevel")
+	public synchronized @NotNull DmaMemory allocate(final long bytes, final long alignment) {
+		if (!OPTIMIZED) {
+			if (bytes <= 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (alignment <= 0 || Long.bitCount(alignment) != 1) {
+				throw new IllegalArgumentException("The parameter 'alignment' MUST be a power of two.");
+			}
+		}
+
+		// Chunks bigger than a regular region get a dedicated region
+		if (bytes > regionSize) {
+			val size = align(bytes, granularity);
+			val base = reserve(size);
+			if (base != 0) wasted += size - bytes;
+			return chunk(base, bytes);
+		}
+
+		// Find the offset of the chunk in the current region
+		var offset = align(cursor, alignment);
+		if (bytes > granularity || offset / granularity != (offset + bytes - 1) / granularity) {
+			offset = align(offset, granularity);
+		}
+
+		// Retire the current region if the chunk does not fit
+		if (current == 0 || offset + bytes > currentSize) {
+			if (current != 0) wasted += currentSize - cursor;
+			val base = reserve(regionSize);
+			if (base == 0) return new DmaMemory(0, 0);
+			current = base;
+			currentSize = regionSize;
+			cursor = 0;
+			offset = 0;
+		}
+		wasted += offset - cursor;
+		cursor = offset + bytes;
+		return chunk(current + offset, bytes);
+	}
+
+	/** Releases all the reserved regions, which invalidates every chunk handed out by this arena. */
+	@SuppressWarnings("PMD.AvoidSynchronizedAtMethodLevel")
+	public synchronized void free() {
+		if (DEBUG >= LOG_DEBUG) log.debug("Releasing DMA arena: {}", this);
+		for (var i = 0; i < regions; i += 1) {
+			if (pagesize > 0) mmanager.free(bases[i], sizes[i], pagesize, true);
+			else mmanager.free(bases[i], sizes[i], huge, true);
+		}
+		regions = 0;
+		current = currentSize = cursor = 0;
+		reserved = used = wasted = 0;
+		allocations = 0;
+	}
+
+	/**
+	 * Returns the number of bytes of the current region that can still be handed out.
+	 *
+	 * @return The number of available bytes.
+	 */
+	@Contract(pure = true)
+	public synchronized long getAvailable() {
+		return currentSize - cursor;
+	}
+
+	///////////////////////////////////////////////// INTERNAL METHODS /////////////////////////////////////////////////
+
+	/**
+	 * Reserves a new region and registers it.
+	 *
+	 * @param bytes The size of the region.
+	 * @return The base virtual address of the region or {@code 0} if it could not be reserved.
+	 */
+	private long reserve(final long bytes) {
+		val base = pagesize > 0 ? mmanager.allocate(bytes, pagesize, true, node) : mmanager.allocate(bytes, huge, true);
+		if (base == 0) {
+			if (DEBUG >= LOG_ERROR) log.error("Could not reserve a region of {} bytes.", bytes);
+			return 0;
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Reserved region of {} bytes @ 0x{}.", bytes, leftPad(base));
+		if (regions == bases.length) {
+			bases = Arrays.copyOf(bases, regions * 2);
+			sizes = Arrays.copyOf(sizes, regions * 2);
+		}
+		bases[regions] = base;
+		sizes[regions] = bytes;
+		regions += 1;
+		reserved += bytes;
+		return base;
+	}
+
+	/**
+	 * Accounts a chunk as handed out and translates its address.
+	 *
+	 * @param virtual The virtual address of the chunk.
+	 * @param bytes   The size of the chunk.
+	 * @return The DMA memory.
+	 */
+	private @NotNull DmaMemory chunk(final long virtual, final long bytes) {
+		if (virtual == 0) return new DmaMemory(0, 0);
+		used += bytes;
+		allocations += 1;
+		mmanager.putByte(virtual, mmanager.getByte(virtual));
+		val dma = new DmaMemory(virtual, mmanager.virt2phys(virtual));
+		if (DEBUG >= LOG_TRACE) log.trace("Allocated chunk of {} bytes: {}", bytes, dma);
+		return dma;
+	}
+
+	/**
+	 * Rounds a number up to a multiple of a power of two.
+	 *
+	 * @param x         The number.
+	 * @param alignment The power of two.
+	 * @return The aligned number.
+	 */
+	@Contract(pure = true)
+	private static long align(final long x, final long alignment) {
+		return (x + alignment - 1) & -alignment;
+	}
+
+}
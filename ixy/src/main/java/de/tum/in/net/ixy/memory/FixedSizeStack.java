@@ -5,15 +5,14 @@ import lombok.val;
 
 import org.jetbrains.annotations.Contract;
 import org.jetbrains.annotations.NotNull;
-import org.jetbrains.annotations.Nullable;
 
 import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
 
 /**
- * A non-thread-safe fixed-size stack for packet buffer wrappers with little to no parameter checking.
+ * A non-thread-safe fixed-size stack for packet buffer virtual addresses with little to no parameter checking.
  * <p>
- * This class was used to debug an error with the memory pool, after solving the error it was tested and it offers no
- * noticeable speed up.
+ * The addresses are stored in a primitive array, so there is no pointer chasing involved and the bulk operations are
+ * simple array copies.
  *
  * @author Esaú García Sánchez-Torija
  */
@@ -27,7 +26,7 @@ final class FixedSizeStack {
 	private final int capacity;
 
 	/** The internal data store. */
-	private final PacketBufferWrapper[] buffers;
+	private final @NotNull long[] addresses;
 
 	/** The index of the stack. */
 	@ToString.Include(rank = 1)
@@ -42,36 +41,64 @@ final class FixedSizeStack {
 	 */
 	FixedSizeStack(final int capacity) {
 		this.capacity = capacity;
-		buffers = new PacketBufferWrapper[capacity];
+		addresses = new long[capacity];
 	}
 
 	/**
-	 * Pushes a new {@link PacketBufferWrapper packet buffer wrapper}.
+	 * Pushes a new packet buffer virtual address.
 	 *
-	 * @param packetBufferWrapper The packet buffer wrapper.
+	 * @param address The packet buffer virtual address.
 	 */
-	void push(final @NotNull PacketBufferWrapper packetBufferWrapper) {
+	void push(final long address) {
 		if (!OPTIMIZED) {
-			if (packetBufferWrapper == null) throw new IllegalArgumentException("Null packets are not accepted.");
+			if (address == 0) throw new IllegalArgumentException("Null addresses are not accepted.");
 			if (top >= capacity - 1) throw new IllegalStateException("The stack is full.");
 		}
-		buffers[++top] = packetBufferWrapper;
+		addresses[++top] = address;
 	}
 
 	/**
-	 * Pops a new {@link PacketBufferWrapper packet buffer wrapper}.
+	 * Pops a packet buffer virtual address.
 	 *
-	 * @return The packet buffer wrapper.
+	 * @return The packet buffer virtual address or {@code 0} if the stack is empty.
 	 */
-	@Nullable PacketBufferWrapper pop() {
-		if (top < 0) return null;
-		if (OPTIMIZED) {
-			return buffers[top--];
-		} else {
-			val packetBufferWrapper = buffers[top];
-			buffers[top--] = null;
-			return packetBufferWrapper;
-		}
+	long pop() {
+		return top < 0 ? 0 : addresses[top--];
+	}
+
+	/**
+	 * Pushes up to {@code size} packet buffer virtual addresses from the parameter {@code src}, starting at the index
+	 * {@code offset}.
+	 *
+	 * @param src    The packet buffer virtual addresses.
+	 * @param offset The offset to start reading from.
+	 * @param size   The number of packet buffer virtual addresses.
+	 * @return The number of pushed packet buffer virtual addresses.
+	 */
+	int push(final @NotNull long[] src, final int offset, final int size) {
+		val count = Math.min(size, capacity - top - 1);
+		System.arraycopy(src, offset, addresses, top + 1, count);
+		top += count;
+		return count;
+	}
+
+	/**
+	 * Pops up to {@code size} packet buffer virtual addresses and stores them in the parameter {@code dest}, starting at
+	 * the index {@code offset}.
+	 * <p>
+	 * The addresses are copied in the same order they are stored, that is, the top of the stack is the last one.
+	 *
+	 * @param dest   The array where the packet buffer virtual addresses will be stored.
+	 * @param offset The offset to start storing to.
+	 * @param size   The maximum number of packet buffer virtual addresses.
+	 * @return The number of popped packet buffer virtual addresses.
+	 */
+	@Contract(mutates = "param1")
+	int pop(final @NotNull long[] dest, final int offset, final int size) {
+		val count = Math.min(size, top + 1);
+		top -= count;
+		System.arraycopy(addresses, top + 1, dest, offset, count);
+		return count;
 	}
 
 	//////////////////////////////////////////////// COLLECTION METHODS ////////////////////////////////////////////////
@@ -0,0 +1,100 @@
+package de.tum.in.net.ixy.memory;
+
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.DirectoryStream;
+import java.nio.file.Files;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.Arrays;
+import java.util.regex.Pattern;
+
+import lombok.AccessLevel;
+import lombok.NoArgsConstructor;
+import lombok.extern.slf4j.Slf4j;
+import lombok.val;
+
+import org.jetbrains.annotations.Contract;
+import org.jetbrains.annotations.NotNull;
+
+import static de.tum.in.net.ixy.BuildConfig.DEBUG;
+import static de.tum.in.net.ixy.BuildConfig.LOG_DEBUG;
+import static de.tum.in.net.ixy.BuildConfig.LOG_ERROR;
+
+import static java.io.File.separator;
+
+/**
+ * Enumerates the huge memory page sizes supported by Linux' {@code /sys/kernel/mm/hugepages} directory.
+ * <p>
+ * The kernel publishes a directory named {@code hugepages-<size>kB} for every huge memory page size the CPU supports,
+ * each of them with the counters of its own pool. Only the pools that have free or overcommittable pages are
+ * reported, because huge memory pages of the rest cannot be reserved.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@Slf4j
+@NoArgsConstructor(access = AccessLevel.PRIVATE)
+final class Hugepages {
+
+	//////////////////////////////////////////////////// FILE PATHS ////////////////////////////////////////////////////
+
+	/** The directory of the huge memory page pools. */
+	private static final @NotNull String HUGEPAGES_PATH =
+			separator + String.join(separator, "sys", "kernel", "mm", "hugepages");
+
+	///////////////////////////////////////////////// STATIC VARIABLES /////////////////////////////////////////////////
+
+	/** The pattern of the name of a huge memory page pool directory. */
+	private static final @NotNull Pattern POOL_PATTERN = Pattern.compile("hugepages-(\\d+)kB");
+
+	/** The factor of 2^10 used for {K,M,G,T}iB units. */
+	private static final int K_FACTOR = 1024;
+
+	////////////////////////////////////////////////// STATIC METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Returns the sizes of the huge memory pages that can be reserved, in ascending order.
+	 *
+	 * @return The huge memory page sizes.
+	 */
+	@Contract(value = " -> new", pure = true)
+	@SuppressWarnings("PMD.DataflowAnomalyAnalysis")
+	static @NotNull long[] available() {
+		if (DEBUG >= LOG_DEBUG) log.debug("Listing directory '{}'.", HUGEPAGES_PATH);
+		var sizes = new long[0];
+		try (DirectoryStream<Path> pools = Files.newDirectoryStream(Paths.get(HUGEPAGES_PATH))) {
+			for (val pool : pools) {
+				val matcher = POOL_PATTERN.matcher(pool.getFileName().toString());
+				if (!matcher.matches()) continue;
+				if (counter(pool, "free_hugepages") <= 0 && counter(pool, "nr_overcommit_hugepages") <= 0) continue;
+				sizes = Arrays.copyOf(sizes, sizes.length + 1);
+				sizes[sizes.length - 1] = Long.parseLong(matcher.group(1)) * K_FACTOR;
+			}
+		} catch (final NoSuchFileException e) {
+			if (DEBUG >= LOG_DEBUG) log.debug("The directory '{}' does not exist.", HUGEPAGES_PATH);
+		} catch (final IOException e) {
+			if (DEBUG >= LOG_ERROR) log.error("The directory '{}' cannot be listed.", HUGEPAGES_PATH, e);
+		}
+		Arrays.sort(sizes);
+		return sizes;
+	}
+
+	/**
+	 * Reads a counter of a huge memory page pool.
+	 *
+	 * @param pool The directory of the pool.
+	 * @param name The name of the counter.
+	 * @return The value of the counter or {@code 0} if it cannot be read.
+	 */
+	@Contract(pure = true)
+	private static long counter(final @NotNull Path pool, final @NotNull String name) {
+		try {
+			return Long.parseLong(new String(Files.readAllBytes(pool.resolve(name)), StandardCharsets.US_ASCII).trim());
+		} catch (final IOException | NumberFormatException e) {
+			if (DEBUG >= LOG_ERROR) log.error("The counter '{}' of '{}' cannot be read.", name, pool, e);
+		}
+		return 0;
+	}
+
+}
@@ -7,7 +7,11 @@ import java.io.FileDescriptor;
 import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.io.RandomAccessFile;
+import java.nio.ByteBuffer;
+import java.nio.ReadOnlyBufferException;
+import java.util.Arrays;
 
+import lombok.AccessLevel;
 import lombok.EqualsAndHashCode;
 import lombok.Getter;
 import lombok.ToString;
@@ -20,6 +24,7 @@ import org.jetbrains.annotations.Nullable;
 
 import static de.tum.in.net.ixy.BuildConfig.DEBUG;
 import static de.tum.in.net.ixy.BuildConfig.DEFAULT_HUGEPAGE_PATH;
+import static de.tum.in.net.ixy.BuildConfig.DEFAULT_HUGEPAGE_SIZE;
 import static de.tum.in.net.ixy.BuildConfig.LOG_TRACE;
 import static de.tum.in.net.ixy.BuildConfig.LOG_WARN;
 import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
@@ -27,6 +32,10 @@ import static de.tum.in.net.ixy.utils.Strings.leftPad;
 
 /**
  * Implementation of a memory manager backed up by {@code native} methods.
+ * <p>
+ * The {@code native} methods are registered when the library is loaded, and the scalar accessors are also exported as
+ * critical natives, which HotSpot calls from compiled code without the thread state transitions of a regular JNI call
+ * as long as {@code -XX:+CriticalJNINatives} is enabled (the default on x86_64).
  *
  * @author Esaú García Sánchez-Torija
  */
@@ -38,6 +47,12 @@ public class JniMemoryManager implements MemoryManager {
 
 	///////////////////////////////////////////////// STATIC VARIABLES /////////////////////////////////////////////////
 
+	/** The size of the huge memory pages tried when the preferred size cannot be reserved. */
+	private static final long FALLBACK_HUGEPAGE_SIZE = 2 * 1024 * 1024;
+
+	/** The maximum number of huge memory page sizes that can be listed. */
+	private static final int MAX_HUGEPAGE_SIZES = 8;
+
 	/**
 	 * A cached instance of this class.
 	 * -- GETTER --
@@ -86,11 +101,32 @@ public class JniMemoryManager implements MemoryManager {
 	 * When the OS does not support huge memory pages, {@code -1} is returned.
 	 * When there is a problem computing the huge memory page size, {@code 0} is returned.
 	 *
+	 * @param mnt The {@code hugetlbfs} mount point.
 	 * @return The size of a huge memory page.
 	 */
 	@Contract(pure = true)
 	@SuppressWarnings("checkstyle:MethodName")
-	private static native long c_hugepage_size();
+	private static native long c_hugepage_size(@NotNull String mnt);
+
+	/**
+	 * Returns whether an anonymous huge memory page of the given size can be reserved.
+	 *
+	 * @param size The size of the huge memory page.
+	 * @return Whether the huge memory page can be reserved.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native boolean c_hugepage_probe(long size);
+
+	/**
+	 * Stores the sizes of the huge memory pages that can be reserved, in ascending order.
+	 *
+	 * @param sizes The array where the sizes will be stored.
+	 * @return The number of sizes stored.
+	 */
+	@Contract(mutates = "param1")
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native int c_hugepage_sizes(@NotNull long[] sizes);
 
 	/**
 	 * Allocates raw bytes from the heap.
@@ -98,15 +134,32 @@ public class JniMemoryManager implements MemoryManager {
 	 * When the parameter {@code huge} is set to {@code true}, normal memory allocation will take place, usually
 	 * implemented with the C library function {@code malloc(size_t)}, and the parameter {@code mnt} will be ignored.
 	 *
-	 * @param bytes The number of bytes.
-	 * @param huge  Whether to enable huge memory pages.
-	 * @param lock  Whether to enable memory locking.
-	 * @param mnt   The {@code hugetlbfs} mount point.
+	 * <p>
+	 * When the parameter {@code pagesize} is positive, anonymous huge memory pages of that size are used instead of a
+	 * file of the {@code hugetlbfs} mount point.
+	 *
+	 * @param bytes    The number of bytes.
+	 * @param huge     Whether to enable huge memory pages.
+	 * @param lock     Whether to enable memory locking.
+	 * @param mnt      The {@code hugetlbfs} mount point.
+	 * @param pagesize The size of the anonymous huge memory pages, or {@code 0} to use the mount point.
+	 * @param node     The NUMA node the huge memory pages are bound to, or {@code -1} to use the default memory policy.
 	 * @return The memory region's base address.
 	 */
 	@Contract(pure = true)
 	@SuppressWarnings("checkstyle:MethodName")
-	private static native long c_allocate(long bytes, boolean huge, boolean lock, @Nullable String mnt);
+	private static native long c_allocate(long bytes, boolean huge, boolean lock, @Nullable String mnt, long pagesize,
+										  int node);
+
+	/**
+	 * Returns the NUMA node a memory region is bound to by its memory policy.
+	 *
+	 * @param address The memory region's base address.
+	 * @return The NUMA node or {@code -1} if the memory region is not bound to any.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native int c_numa_node(long address);
 
 	/**
 	 * Frees a previously allocated memory region.
@@ -227,6 +280,86 @@ public class JniMemoryManager implements MemoryManager {
 	@SuppressWarnings("checkstyle:MethodName")
 	private static native long c_get_long_volatile(long src);
 
+	/**
+	 * Reads a {@code byte} from an arbitrary virtual address with opaque semantics.
+	 *
+	 * @param src The virtual address.
+	 * @return The read {@code byte}.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native byte c_get_byte_opaque(long src);
+
+	/**
+	 * Reads a {@code short} from an arbitrary virtual address with opaque semantics.
+	 *
+	 * @param src The virtual address.
+	 * @return The read {@code short}.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native short c_get_short_opaque(long src);
+
+	/**
+	 * Reads an {@code int} from an arbitrary virtual address with opaque semantics.
+	 *
+	 * @param src The virtual address.
+	 * @return The read {@code int}.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native int c_get_int_opaque(long src);
+
+	/**
+	 * Reads a {@code long} from an arbitrary virtual address with opaque semantics.
+	 *
+	 * @param src The virtual address.
+	 * @return The read {@code long}.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native long c_get_long_opaque(long src);
+
+	/**
+	 * Reads a {@code byte} from an arbitrary virtual address with acquire semantics.
+	 *
+	 * @param src The virtual address.
+	 * @return The read {@code byte}.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native byte c_get_byte_acquire(long src);
+
+	/**
+	 * Reads a {@code short} from an arbitrary virtual address with acquire semantics.
+	 *
+	 * @param src The virtual address.
+	 * @return The read {@code short}.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native short c_get_short_acquire(long src);
+
+	/**
+	 * Reads an {@code int} from an arbitrary virtual address with acquire semantics.
+	 *
+	 * @param src The virtual address.
+	 * @return The read {@code int}.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native int c_get_int_acquire(long src);
+
+	/**
+	 * Reads a {@code long} from an arbitrary virtual address with acquire semantics.
+	 *
+	 * @param src The virtual address.
+	 * @return The read {@code long}.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native long c_get_long_acquire(long src);
+
 	/**
 	 * Writes a {@code byte} to an arbitrary virtual address.
 	 *
@@ -299,6 +432,78 @@ public class JniMemoryManager implements MemoryManager {
 	@SuppressWarnings("checkstyle:MethodName")
 	private static native void c_put_long_volatile(long dest, long value);
 
+	/**
+	 * Writes a {@code byte} to an arbitrary virtual address with opaque semantics.
+	 *
+	 * @param dest  The virtual address.
+	 * @param value The {@code byte} to write.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native void c_put_byte_opaque(long dest, byte value);
+
+	/**
+	 * Writes a {@code short} to an arbitrary virtual address with opaque semantics.
+	 *
+	 * @param dest  The virtual address.
+	 * @param value The {@code short} to write.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native void c_put_short_opaque(long dest, short value);
+
+	/**
+	 * Writes an {@code int} to an arbitrary virtual address with opaque semantics.
+	 *
+	 * @param dest  The virtual address.
+	 * @param value The {@code int} to write.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native void c_put_int_opaque(long dest, int value);
+
+	/**
+	 * Writes a {@code long} to an arbitrary virtual address with opaque semantics.
+	 *
+	 * @param dest  The virtual address.
+	 * @param value The {@code long} to write.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native void c_put_long_opaque(long dest, long value);
+
+	/**
+	 * Writes a {@code byte} to an arbitrary virtual address with release semantics.
+	 *
+	 * @param dest  The virtual address.
+	 * @param value The {@code byte} to write.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native void c_put_byte_release(long dest, byte value);
+
+	/**
+	 * Writes a {@code short} to an arbitrary virtual address with release semantics.
+	 *
+	 * @param dest  The virtual address.
+	 * @param value The {@code short} to write.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native void c_put_short_release(long dest, short value);
+
+	/**
+	 * Writes an {@code int} to an arbitrary virtual address with release semantics.
+	 *
+	 * @param dest  The virtual address.
+	 * @param value The {@code int} to write.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native void c_put_int_release(long dest, int value);
+
+	/**
+	 * Writes a {@code long} to an arbitrary virtual address with release semantics.
+	 *
+	 * @param dest  The virtual address.
+	 * @param value The {@code long} to write.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native void c_put_long_release(long dest, long value);
+
 	/**
 	 * Reads the data from an arbitrary memory region into a {@code byte[]}.
 	 *
@@ -322,6 +527,28 @@ public class JniMemoryManager implements MemoryManager {
 	@SuppressWarnings("checkstyle:MethodName")
 	private static native void c_put(long dest, int bytes, @NotNull byte[] src, int offset);
 
+	/**
+	 * Reads the data from an arbitrary memory region into a direct {@link ByteBuffer}.
+	 *
+	 * @param src    The virtual address.
+	 * @param bytes  The number of bytes.
+	 * @param dest   The direct buffer.
+	 * @param offset The offset of {@code dest}.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native void c_get_buffer(long src, int bytes, @NotNull ByteBuffer dest, int offset);
+
+	/**
+	 * Writes the data from a direct {@link ByteBuffer} into an arbitrary memory region.
+	 *
+	 * @param dest   The virtual address.
+	 * @param bytes  The number of bytes.
+	 * @param src    The direct buffer.
+	 * @param offset The offset of {@code src}.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native void c_put_buffer(long dest, int bytes, @NotNull ByteBuffer src, int offset);
+
 	/**
 	 * Translates a virtual address to a physical address.
 	 *
@@ -332,11 +559,35 @@ public class JniMemoryManager implements MemoryManager {
 	@SuppressWarnings("checkstyle:MethodName")
 	private static native long c_virt2phys(long address);
 
+	/**
+	 * Translates the virtual addresses of {@code count} consecutive blocks of {@code step} bytes to physical addresses.
+	 *
+	 * @param address      The virtual address of the first block.
+	 * @param step         The size of a block.
+	 * @param count        The number of blocks.
+	 * @param hugepageSize The huge memory page size that backs the region, or {@code 0} for regular memory pages.
+	 * @param physical     The array where the physical addresses will be stored.
+	 */
+	@Contract(mutates = "param5")
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native void c_virt2phys_bulk(long address, long step, int count, long hugepageSize,
+												@NotNull long[] physical);
+
 	///////////////////////////////////////////////// MEMBER VARIABLES /////////////////////////////////////////////////
 
 	/** A cached copy of the output of {@link #getHugepageSize()}. */
 	private long hugepageSize;
 
+	/**
+	 * The size of the anonymous huge memory pages, or {@code 0} if the {@code hugetlbfs} mount point is used instead.
+	 * -- GETTER --
+	 * Returns the size of the anonymous huge memory pages.
+	 *
+	 * @return The size of the anonymous huge memory pages.
+	 */
+	@Getter(AccessLevel.PACKAGE)
+	private long anonymousHugepageSize;
+
 	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
 
 	/** Package-private constructor that sets the field {@link #hugepageSize}. */
@@ -350,7 +601,10 @@ public class JniMemoryManager implements MemoryManager {
 			System.loadLibrary("ixy");
 		} finally {
 			try {
-				hugepageSize = c_hugepage_size();
+				anonymousHugepageSize = probeAnonymousHugepages();
+				hugepageSize = anonymousHugepageSize > 0
+						? anonymousHugepageSize
+						: c_hugepage_size(DEFAULT_HUGEPAGE_PATH);
 			} catch (final UnsatisfiedLinkError e) {
 				e.printStackTrace();
 			}
@@ -392,7 +646,18 @@ public class JniMemoryManager implements MemoryManager {
 	@Contract(pure = true)
 	public long getHugepageSize() {
 		if (DEBUG >= LOG_TRACE) log.trace("Checking the huge page size.");
-		return hugepageSize = c_hugepage_size();
+		return hugepageSize = anonymousHugepageSize > 0
+				? anonymousHugepageSize
+				: c_hugepage_size(DEFAULT_HUGEPAGE_PATH);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(value = " -> new", pure = true)
+	public @NotNull long[] getHugepageSizes() {
+		if (DEBUG >= LOG_TRACE) log.trace("Listing the huge page sizes.");
+		val sizes = new long[MAX_HUGEPAGE_SIZES];
+		return Arrays.copyOf(sizes, c_hugepage_sizes(sizes));
 	}
 
 	/** {@inheritDoc} */
@@ -425,7 +690,7 @@ public class JniMemoryManager implements MemoryManager {
 		}
 
 		// Call the C implementation
-		return c_allocate(bytes, huge, lock, DEFAULT_HUGEPAGE_PATH);
+		return c_allocate(bytes, huge, lock, DEFAULT_HUGEPAGE_PATH, anonymousHugepageSize, -1);
 	}
 
 	/** {@inheritDoc} */
@@ -465,6 +730,71 @@ public class JniMemoryManager implements MemoryManager {
 		c_free(address, bytes, huge, lock);
 	}
 
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	@SuppressWarnings("BooleanParameter")
+	public long allocate(final long bytes, final long pagesize, final boolean lock) {
+		return allocate(bytes, pagesize, lock, -1);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	@SuppressWarnings("BooleanParameter")
+	public long allocate(long bytes, final long pagesize, final boolean lock, final int node) {
+		if (!OPTIMIZED) {
+			if (bytes <= 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (pagesize <= 0 || Long.bitCount(pagesize) != 1) {
+				throw new IllegalArgumentException("The parameter 'pagesize' MUST be a power of two.");
+			}
+			if (node < -1) throw new IllegalArgumentException("The parameter 'node' MUST NOT be less than -1.");
+		}
+
+		// Round the size to a multiple of the page size
+		val mask = pagesize - 1;
+		bytes = (bytes + mask) & ~mask;
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Allocating {} bytes in huge memory pages of {} bytes on NUMA node {}.", bytes, pagesize, node);
+		}
+
+		// Call the C implementation
+		return c_allocate(bytes, true, lock, DEFAULT_HUGEPAGE_PATH, pagesize, node);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public int getNumaNode(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Checking the NUMA node of 0x{}.", leftPad(address));
+		return c_numa_node(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@SuppressWarnings("BooleanParameter")
+	public void free(long address, long bytes, final long pagesize, final boolean lock) {
+		if (!OPTIMIZED) {
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+			if (bytes <= 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (pagesize <= 0 || Long.bitCount(pagesize) != 1) {
+				throw new IllegalArgumentException("The parameter 'pagesize' MUST be a power of two.");
+			}
+		}
+
+		// Round the size and address to a multiple of the page size
+		val mask = pagesize - 1;
+		address &= ~mask;
+		bytes = (bytes + mask) & ~mask;
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Freeing {} bytes in huge memory pages of {} bytes @ 0x{}.", bytes, pagesize, leftPad(address));
+		}
+
+		// Call the C implementation
+		c_free(address, bytes, true, lock);
+	}
+
 	/** {@inheritDoc} */
 	@Override
 	@Contract(pure = true)
@@ -581,6 +911,78 @@ public class JniMemoryManager implements MemoryManager {
 		return c_get_long_volatile(address);
 	}
 
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public byte getByteOpaque(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading opaque byte @ 0x{}.", leftPad(address));
+		return c_get_byte_opaque(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public short getShortOpaque(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading opaque short @ 0x{}.", leftPad(address));
+		return c_get_short_opaque(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public int getIntOpaque(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading opaque int @ 0x{}.", leftPad(address));
+		return c_get_int_opaque(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public long getLongOpaque(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading opaque long @ 0x{}.", leftPad(address));
+		return c_get_long_opaque(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public byte getByteAcquire(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading acquire byte @ 0x{}.", leftPad(address));
+		return c_get_byte_acquire(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public short getShortAcquire(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading acquire short @ 0x{}.", leftPad(address));
+		return c_get_short_acquire(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public int getIntAcquire(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading acquire int @ 0x{}.", leftPad(address));
+		return c_get_int_acquire(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public long getLongAcquire(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading acquire long @ 0x{}.", leftPad(address));
+		return c_get_long_acquire(address);
+	}
+
 	/** {@inheritDoc} */
 	@Override
 	public void putByte(final long address, final byte value) {
@@ -645,6 +1047,70 @@ public class JniMemoryManager implements MemoryManager {
 		c_put_long_volatile(address, value);
 	}
 
+	/** {@inheritDoc} */
+	@Override
+	public void putByteOpaque(final long address, final byte value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing opaque byte 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		c_put_byte_opaque(address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putShortOpaque(final long address, final short value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing opaque short 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		c_put_short_opaque(address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putIntOpaque(final long address, final int value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing opaque int 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		c_put_int_opaque(address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putLongOpaque(final long address, final long value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing opaque long 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		c_put_long_opaque(address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putByteRelease(final long address, final byte value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing release byte 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		c_put_byte_release(address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putShortRelease(final long address, final short value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing release short 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		c_put_short_release(address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putIntRelease(final long address, final int value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing release int 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		c_put_int_release(address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putLongRelease(final long address, final long value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing release long 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		c_put_long_release(address, value);
+	}
+
 	/** {@inheritDoc} */
 	@Override
 	public void get(final long src, int bytes, final @NotNull byte[] dest, final int offset) {
@@ -695,6 +1161,58 @@ public class JniMemoryManager implements MemoryManager {
 		c_put(dest, bytes, src, offset);
 	}
 
+	/** {@inheritDoc} */
+	@Override
+	public void get(final long src, int bytes, final @NotNull ByteBuffer dest) {
+		if (!OPTIMIZED) {
+			if (src == 0) throw new IllegalArgumentException("The parameter 'src' MUST NOT be 0.");
+			if (bytes < 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (dest == null) throw new NullPointerException("The parameter 'dest' MUST NOT be null.");
+			if (dest.isReadOnly()) throw new ReadOnlyBufferException();
+			if (dest.remaining() < bytes) {
+				if (DEBUG >= LOG_WARN) {
+					log.warn("You are trying to write more bytes than the buffer can hold. Adapting bytes.");
+				}
+				bytes = dest.remaining();
+			}
+			if (bytes == 0) return;
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Copying memory region @ 0x{} ({} bytes).", leftPad(src), bytes);
+		val position = dest.position();
+		if (dest.isDirect()) c_get_buffer(src, bytes, dest, position);
+		else c_get(src, bytes, dest.array(), dest.arrayOffset() + position);
+		dest.position(position + bytes);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void put(final long dest, int bytes, final @NotNull ByteBuffer src) {
+		if (!OPTIMIZED) {
+			if (dest == 0) throw new IllegalArgumentException("The parameter 'dest' MUST NOT be 0.");
+			if (bytes < 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (src == null) throw new NullPointerException("The parameter 'src' MUST NOT be null.");
+			if (src.remaining() < bytes) {
+				if (DEBUG >= LOG_WARN) {
+					log.warn("You are trying to read more bytes than the buffer holds. Adapting bytes.");
+				}
+				bytes = src.remaining();
+			}
+			if (bytes == 0) return;
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Copying memory region @ 0x{} ({} bytes).", leftPad(dest), bytes);
+		val position = src.position();
+		if (src.isDirect()) {
+			c_put_buffer(dest, bytes, src, position);
+		} else if (src.hasArray()) {
+			c_put(dest, bytes, src.array(), src.arrayOffset() + position);
+		} else {
+			val copy = new byte[bytes];
+			src.duplicate().get(copy);
+			c_put(dest, bytes, copy, 0);
+		}
+		src.position(position + bytes);
+	}
+
 	/** {@inheritDoc} */
 	@Override
 	@Contract(pure = true)
@@ -704,4 +1222,49 @@ public class JniMemoryManager implements MemoryManager {
 		return c_virt2phys(address);
 	}
 
+	/** {@inheritDoc} */
+	@Override
+	@Contract(mutates = "param5")
+	public void virt2phys(final long address,
+						  final long step,
+						  final int count,
+						  final long hugepageSize,
+						  final @NotNull long[] physical) {
+		if (!OPTIMIZED) {
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+			if (step <= 0) throw new IllegalArgumentException("The parameter 'step' MUST be positive.");
+			if (count < 0) throw new IllegalArgumentException("The parameter 'count' MUST NOT be negative.");
+			if (physical == null) throw new NullPointerException("The parameter 'physical' MUST NOT be null.");
+			if (physical.length < count) {
+				throw new IllegalArgumentException("The parameter 'physical' MUST have at least 'count' elements.");
+			}
+		}
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Translating {} blocks of {} bytes @ 0x{} to physical addresses.", count, step, leftPad(address));
+		}
+		c_virt2phys_bulk(address, step, count, Math.max(hugepageSize, 0), physical);
+	}
+
+	///////////////////////////////////////////////// INTERNAL METHODS /////////////////////////////////////////////////
+
+	/**
+	 * Finds the size of the anonymous huge memory pages, which do not need a {@code hugetlbfs} mount point.
+	 * <p>
+	 * The preferred size is the build constant {@code DEFAULT_HUGEPAGE_SIZE}, and if those huge memory pages cannot be
+	 * reserved, {@link #FALLBACK_HUGEPAGE_SIZE 2 MiB} huge memory pages are tried.
+	 *
+	 * @return The size of the anonymous huge memory pages or {@code 0} if they are disabled or not available.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("PMD.AvoidLiteralsInIfCondition")
+	private static long probeAnonymousHugepages() {
+		if (DEFAULT_HUGEPAGE_SIZE <= 0) return 0;
+		if (c_hugepage_probe(DEFAULT_HUGEPAGE_SIZE)) return DEFAULT_HUGEPAGE_SIZE;
+		if (DEBUG >= LOG_WARN) log.warn("Cannot reserve huge memory pages of {} bytes.", DEFAULT_HUGEPAGE_SIZE);
+		if (DEFAULT_HUGEPAGE_SIZE > FALLBACK_HUGEPAGE_SIZE && c_hugepage_probe(FALLBACK_HUGEPAGE_SIZE)) {
+			return FALLBACK_HUGEPAGE_SIZE;
+		}
+		return 0;
+	}
+
 }
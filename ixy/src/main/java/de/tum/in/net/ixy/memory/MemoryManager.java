@@ -3,6 +3,7 @@ package de.tum.in.net.ixy.memory;
 import java.io.File;
 import java.io.FileNotFoundException;
 import java.io.IOException;
+import java.nio.ByteBuffer;
 
 import lombok.val;
 
@@ -192,6 +193,98 @@ public interface MemoryManager {
 	@Contract(pure = true)
 	long getLongVolatile(long address);
 
+	////////////////////////////////////////////////// OPAQUE GETTERS //////////////////////////////////////////////////
+
+	/**
+	 * Reads a {@code byte} from an arbitrary virtual address with opaque semantics.
+	 * <p>
+	 * The read is always performed, but it does not order the surrounding memory accesses.
+	 *
+	 * @param address The virtual address.
+	 * @return The stored value.
+	 */
+	@Contract(pure = true)
+	byte getByteOpaque(long address);
+
+	/**
+	 * Reads a {@code short} from an arbitrary virtual address with opaque semantics.
+	 * <p>
+	 * The read is always performed, but it does not order the surrounding memory accesses.
+	 *
+	 * @param address The virtual address.
+	 * @return The stored value.
+	 */
+	@Contract(pure = true)
+	short getShortOpaque(long address);
+
+	/**
+	 * Reads an {@code int} from an arbitrary virtual address with opaque semantics.
+	 * <p>
+	 * The read is always performed, but it does not order the surrounding memory accesses.
+	 *
+	 * @param address The virtual address.
+	 * @return The stored value.
+	 */
+	@Contract(pure = true)
+	int getIntOpaque(long address);
+
+	/**
+	 * Reads a {@code long} from an arbitrary virtual address with opaque semantics.
+	 * <p>
+	 * The read is always performed, but it does not order the surrounding memory accesses.
+	 *
+	 * @param address The virtual address.
+	 * @return The stored value.
+	 */
+	@Contract(pure = true)
+	long getLongOpaque(long address);
+
+	///////////////////////////////////////////////// ACQUIRE GETTERS //////////////////////////////////////////////////
+
+	/**
+	 * Reads a {@code byte} from an arbitrary virtual address with acquire semantics.
+	 * <p>
+	 * No memory access that follows the read can be reordered before it.
+	 *
+	 * @param address The virtual address.
+	 * @return The stored value.
+	 */
+	@Contract(pure = true)
+	byte getByteAcquire(long address);
+
+	/**
+	 * Reads a {@code short} from an arbitrary virtual address with acquire semantics.
+	 * <p>
+	 * No memory access that follows the read can be reordered before it.
+	 *
+	 * @param address The virtual address.
+	 * @return The stored value.
+	 */
+	@Contract(pure = true)
+	short getShortAcquire(long address);
+
+	/**
+	 * Reads an {@code int} from an arbitrary virtual address with acquire semantics.
+	 * <p>
+	 * No memory access that follows the read can be reordered before it.
+	 *
+	 * @param address The virtual address.
+	 * @return The stored value.
+	 */
+	@Contract(pure = true)
+	int getIntAcquire(long address);
+
+	/**
+	 * Reads a {@code long} from an arbitrary virtual address with acquire semantics.
+	 * <p>
+	 * No memory access that follows the read can be reordered before it.
+	 *
+	 * @param address The virtual address.
+	 * @return The stored value.
+	 */
+	@Contract(pure = true)
+	long getLongAcquire(long address);
+
 	///////////////////////////////////////////////////// PUTTERS //////////////////////////////////////////////////////
 
 	/**
@@ -260,6 +353,90 @@ public interface MemoryManager {
 	 */
 	void putLongVolatile(long address, long value);
 
+	////////////////////////////////////////////////// OPAQUE PUTTERS //////////////////////////////////////////////////
+
+	/**
+	 * Writes a {@code byte} to an arbitrary virtual address with opaque semantics.
+	 * <p>
+	 * The write is always performed, but it does not order the surrounding memory accesses.
+	 *
+	 * @param address The virtual address.
+	 * @param value   The value to store.
+	 */
+	void putByteOpaque(long address, byte value);
+
+	/**
+	 * Writes a {@code short} to an arbitrary virtual address with opaque semantics.
+	 * <p>
+	 * The write is always performed, but it does not order the surrounding memory accesses.
+	 *
+	 * @param address The virtual address.
+	 * @param value   The value to store.
+	 */
+	void putShortOpaque(long address, short value);
+
+	/**
+	 * Writes an {@code int} to an arbitrary virtual address with opaque semantics.
+	 * <p>
+	 * The write is always performed, but it does not order the surrounding memory accesses.
+	 *
+	 * @param address The virtual address.
+	 * @param value   The value to store.
+	 */
+	void putIntOpaque(long address, int value);
+
+	/**
+	 * Writes a {@code long} to an arbitrary virtual address with opaque semantics.
+	 * <p>
+	 * The write is always performed, but it does not order the surrounding memory accesses.
+	 *
+	 * @param address The virtual address.
+	 * @param value   The value to store.
+	 */
+	void putLongOpaque(long address, long value);
+
+	///////////////////////////////////////////////// RELEASE PUTTERS //////////////////////////////////////////////////
+
+	/**
+	 * Writes a {@code byte} to an arbitrary virtual address with release semantics.
+	 * <p>
+	 * No memory access that precedes the write can be reordered after it.
+	 *
+	 * @param address The virtual address.
+	 * @param value   The value to store.
+	 */
+	void putByteRelease(long address, byte value);
+
+	/**
+	 * Writes a {@code short} to an arbitrary virtual address with release semantics.
+	 * <p>
+	 * No memory access that precedes the write can be reordered after it.
+	 *
+	 * @param address The virtual address.
+	 * @param value   The value to store.
+	 */
+	void putShortRelease(long address, short value);
+
+	/**
+	 * Writes an {@code int} to an arbitrary virtual address with release semantics.
+	 * <p>
+	 * No memory access that precedes the write can be reordered after it.
+	 *
+	 * @param address The virtual address.
+	 * @param value   The value to store.
+	 */
+	void putIntRelease(long address, int value);
+
+	/**
+	 * Writes a {@code long} to an arbitrary virtual address with release semantics.
+	 * <p>
+	 * No memory access that precedes the write can be reordered after it.
+	 *
+	 * @param address The virtual address.
+	 * @param value   The value to store.
+	 */
+	void putLongRelease(long address, long value);
+
 	////////////////////////////////////////////////// REGION PUTTERS //////////////////////////////////////////////////
 
 	/**
@@ -283,6 +460,32 @@ public interface MemoryManager {
 	 */
 	void put(long dest, int bytes, @NotNull byte[] src, int offset);
 
+	/**
+	 * Reads the data from an arbitrary memory region into a {@link ByteBuffer}.
+	 * <p>
+	 * The data is written at the position of {@code dest}, which is advanced by {@code bytes}. Direct buffers are
+	 * filled straight from the memory region, without any intermediate {@code byte[]}.
+	 *
+	 * @param src   The virtual address.
+	 * @param bytes The number of bytes.
+	 * @param dest  The buffer.
+	 */
+	@Contract(mutates = "param3")
+	void get(long src, int bytes, @NotNull ByteBuffer dest);
+
+	/**
+	 * Writes the data from a {@link ByteBuffer} into an arbitrary memory region.
+	 * <p>
+	 * The data is read from the position of {@code src}, which is advanced by {@code bytes}. Direct buffers are copied
+	 * straight into the memory region, without any intermediate {@code byte[]}.
+	 *
+	 * @param dest  The virtual address.
+	 * @param bytes The number of bytes.
+	 * @param src   The buffer.
+	 */
+	@Contract(mutates = "param3")
+	void put(long dest, int bytes, @NotNull ByteBuffer src);
+
 	/////////////////////////////////////////////// ADDRESS TRANSLATORS ////////////////////////////////////////////////
 
 	/**
@@ -296,6 +499,86 @@ public interface MemoryManager {
 
 	///////////////////////////////////////////////// DEFAULT METHODS //////////////////////////////////////////////////
 
+	/**
+	 * Returns the sizes of the huge memory pages that can be reserved, in ascending order.
+	 * <p>
+	 * The sizes are read from Linux' {@code /sys/kernel/mm/hugepages} directory, which has a pool per huge memory page
+	 * size. Only the pools with free or overcommittable pages are returned.
+	 *
+	 * @return The huge memory page sizes.
+	 */
+	@Contract(value = " -> new", pure = true)
+	default @NotNull long[] getHugepageSizes() {
+		return Hugepages.available();
+	}
+
+	/**
+	 * Allocates memory backed by huge memory pages of the given size.
+	 * <p>
+	 * The default implementation only supports the size returned by {@link #getHugepageSize()}, and returns {@code 0}
+	 * for any other size.
+	 *
+	 * @param bytes    The number of bytes.
+	 * @param pagesize The size of the huge memory pages.
+	 * @param lock     Whether to enable memory locking.
+	 * @return The base address of the allocated memory region.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("BooleanParameter")
+	default long allocate(final long bytes, final long pagesize, final boolean lock) {
+		if (!OPTIMIZED && (pagesize <= 0 || Long.bitCount(pagesize) != 1)) {
+			throw new IllegalArgumentException("The parameter 'pagesize' MUST be a power of two.");
+		}
+		return pagesize == getHugepageSize() ? allocate(bytes, true, lock) : 0;
+	}
+
+	/**
+	 * Allocates memory backed by huge memory pages of the given size and bound to a NUMA node.
+	 * <p>
+	 * The memory policy of the region is set before its pages are faulted in, so they are reserved from the huge memory
+	 * page pool of the node. The default implementation ignores the NUMA node.
+	 *
+	 * @param bytes    The number of bytes.
+	 * @param pagesize The size of the huge memory pages.
+	 * @param lock     Whether to enable memory locking.
+	 * @param node     The NUMA node, or {@code -1} to use the default memory policy.
+	 * @return The base address of the allocated memory region.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("BooleanParameter")
+	default long allocate(final long bytes, final long pagesize, final boolean lock, final int node) {
+		return allocate(bytes, pagesize, lock);
+	}
+
+	/**
+	 * Returns the NUMA node a memory region is bound to by its memory policy.
+	 * <p>
+	 * The default implementation does not support NUMA memory policies and always returns {@code -1}.
+	 *
+	 * @param address The memory region's base address.
+	 * @return The NUMA node or {@code -1} if the memory region is not bound to any.
+	 */
+	@Contract(pure = true)
+	default int getNumaNode(final long address) {
+		return -1;
+	}
+
+	/**
+	 * Frees a memory region allocated with {@link #allocate(long, long, boolean)}.
+	 *
+	 * @param address  The memory region's base address.
+	 * @param bytes    The number of bytes.
+	 * @param pagesize The size of the huge memory pages.
+	 * @param lock     Whether memory locking was enabled.
+	 */
+	@SuppressWarnings("BooleanParameter")
+	default void free(final long address, final long bytes, final long pagesize, final boolean lock) {
+		if (!OPTIMIZED && (pagesize <= 0 || Long.bitCount(pagesize) != 1)) {
+			throw new IllegalArgumentException("The parameter 'pagesize' MUST be a power of two.");
+		}
+		if (pagesize == getHugepageSize()) free(address, bytes, true, lock);
+	}
+
 	/**
 	 * Allocates memory, translates the address to its physical counterpart and returns a {@link DmaMemory} instance.
 	 *
@@ -314,4 +597,106 @@ public interface MemoryManager {
 		return new DmaMemory(virtual, physical);
 	}
 
+	/**
+	 * Allocates memory backed by huge memory pages of the given size, translates the address to its physical
+	 * counterpart and returns a {@link DmaMemory} instance.
+	 *
+	 * @param bytes    The number of bytes.
+	 * @param pagesize The size of the huge memory pages.
+	 * @param lock     Whether to enable memory locking.
+	 * @return The DMA memory.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("BooleanParameter")
+	default @NotNull DmaMemory dmaAllocate(final long bytes, final long pagesize, final boolean lock) {
+		return dmaAllocate(bytes, pagesize, lock, -1);
+	}
+
+	/**
+	 * Allocates memory backed by huge memory pages of the given size and bound to a NUMA node, translates the address
+	 * to its physical counterpart and returns a {@link DmaMemory} instance.
+	 *
+	 * @param bytes    The number of bytes.
+	 * @param pagesize The size of the huge memory pages.
+	 * @param lock     Whether to enable memory locking.
+	 * @param node     The NUMA node, or {@code -1} to use the default memory policy.
+	 * @return The DMA memory.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("BooleanParameter")
+	default @NotNull DmaMemory dmaAllocate(final long bytes, final long pagesize, final boolean lock, final int node) {
+		if (!OPTIMIZED && bytes <= 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+		val virtual = allocate(bytes, pagesize, lock, node);
+		if (virtual != 0) putByte(virtual, getByte(virtual));
+		val physical = virt2phys(virtual);
+		return new DmaMemory(virtual, physical);
+	}
+
+	/**
+	 * Translates the virtual addresses of {@code count} consecutive blocks of {@code step} bytes to physical addresses.
+	 * <p>
+	 * Huge memory pages are physically contiguous, so when {@code huge} is set only the first address of every huge
+	 * memory page is translated and the rest are computed from it.
+	 *
+	 * @param address  The virtual address of the first block.
+	 * @param step     The size of a block.
+	 * @param count    The number of blocks.
+	 * @param huge     Whether the memory region is backed by huge memory pages.
+	 * @param physical The array where the physical addresses will be stored.
+	 */
+	@Contract(mutates = "param5")
+	@SuppressWarnings("BooleanParameter")
+	default void virt2phys(final long address,
+						   final long step,
+						   final int count,
+						   final boolean huge,
+						   final @NotNull long[] physical) {
+		virt2phys(address, step, count, huge ? Math.max(getHugepageSize(), 0) : 0, physical);
+	}
+
+	/**
+	 * Translates the virtual addresses of {@code count} consecutive blocks of {@code step} bytes to physical addresses.
+	 * <p>
+	 * When {@code hugepageSize} is positive, only the first address of every huge memory page of that size is
+	 * translated and the rest are computed from it.
+	 *
+	 * @param address      The virtual address of the first block.
+	 * @param step         The size of a block.
+	 * @param count        The number of blocks.
+	 * @param hugepageSize The huge memory page size that backs the region, or {@code 0} for regular memory pages.
+	 * @param physical     The array where the physical addresses will be stored.
+	 */
+	@Contract(mutates = "param5")
+	default void virt2phys(final long address,
+						   final long step,
+						   final int count,
+						   final long hugepageSize,
+						   final @NotNull long[] physical) {
+		if (!OPTIMIZED) {
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+			if (step <= 0) throw new IllegalArgumentException("The parameter 'step' MUST be positive.");
+			if (count < 0) throw new IllegalArgumentException("The parameter 'count' MUST NOT be negative.");
+			if (physical == null) throw new NullPointerException("The parameter 'physical' MUST NOT be null.");
+			if (physical.length < count) {
+				throw new IllegalArgumentException("The parameter 'physical' MUST have at least 'count' elements.");
+			}
+		}
+		var page = -1L;
+		var base = 0L;
+		for (var i = 0; i < count; i += 1) {
+			val virtual = address + i * step;
+			if (hugepageSize <= 0) {
+				physical[i] = virt2phys(virtual);
+			} else {
+				val offset = Long.remainderUnsigned(virtual, hugepageSize);
+				if (Long.divideUnsigned(virtual, hugepageSize) != page) {
+					page = Long.divideUnsigned(virtual, hugepageSize);
+					val translated = virt2phys(virtual);
+					base = translated == 0 ? 0 : translated - offset;
+				}
+				physical[i] = base == 0 ? 0 : base + offset;
+			}
+		}
+	}
+
 }
@@ -2,12 +2,6 @@ package de.tum.in.net.ixy.memory;
 
 import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
 
-import java.util.ArrayDeque;
-import java.util.Deque;
-import java.util.TreeMap;
-import java.util.concurrent.atomic.AtomicLong;
-
-import lombok.AccessLevel;
 import lombok.EqualsAndHashCode;
 import lombok.Getter;
 import lombok.ToString;
@@ -26,6 +20,8 @@ import static de.tum.in.net.ixy.BuildConfig.MEMORY_MANAGER;
 import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
 import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI;
 import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_VARHANDLE;
+import static de.tum.in.net.ixy.utils.Strings.leftPad;
 
 /**
  * A collection of {@link PacketBufferWrapper wrapped packet buffers}.
@@ -46,27 +42,48 @@ public final class Mempool {
 			? JniMemoryManager.getSingleton()
 			: MEMORY_MANAGER == PREFER_JNI
 			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
 			: SmartUnsafeMemoryManager.getSingleton();
 
-	/** Holds a reference to every {@link Mempool memory pool} ever created. */
-	private static final TreeMap<Long, Mempool> pools = new TreeMap<>();
+	/** The initial capacity of the memory pool registry {@link #pools}. */
+	private static final int INITIAL_POOLS = 16;
 
-	/** A variable that indicates the next id to use. */
-	private static final AtomicLong nextId = new AtomicLong(0);
+	/**
+	 * Holds a reference to every {@link Mempool memory pool} ever created, indexed by their identifier.
+	 * <p>
+	 * Memory pools can be created while other threads are already looking up the registry, for example when the RX
+	 * queues of several devices share memory pools. The registry is only modified while holding the class lock and is
+	 * republished through this {@code volatile} field after every modification, so the lookups see every registered
+	 * memory pool without any synchronization.
+	 */
+	@SuppressWarnings("StaticNonFinalField")
+	private static volatile @Nullable Mempool[] pools = new Mempool[INITIAL_POOLS];
+
+	/** The number of registered memory pools, which is also the next identifier to use; guarded by the class lock. */
+	@SuppressWarnings({"StaticNonFinalField", "RedundantFieldInitialization"})
+	private static int nextId = 0;
 
 	////////////////////////////////////////////////// STATIC METHODS //////////////////////////////////////////////////
 
 	/**
-	 * Computes an identifier that is not being used by any other memory pool.
+	 * Registers a memory pool in the registry {@link #pools} and returns its identifier.
+	 * <p>
+	 * The identifiers are dense, which allows using them as an index of the registry.
 	 *
-	 * @return An identifier that is not being used.
+	 * @param mempool The memory pool.
+	 * @return The identifier of the memory pool.
 	 */
-	@Contract(pure = true)
-	private static long getValidId() {
-		long id;
-		do {
-			id = nextId.getAndIncrement();
-		} while (pools.containsKey(id));
+	private static synchronized int register(final @NotNull Mempool mempool) {
+		val id = nextId++;
+		var current = pools;
+		if (id == current.length) {
+			val copy = new Mempool[current.length * 2];
+			System.arraycopy(current, 0, copy, 0, current.length);
+			current = copy;
+		}
+		current[id] = mempool;
+		pools = current;
 		return id;
 	}
 
@@ -77,8 +94,10 @@ public final class Mempool {
 	 * @return The memory pool instance.
 	 */
 	@Contract(pure = true)
-	private static @Nullable Mempool find(final long id) {
-		return pools.get(id);
+	private static @Nullable Mempool find(final int id) {
+		val current = pools;
+		if (!OPTIMIZED && (id < 0 || id >= current.length)) return null;
+		return current[id];
 	}
 
 	/**
@@ -89,26 +108,22 @@ public final class Mempool {
 	 */
 	@Contract(pure = true)
 	public static @Nullable Mempool find(final @NotNull PacketBufferWrapper packetBufferWrapper) {
-		return find(packetBufferWrapper.getMemoryPoolPointer());
+		return find((int) packetBufferWrapper.getMemoryPoolPointer());
 	}
 
 	///////////////////////////////////////////////// MEMBER VARIABLES /////////////////////////////////////////////////
 
 	/**
-	 * A bunch of pre-allocated {@link PacketBufferWrapper} instances.
-	 * -- GETTER --
-	 * Returns the internal storage of packets.
-	 *
-	 * @return The internal packet storage.
+	 * The virtual addresses of the free packet buffers of a single-threaded memory pool.
+	 * <p>
+	 * The packet buffer wrappers are obtained from {@link #wrappers} when needed.
 	 */
 	@ToString.Include
 	@EqualsAndHashCode.Include
-	@SuppressWarnings("JavaDoc")
-	@Getter(AccessLevel.PROTECTED)
-	private final @NotNull Deque<PacketBufferWrapper> packetBufferWrappers;
+	private final @NotNull FixedSizeStack addresses;
 
 	/**
-	 * The unique identifier of the memory pool.
+	 * The unique identifier of the memory pool, which is also its index in the registry.
 	 * -- GETTER --
 	 * Returns the memory pool identifier.
 	 *
@@ -116,7 +131,7 @@ public final class Mempool {
 	 */
 	@Getter
 	@SuppressWarnings("JavaDoc")
-	private final long id;
+	private final int id;
 
 	/**
 	 * The capacity of the memory pool.
@@ -129,6 +144,54 @@ public final class Mempool {
 	@SuppressWarnings("JavaDoc")
 	private final int capacity;
 
+	/**
+	 * The pre-built {@link PacketBufferWrapper} instances, indexed by the position of their packet buffer in the memory
+	 * region.
+	 */
+	private final @NotNull PacketBufferWrapper[] wrappers;
+
+	/** The virtual address of the first packet buffer. */
+	private long base;
+
+	/**
+	 * The size of a packet buffer, which is {@code 0} until the memory pool is allocated.
+	 * -- GETTER --
+	 * Returns the size of a packet buffer.
+	 *
+	 * @return The size of a packet buffer.
+	 */
+	@Getter
+	@SuppressWarnings("JavaDoc")
+	private int entrySize;
+
+	/** The base two logarithm of {@link #entrySize}, or {@code -1} if it is not a power of two. */
+	private int entryShift;
+
+	/**
+	 * The lock-free store of packet buffer wrappers shared by all threads.
+	 * <p>
+	 * When {@code null}, the memory pool is single-threaded and {@link #addresses} is used instead.
+	 */
+	private final @Nullable ConcurrentRing ring;
+
+	/**
+	 * The number of packet buffer wrappers each thread keeps in its local cache before returning them to the {@link
+	 * #ring}.
+	 * -- GETTER --
+	 * Returns the size of the per-thread caches, which can hold up to twice as many packet buffer wrappers.
+	 *
+	 * @return The size of the per-thread caches, {@code 0} if they are disabled or the memory pool is single-threaded.
+	 */
+	@Getter
+	@SuppressWarnings("JavaDoc")
+	private final int cacheSize;
+
+	/** The per-thread caches, only used when the memory pool is concurrent and {@link #cacheSize} is not zero. */
+	private final @Nullable ThreadLocal<Cache> caches;
+
+	/** The number of packet buffers reserved by the descriptor rings that use the memory pool. */
+	private int reserved;
+
 	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
 
 	/**
@@ -140,9 +203,36 @@ public final class Mempool {
 	public Mempool(final int capacity) {
 		if (DEBUG >= LOG_TRACE) log.trace("Creating memory pool.");
 		this.capacity = capacity;
-		this.packetBufferWrappers = new ArrayDeque<>(capacity);
-		id = getValidId();
-		pools.put(id, this);
+		this.addresses = new FixedSizeStack(capacity);
+		this.wrappers = new PacketBufferWrapper[capacity];
+		ring = null;
+		cacheSize = 0;
+		caches = null;
+		id = register(this);
+	}
+
+	/**
+	 * Creates a memory pool that manages a finite amount of packets and that can be used by several threads at the
+	 * same time.
+	 * <p>
+	 * Every thread keeps up to {@code 2 * cacheSize} packet buffer wrappers in a local cache, which is refilled from or
+	 * flushed to a lock-free ring {@code cacheSize} packet buffer wrappers at a time. Threads that stop using the
+	 * memory pool should call {@link #flush()} to return their cached packet buffer wrappers.
+	 *
+	 * @param capacity  The capacity of the memory pool.
+	 * @param cacheSize The size of the per-thread caches, {@code 0} to disable them.
+	 */
+	@SuppressWarnings("ThisEscapedInObjectConstruction")
+	public Mempool(final int capacity, final int cacheSize) {
+		if (!OPTIMIZED && cacheSize < 0) throw new IllegalArgumentException("The parameter 'cacheSize' MUST be positive.");
+		if (DEBUG >= LOG_TRACE) log.trace("Creating concurrent memory pool.");
+		this.capacity = capacity;
+		this.addresses = new FixedSizeStack(0);
+		this.wrappers = new PacketBufferWrapper[capacity];
+		ring = new ConcurrentRing(capacity);
+		this.cacheSize = cacheSize;
+		caches = cacheSize == 0 ? null : ThreadLocal.withInitial(() -> new Cache(cacheSize));
+		id = register(this);
 	}
 
 
@@ -153,28 +243,72 @@ public final class Mempool {
 	 * @param entrySize The size of a packet buffer wrapper.
 	 * @param dma       The base address of the allocated memory region.
 	 */
+	public void allocate(final int entrySize, final @NotNull DmaMemory dma) {
+		allocate(entrySize, dma, false);
+	}
+
+	/**
+	 * Allocates as many packet buffers as indicated by {@link #capacity} and configures their virtual and physical
+	 * addresses with the given parameter {@code dma}.
+	 * <p>
+	 * The physical addresses of all the packet buffers are translated at once, and if the memory region is backed by
+	 * huge memory pages, they are computed from a single translation per huge memory page.
+	 *
+	 * @param entrySize The size of a packet buffer wrapper.
+	 * @param dma       The base address of the allocated memory region.
+	 * @param huge      Whether the memory region is backed by huge memory pages.
+	 */
+	public void allocate(final int entrySize, final @NotNull DmaMemory dma, final boolean huge) {
+		allocate(entrySize, dma, huge ? Math.max(mmanager.getHugepageSize(), 0) : 0);
+	}
+
+	/**
+	 * Allocates as many packet buffers as indicated by {@link #capacity} and configures their virtual and physical
+	 * addresses with the given parameter {@code dma}, which is backed by huge memory pages of the given size.
+	 * <p>
+	 * The physical addresses of all the packet buffers are translated at once, and if {@code hugepageSize} is
+	 * positive, they are computed from a single translation per huge memory page.
+	 *
+	 * @param entrySize    The size of a packet buffer wrapper.
+	 * @param dma          The base address of the allocated memory region.
+	 * @param hugepageSize The huge memory page size that backs the region, or {@code 0} for regular memory pages.
+	 */
 	@SuppressFBWarnings("NP_NULL_ON_SOME_PATH_FROM_RETURN_VALUE")
 	@SuppressWarnings({"PMD.AssignmentInOperand", "PMD.DataflowAnomalyAnalysis"})
-	public void allocate(final int entrySize, final @NotNull DmaMemory dma) {
+	public void allocate(final int entrySize, final @NotNull DmaMemory dma, final long hugepageSize) {
 		if (DEBUG >= LOG_DEBUG) log.debug("Allocating {} packets @ {}.", capacity, dma);
 
 		// The base virtual address which will be incremented on every iteration
 		val virtual = dma.getVirtual();
+		base = virtual;
+		this.entrySize = entrySize;
+		entryShift = Integer.bitCount(entrySize) == 1 ? Integer.numberOfTrailingZeros(entrySize) : -1;
+
+		// Translate the addresses of all the packet buffers at once
+		val physical = new long[capacity];
+		mmanager.virt2phys(virtual, entrySize, capacity, hugepageSize, physical);
 
 		// Allocate the packet buffer wrappers
 		for (var i = capacity - 1; i >= 0; i--) {
 			val addr = virtual + i*entrySize;
 			val packet = new PacketBufferWrapper(addr);
-			packet.setPhysicalAddress(mmanager.virt2phys(addr));
+			packet.setPhysicalAddress(physical[i]);
 			packet.setMemoryPoolPointer(id);
+			packet.setOffload(0);
+			packet.setSegments(1);
+			packet.setNext(0);
 			packet.setSize(entrySize - PacketBufferWrapperConstants.HEADER_BYTES);
 
 			// Trace message
 			if (DEBUG >= LOG_TRACE) log.trace("Allocated packet buffer wrapper #{}: {}", i, packet);
 
 			// Add the packet buffer wrapper
-			packetBufferWrappers.push(packet);
+			if (ring == null) addresses.push(addr);
+			wrappers[i] = packet;
 		}
+
+		// The concurrent store is a FIFO, so insert them in ascending order
+		if (ring != null) ring.offer(wrappers, 0, capacity);
 	}
 
 	/**
@@ -187,8 +321,7 @@ public final class Mempool {
 	 * @return The amount of extracted buffers.
 	 */
 	@Contract(mutates = "param1")
-	@SuppressWarnings("PMD.AssignmentInOperand")
-	private int pop(final @NotNull PacketBufferWrapper[] buffers, int offset, int size) {
+	private int pop(final @NotNull PacketBufferWrapper[] buffers, final int offset, int size) {
 		if (!OPTIMIZED) {
 			if (buffers == null) throw new NullPointerException("The parameter 'buffers' MUST NOT be null.");
 			if (offset < 0) throw new IndexOutOfBoundsException("The parameter 'offset' MUST be positive.");
@@ -209,8 +342,19 @@ public final class Mempool {
 			}
 		}
 
+		// The concurrent store cannot guarantee how many instances are available
+		if (ring != null) {
+			var count = 0;
+			while (count < size) {
+				val buffer = pop();
+				if (buffer == null) break;
+				buffers[offset + count++] = buffer;
+			}
+			return count;
+		}
+
 		// Adapt the size based on the amount of free instances
-		val available = packetBufferWrappers.size();
+		val available = addresses.size();
 		if (available < size) {
 			if (DEBUG >= LOG_WARN) {
 				log.warn("You are trying to extract {} PacketBufferWrappers but there are only {} available."
@@ -220,34 +364,13 @@ public final class Mempool {
 		}
 
 		// Trace message
-		if (DEBUG >= LOG_TRACE) {
-			val max = offset + size;
-			log.trace("Extracting {} packets starting @ #{}.", max, offset);
-		}
+		if (DEBUG >= LOG_TRACE) log.trace("Extracting {} packets starting @ #{}.", size, offset);
 
 		// Extract the packet buffer wrappers
-		if (OPTIMIZED) {
-			val sizeCopy = size;
-			while (size-- > 0) {
-				if ((buffers[offset++] = packetBufferWrappers.pop()) == null) {
-					size += 1;
-					break;
-				}
-			}
-			return sizeCopy - size - 1;
-		} else {
-			var counter = 0;
-			while (size-- > 0) {
-				val buffer = packetBufferWrappers.pop();
-				if (buffer != null) {
-					buffers[offset++] = buffer;
-					counter += 1;
-				} else {
-					break;
-				}
-			}
-			return counter;
+		for (var i = 0; i < size; i += 1) {
+			buffers[offset + i] = wrappers[index(addresses.pop())];
 		}
+		return size;
 	}
 
 	/**
@@ -262,6 +385,162 @@ public final class Mempool {
 		return pop(buffers, 0, buffers.length);
 	}
 
+	/**
+	 * Returns the pre-built {@link PacketBufferWrapper packet buffer wrapper} of the packet buffer that starts at the
+	 * given virtual address.
+	 * <p>
+	 * The same instance is returned every time, which allows receiving packets without allocating new wrappers.
+	 *
+	 * @param virtualAddress The virtual address of the packet buffer.
+	 * @return The packet buffer wrapper.
+	 */
+	@Contract(pure = true)
+	public @NotNull PacketBufferWrapper wrap(final long virtualAddress) {
+		if (!OPTIMIZED) {
+			if (entrySize == 0) throw new IllegalStateException("The memory pool MUST be allocated.");
+			val diff = virtualAddress - base;
+			if (diff < 0 || diff % entrySize != 0 || diff / entrySize >= capacity) {
+				throw new IllegalArgumentException("The parameter 'virtualAddress' MUST belong to the memory pool.");
+			}
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Wrapping packet buffer @ 0x{}.", leftPad(virtualAddress));
+		return wrappers[index(virtualAddress)];
+	}
+
+	/**
+	 * Extracts up to {@code size} packet buffers and stores their virtual addresses in the parameter {@code dest}.
+	 * <p>
+	 * This method does not touch any {@link PacketBufferWrapper packet buffer wrapper} when the memory pool is
+	 * single-threaded, which makes it suitable to refill descriptor rings that store raw addresses.
+	 *
+	 * @param dest The array where the packet buffer virtual addresses will be stored.
+	 * @param size The maximum amount of packet buffers to extract.
+	 * @return The amount of extracted packet buffers.
+	 */
+	@Contract(mutates = "param1")
+	public int pop(final @NotNull long[] dest, final int size) {
+		if (!OPTIMIZED) {
+			if (dest == null) throw new NullPointerException("The parameter 'dest' MUST NOT be null.");
+			if (size < 0 || size > dest.length) {
+				throw new IllegalArgumentException("The parameter 'size' MUST be inside [0, dest.length].");
+			}
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Extracting {} packet buffer addresses.", size);
+		if (ring == null) return addresses.pop(dest, 0, size);
+		var count = 0;
+		while (count < size) {
+			val buffer = pop();
+			if (buffer == null) break;
+			dest[count++] = buffer.getVirtualAddress();
+		}
+		return count;
+	}
+
+	/**
+	 * Frees up to {@code size} packet buffers given their virtual addresses.
+	 * <p>
+	 * This method does not touch any {@link PacketBufferWrapper packet buffer wrapper} when the memory pool is
+	 * single-threaded, which makes it suitable to clean descriptor rings that store raw addresses.
+	 *
+	 * @param src  The packet buffer virtual addresses.
+	 * @param size The amount of packet buffers to free.
+	 * @return The amount of freed packet buffers.
+	 */
+	public int push(final @NotNull long[] src, final int size) {
+		if (!OPTIMIZED) {
+			if (src == null) throw new NullPointerException("The parameter 'src' MUST NOT be null.");
+			if (size < 0 || size > src.length) {
+				throw new IllegalArgumentException("The parameter 'size' MUST be inside [0, src.length].");
+			}
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Inserting {} packet buffer addresses.", size);
+		if (ring == null) return addresses.push(src, 0, size);
+		for (var i = 0; i < size; i += 1) push(wrap(src[i]));
+		return size;
+	}
+
+	/**
+	 * Frees all the segments of a packet that is stored in a chain of packet buffers.
+	 * <p>
+	 * The chain is unlinked, so every packet buffer can be reused as a single segment packet.
+	 *
+	 * @param head The packet buffer wrapper of the first segment.
+	 * @return The amount of freed packet buffers.
+	 */
+	public int pushChain(final @NotNull PacketBufferWrapper head) {
+		if (!OPTIMIZED && head == null) throw new NullPointerException("The parameter 'head' MUST NOT be null.");
+		if (DEBUG >= LOG_TRACE) log.trace("Inserting chain of packet buffers starting @ {}.", head);
+		var count = 1;
+		var next = head.getNext();
+		head.setSegments(1);
+		head.setNext(0);
+		push(head);
+		while (next != 0) {
+			val segment = wrap(next);
+			next = segment.getNext();
+			segment.setNext(0);
+			push(segment);
+			count += 1;
+		}
+		return count;
+	}
+
+	/**
+	 * Reserves packet buffers for the descriptor rings that start using the memory pool.
+	 * <p>
+	 * A memory pool shared by several queues or devices must be able to fill all their descriptor rings at the same
+	 * time, otherwise a queue could starve the others. The reservation only bounds the sizing and does not set any
+	 * packet buffer aside.
+	 *
+	 * @param entries The number of packet buffers.
+	 * @throws IllegalStateException If the reserved packet buffers would exceed the capacity.
+	 */
+	public synchronized void reserve(final int entries) {
+		if (!OPTIMIZED && entries < 0) throw new IllegalArgumentException("The parameter 'entries' MUST be positive.");
+		if (entries > capacity - reserved) {
+			throw new IllegalStateException("The memory pool MUST have enough packet buffers to fill all the "
+					+ "descriptor rings that use it.");
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Reserving {} packet buffers of {} free.", entries, capacity - reserved);
+		reserved += entries;
+	}
+
+	/**
+	 * Returns the number of packet buffers reserved by the descriptor rings that use the memory pool.
+	 *
+	 * @return The number of reserved packet buffers.
+	 */
+	@Contract(pure = true)
+	public synchronized int getReserved() {
+		return reserved;
+	}
+
+	/**
+	 * Releases the packet buffers reserved with {@link #reserve(int)} by descriptor rings that stop using the memory
+	 * pool.
+	 *
+	 * @param entries The number of packet buffers.
+	 */
+	public synchronized void release(final int entries) {
+		if (!OPTIMIZED && (entries < 0 || entries > reserved)) {
+			throw new IllegalArgumentException("The parameter 'entries' MUST be inside [0, reserved].");
+		}
+		if (DEBUG >= LOG_DEBUG) log.debug("Releasing {} packet buffers.", entries);
+		reserved -= entries;
+	}
+
+	/**
+	 * Computes the index of a packet buffer in {@link #wrappers} given its virtual address.
+	 *
+	 * @param virtualAddress The virtual address of the packet buffer.
+	 * @return The index of the packet buffer.
+	 */
+	@Contract(pure = true)
+	private int index(final long virtualAddress) {
+		val diff = virtualAddress - base;
+		return (int) (entryShift >= 0 ? diff >>> entryShift : diff / entrySize);
+	}
+
 	//////////////////////////////////////////////// DELEGATED METHODS /////////////////////////////////////////////////
 
 	/**
@@ -272,7 +551,21 @@ public final class Mempool {
 	public void push(final @NotNull PacketBufferWrapper buffer) {
 		if (!OPTIMIZED && buffer == null) throw new NullPointerException("The parameter 'buffer' MUST NOT be null.");
 		if (DEBUG >= LOG_TRACE) log.trace("Pushing packet buffer wrapper to the memory pool: {}", buffer);
-		packetBufferWrappers.offerFirst(buffer);
+		if (ring == null) {
+			addresses.push(buffer.getVirtualAddress());
+		} else if (caches == null) {
+			ring.offer(buffer);
+		} else {
+			// Flush half of the cache to the shared ring when the cache is full
+			val cache = caches.get();
+			if (cache.size == cache.buffers.length) {
+				val flushed = ring.offer(cache.buffers, cacheSize, cacheSize);
+				if (!OPTIMIZED && flushed == 0) throw new IllegalStateException("The memory pool is full.");
+				System.arraycopy(cache.buffers, cacheSize + flushed, cache.buffers, cacheSize, cacheSize - flushed);
+				cache.size -= flushed;
+			}
+			cache.buffers[cache.size++] = buffer;
+		}
 	}
 
 	/**
@@ -282,7 +575,32 @@ public final class Mempool {
 	 */
 	public @Nullable PacketBufferWrapper pop() {
 		if (DEBUG >= LOG_TRACE) log.trace("Extracting packet buffer wrapper or null.");
-		return packetBufferWrappers.pollFirst();
+		if (ring == null) {
+			val address = addresses.pop();
+			return address == 0 ? null : wrappers[index(address)];
+		}
+		if (caches == null) return ring.poll();
+
+		// Refill the cache from the shared ring when the cache is empty
+		val cache = caches.get();
+		if (cache.size == 0) {
+			cache.size = ring.poll(cache.buffers, 0, cacheSize);
+			if (cache.size == 0) return null;
+		}
+		return cache.buffers[--cache.size];
+	}
+
+	/**
+	 * Returns the packet buffer wrappers cached by the current thread to the shared store.
+	 * <p>
+	 * This method does nothing if the memory pool is single-threaded or the per-thread caches are disabled.
+	 */
+	public void flush() {
+		if (caches == null) return;
+		if (DEBUG >= LOG_TRACE) log.trace("Flushing the packet buffer wrappers cached by the current thread.");
+		val cache = caches.get();
+		ring.offer(cache.buffers, 0, cache.size);
+		caches.remove();
 	}
 
 	/**
@@ -298,13 +616,39 @@ public final class Mempool {
 
 	/**
 	 * Returns the size of the memory pool.
+	 * <p>
+	 * When the memory pool is concurrent, only the packet buffer wrappers of the shared store and the cache of the
+	 * current thread are taken into account, and the result is only a snapshot.
 	 *
 	 * @return The size of the memory pool.
 	 */
 	@Contract(pure = true)
 	public int size() {
 		if (DEBUG >= LOG_TRACE) log.trace("Checking size.");
-		return packetBufferWrappers.size();
+		if (ring == null) return addresses.size();
+		return caches == null ? ring.size() : ring.size() + caches.get().size;
+	}
+
+	////////////////////////////////////////////////// INNER CLASSES ///////////////////////////////////////////////////
+
+	/** The local cache of packet buffer wrappers of a thread. */
+	private static final class Cache {
+
+		/** The cached packet buffer wrappers. */
+		private final @NotNull PacketBufferWrapper[] buffers;
+
+		/** The number of cached packet buffer wrappers. */
+		private int size;
+
+		/**
+		 * Creates a cache that can hold up to {@code 2 * cacheSize} packet buffer wrappers.
+		 *
+		 * @param cacheSize The size of the cache.
+		 */
+		private Cache(final int cacheSize) {
+			buffers = new PacketBufferWrapper[2 * cacheSize];
+		}
+
 	}
 
 }
\ No newline at end of file
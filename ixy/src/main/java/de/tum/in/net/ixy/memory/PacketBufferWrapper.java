@@ -1,5 +1,7 @@
 package de.tum.in.net.ixy.memory;
 
+import java.nio.ByteBuffer;
+
 import lombok.EqualsAndHashCode;
 import lombok.Getter;
 import lombok.RequiredArgsConstructor;
@@ -16,14 +18,32 @@ import static de.tum.in.net.ixy.BuildConfig.MEMORY_MANAGER;
 import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
 import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI;
 import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_VARHANDLE;
 import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.MPP_OFFSET;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.MSS_OFFSET;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.NXT_OFFSET;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_L2_LENGTH_MASK;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_L2_LENGTH_SHIFT;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_L3_LENGTH_MASK;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_L3_LENGTH_SHIFT;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_L4_LENGTH_MASK;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_L4_LENGTH_SHIFT;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.OFL_OFFSET;
 import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.PAP_OFFSET;
 import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.PAYLOAD_OFFSET;
 import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.PKT_OFFSET;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.RSS_OFFSET;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.RXF_OFFSET;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.SEG_OFFSET;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.VLN_OFFSET;
 import static de.tum.in.net.ixy.utils.Strings.leftPad;
 
 /**
  * Simple implementation of Ixy's packet buffer specification.
+ * <p>
+ * The header fields are only accessed by the CPU that owns the packet buffer, and a packet buffer changes its owner
+ * only through a {@link Mempool memory pool} or a descriptor ring, which already order the memory accesses. That is why
+ * all of them are read and written with plain memory operations.
  *
  * @author Esaú García Sánchez-Torija
  * @see PacketBufferWrapperConstants
@@ -42,6 +62,8 @@ public final class PacketBufferWrapper implements Comparable<PacketBufferWrapper
 			? JniMemoryManager.getSingleton()
 			: MEMORY_MANAGER == PREFER_JNI
 			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
 			: SmartUnsafeMemoryManager.getSingleton();
 
 	///////////////////////////////////////////////// MEMBER VARIABLES /////////////////////////////////////////////////
@@ -58,6 +80,37 @@ public final class PacketBufferWrapper implements Comparable<PacketBufferWrapper
 	@SuppressWarnings("JavaDoc")
 	private final long virtualAddress;
 
+	////////////////////////////////////////////////// STATIC METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Packs the lengths of the headers of a packet and the offloads requested for it into offload flags.
+	 *
+	 * @param l2Length The length of the layer 2 header.
+	 * @param l3Length The length of the layer 3 header.
+	 * @param l4Length The length of the layer 4 header.
+	 * @param flags    The requested offloads, a combination of {@link PacketBufferWrapperConstants#OFL_IP_CHECKSUM},
+	 *                 {@link PacketBufferWrapperConstants#OFL_UDP_CHECKSUM}, {@link
+	 *                 PacketBufferWrapperConstants#OFL_TCP_CHECKSUM}, {@link PacketBufferWrapperConstants#OFL_IPV6}
+	 *                 and {@link PacketBufferWrapperConstants#OFL_TSO}.
+	 * @return The offload flags.
+	 */
+	@Contract(pure = true)
+	public static int offload(final int l2Length, final int l3Length, final int l4Length, final int flags) {
+		if (!OPTIMIZED) {
+			if (l2Length < 0 || l2Length > OFL_L2_LENGTH_MASK) {
+				throw new IllegalArgumentException("The parameter 'l2Length' MUST be inside [0, 127].");
+			}
+			if (l3Length < 0 || l3Length > OFL_L3_LENGTH_MASK) {
+				throw new IllegalArgumentException("The parameter 'l3Length' MUST be inside [0, 511].");
+			}
+			if (l4Length < 0 || l4Length > OFL_L4_LENGTH_MASK) {
+				throw new IllegalArgumentException("The parameter 'l4Length' MUST be inside [0, 255].");
+			}
+		}
+		return (l2Length << OFL_L2_LENGTH_SHIFT) | (l3Length << OFL_L3_LENGTH_SHIFT)
+				| (l4Length << OFL_L4_LENGTH_SHIFT) | flags;
+	}
+
 	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
 
 	/**
@@ -70,7 +123,7 @@ public final class PacketBufferWrapper implements Comparable<PacketBufferWrapper
 		if (DEBUG >= LOG_TRACE) {
 			log.trace("Reading physical address pointer field @ 0x{} + {}.", leftPad(virtualAddress), PAP_OFFSET);
 		}
-		return mmanager.getLongVolatile(virtualAddress + PAP_OFFSET);
+		return mmanager.getLong(virtualAddress + PAP_OFFSET);
 	}
 
 	/**
@@ -82,7 +135,7 @@ public final class PacketBufferWrapper implements Comparable<PacketBufferWrapper
 		if (DEBUG >= LOG_TRACE) {
 			log.trace("Writing physical address pointer field @ 0x{} + {}.", leftPad(virtualAddress), PAP_OFFSET);
 		}
-		mmanager.putLongVolatile(virtualAddress + PAP_OFFSET, physicalAddress);
+		mmanager.putLong(virtualAddress + PAP_OFFSET, physicalAddress);
 	}
 
 	/**
@@ -95,7 +148,7 @@ public final class PacketBufferWrapper implements Comparable<PacketBufferWrapper
 		if (DEBUG >= LOG_TRACE) {
 			log.trace("Reading memory pool identifier field @ 0x{} + {}.", leftPad(virtualAddress), MPP_OFFSET);
 		}
-		return mmanager.getLongVolatile(virtualAddress + MPP_OFFSET);
+		return mmanager.getLong(virtualAddress + MPP_OFFSET);
 	}
 
 	/**
@@ -107,7 +160,7 @@ public final class PacketBufferWrapper implements Comparable<PacketBufferWrapper
 		if (DEBUG >= LOG_TRACE) {
 			log.trace("Writing memory pool identifier field @ 0x{} + {}.", leftPad(virtualAddress), MPP_OFFSET);
 		}
-		mmanager.putLongVolatile(virtualAddress + MPP_OFFSET, memoryPoolId);
+		mmanager.putLong(virtualAddress + MPP_OFFSET, memoryPoolId);
 	}
 
 	/**
@@ -120,7 +173,7 @@ public final class PacketBufferWrapper implements Comparable<PacketBufferWrapper
 		if (DEBUG >= LOG_TRACE) {
 			log.trace("Reading packet size field @ 0x{} + {}.", leftPad(virtualAddress), PKT_OFFSET);
 		}
-		return mmanager.getIntVolatile(virtualAddress + PKT_OFFSET);
+		return mmanager.getInt(virtualAddress + PKT_OFFSET);
 	}
 
 	/**
@@ -132,7 +185,196 @@ public final class PacketBufferWrapper implements Comparable<PacketBufferWrapper
 		if (DEBUG >= LOG_TRACE) {
 			log.trace("Writing packet size field @ 0x{} + {}.", leftPad(virtualAddress), PKT_OFFSET);
 		}
-		mmanager.putIntVolatile(virtualAddress + PKT_OFFSET, size);
+		mmanager.putInt(virtualAddress + PKT_OFFSET, size);
+	}
+
+	/**
+	 * Returns the offload flags of this packet buffer.
+	 *
+	 * @return The offload flags.
+	 * @see #offload(int, int, int, int)
+	 */
+	@Contract(pure = true)
+	public int getOffload() {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Reading offload flags field @ 0x{} + {}.", leftPad(virtualAddress), OFL_OFFSET);
+		}
+		return mmanager.getInt(virtualAddress + OFL_OFFSET);
+	}
+
+	/**
+	 * Sets the offload flags of this packet buffer, which are used by the NIC when the packet is sent.
+	 * <p>
+	 * The flags are cleared when the packet buffer is filled by a receive queue.
+	 *
+	 * @param offload The offload flags.
+	 * @see #offload(int, int, int, int)
+	 */
+	public void setOffload(final int offload) {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Writing offload flags field @ 0x{} + {}.", leftPad(virtualAddress), OFL_OFFSET);
+		}
+		mmanager.putInt(virtualAddress + OFL_OFFSET, offload);
+	}
+
+	/**
+	 * Returns the RX flags of this packet buffer, which describe the packet as classified by the NIC when it was
+	 * received.
+	 *
+	 * @return The RX flags.
+	 * @see PacketBufferWrapperConstants#RXF_IPV4
+	 */
+	@Contract(pure = true)
+	public int getRxFlags() {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Reading RX flags field @ 0x{} + {}.", leftPad(virtualAddress), RXF_OFFSET);
+		}
+		return mmanager.getInt(virtualAddress + RXF_OFFSET);
+	}
+
+	/**
+	 * Sets the RX flags of this packet buffer.
+	 *
+	 * @param flags The RX flags.
+	 * @see PacketBufferWrapperConstants#RXF_IPV4
+	 */
+	public void setRxFlags(final int flags) {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Writing RX flags field @ 0x{} + {}.", leftPad(virtualAddress), RXF_OFFSET);
+		}
+		mmanager.putInt(virtualAddress + RXF_OFFSET, flags);
+	}
+
+	/**
+	 * Returns the RSS hash of this packet buffer, which is only valid when the RX flags contain {@link
+	 * PacketBufferWrapperConstants#RXF_RSS_HASH}.
+	 *
+	 * @return The RSS hash.
+	 */
+	@Contract(pure = true)
+	public int getRssHash() {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Reading RSS hash field @ 0x{} + {}.", leftPad(virtualAddress), RSS_OFFSET);
+		}
+		return mmanager.getInt(virtualAddress + RSS_OFFSET);
+	}
+
+	/**
+	 * Sets the RSS hash of this packet buffer.
+	 *
+	 * @param hash The RSS hash.
+	 */
+	public void setRssHash(final int hash) {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Writing RSS hash field @ 0x{} + {}.", leftPad(virtualAddress), RSS_OFFSET);
+		}
+		mmanager.putInt(virtualAddress + RSS_OFFSET, hash);
+	}
+
+	/**
+	 * Returns the VLAN tag of this packet buffer, which is only valid when the RX flags contain {@link
+	 * PacketBufferWrapperConstants#RXF_VLAN}.
+	 *
+	 * @return The VLAN tag.
+	 */
+	@Contract(pure = true)
+	public short getVlanTag() {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Reading VLAN tag field @ 0x{} + {}.", leftPad(virtualAddress), VLN_OFFSET);
+		}
+		return mmanager.getShort(virtualAddress + VLN_OFFSET);
+	}
+
+	/**
+	 * Sets the VLAN tag of this packet buffer.
+	 *
+	 * @param tag The VLAN tag.
+	 */
+	public void setVlanTag(final short tag) {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Writing VLAN tag field @ 0x{} + {}.", leftPad(virtualAddress), VLN_OFFSET);
+		}
+		mmanager.putShort(virtualAddress + VLN_OFFSET, tag);
+	}
+
+	/**
+	 * Returns the number of packet buffers that store the packet, which is only valid in the first one of the chain.
+	 *
+	 * @return The number of segments.
+	 */
+	@Contract(pure = true)
+	public int getSegments() {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Reading segments field @ 0x{} + {}.", leftPad(virtualAddress), SEG_OFFSET);
+		}
+		return mmanager.getShort(virtualAddress + SEG_OFFSET) & 0xFFFF;
+	}
+
+	/**
+	 * Sets the number of packet buffers that store the packet.
+	 *
+	 * @param segments The number of segments.
+	 */
+	public void setSegments(final int segments) {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Writing segments field @ 0x{} + {}.", leftPad(virtualAddress), SEG_OFFSET);
+		}
+		mmanager.putShort(virtualAddress + SEG_OFFSET, (short) segments);
+	}
+
+	/**
+	 * Returns the maximum segment size used by the NIC to split the TCP payload of the packet when it is sent.
+	 *
+	 * @return The maximum segment size.
+	 * @see PacketBufferWrapperConstants#OFL_TSO
+	 */
+	@Contract(pure = true)
+	public int getMss() {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Reading maximum segment size field @ 0x{} + {}.", leftPad(virtualAddress), MSS_OFFSET);
+		}
+		return mmanager.getShort(virtualAddress + MSS_OFFSET) & 0xFFFF;
+	}
+
+	/**
+	 * Sets the maximum segment size used by the NIC to split the TCP payload of the packet when it is sent.
+	 * <p>
+	 * The value is only used when the offload flags contain {@link PacketBufferWrapperConstants#OFL_TSO}.
+	 *
+	 * @param mss The maximum segment size.
+	 */
+	public void setMss(final int mss) {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Writing maximum segment size field @ 0x{} + {}.", leftPad(virtualAddress), MSS_OFFSET);
+		}
+		mmanager.putShort(virtualAddress + MSS_OFFSET, (short) mss);
+	}
+
+	/**
+	 * Returns the virtual address of the packet buffer that stores the next segment of the packet.
+	 *
+	 * @return The virtual address of the next segment, or {@code 0} if this is the last one.
+	 */
+	@Contract(pure = true)
+	public long getNext() {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Reading next segment pointer field @ 0x{} + {}.", leftPad(virtualAddress), NXT_OFFSET);
+		}
+		return mmanager.getLong(virtualAddress + NXT_OFFSET);
+	}
+
+	/**
+	 * Sets the virtual address of the packet buffer that stores the next segment of the packet.
+	 * <p>
+	 * The segments of a chain must belong to the same {@link Mempool memory pool}.
+	 *
+	 * @param next The virtual address of the next segment, or {@code 0} if this is the last one.
+	 */
+	public void setNext(final long next) {
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Writing next segment pointer field @ 0x{} + {}.", leftPad(virtualAddress), NXT_OFFSET);
+		}
+		mmanager.putLong(virtualAddress + NXT_OFFSET, next);
 	}
 
 	/**
@@ -299,6 +541,48 @@ public final class PacketBufferWrapper implements Comparable<PacketBufferWrapper
 		mmanager.put(virtualAddress + PAYLOAD_OFFSET, bytes, buffer, offset);
 	}
 
+	/**
+	 * Copies from a packet data region into a {@link ByteBuffer}.
+	 * <p>
+	 * The data is written at the position of {@code buffer}, which is advanced by {@code bytes}. A direct buffer is
+	 * filled straight from the packet data, without any intermediate {@code byte[]}.
+	 *
+	 * @param offset The offset of the packet data from which to start copying.
+	 * @param bytes  The number of bytes to copy.
+	 * @param buffer The buffer to copy to.
+	 */
+	public void get(final int offset, final int bytes, final @NotNull ByteBuffer buffer) {
+		if (!OPTIMIZED) {
+			if (buffer == null) throw new NullPointerException("The parameter 'buffer' MUST NOT be null.");
+			if (offset < 0) throw new IllegalArgumentException("The parameter 'offset' MUST NOT be negative.");
+		}
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Reading packet payload chunk of {} bytes @ offset '{}'.", bytes, leftPad(offset));
+		}
+		mmanager.get(virtualAddress + PAYLOAD_OFFSET + offset, bytes, buffer);
+	}
+
+	/**
+	 * Copies into a packet data region from a {@link ByteBuffer}.
+	 * <p>
+	 * The data is read from the position of {@code buffer}, which is advanced by {@code bytes}. A direct buffer is
+	 * copied straight into the packet data, without any intermediate {@code byte[]}.
+	 *
+	 * @param offset The offset of the packet data from which to start copying.
+	 * @param bytes  The number of bytes to copy.
+	 * @param buffer The buffer to copy from.
+	 */
+	public void put(final int offset, final int bytes, final @NotNull ByteBuffer buffer) {
+		if (!OPTIMIZED) {
+			if (buffer == null) throw new NullPointerException("The parameter 'buffer' MUST NOT be null.");
+			if (offset < 0) throw new IllegalArgumentException("The parameter 'offset' MUST NOT be negative.");
+		}
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Writing packet payload chunk of {} bytes @ offset '{}'.", bytes, leftPad(offset));
+		}
+		mmanager.put(virtualAddress + PAYLOAD_OFFSET + offset, bytes, buffer);
+	}
+
 	//////////////////////////////////////////////// OVERRIDDEN METHODS ////////////////////////////////////////////////
 
 	@Override
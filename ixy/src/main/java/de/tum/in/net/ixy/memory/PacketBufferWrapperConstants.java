@@ -13,11 +13,43 @@ import lombok.NoArgsConstructor;
  * |---------------------------------------|
  * |         Memory Pool "Pointer"         |
  * |---------------------------------------|
- * |     Reserved      |    Packet Size    | 64 bytes
+ * |   Offload Flags   |    Packet Size    |
+ * |---------------------------------------| 64 bytes
+ * |     RSS Hash      |     RX Flags      |
+ * |---------------------------------------|
+ * | VLAN Tag | Segments |  MSS   |Reserved|
+ * |---------------------------------------|
+ * |         Next Segment Pointer          |
  * |---------------------------------------|
  * |          Headroom (variable)          |
  * \---------------------------------------/
  * </pre>
+ * The offload flags request the NIC to compute some fields of the packet when it is sent, and they are packed as
+ * depicted below:
+ * <pre>
+ *   31  28   27  26  25  24 23       16 15      9 8        0
+ * /----/---/----/---/---/---/-----------/---------/----------\
+ * |    |TSO|IPv6|TCP|UDP|IP | L4 Length |L2 Length|L3 Length |
+ * \----/---/----/---/---/---/-----------/---------/----------/
+ * </pre>
+ * When TCP segmentation is requested, the NIC splits the TCP payload of the packet in segments of at most the maximum
+ * segment size (MSS) stored in the header, replicating the headers of the packet in every segment.
+ * <p>
+ * The RX flags, the RSS hash and the VLAN tag are written by the driver when a packet is received, and describe what
+ * the NIC found out about it. The RX flags are packed as depicted below:
+ * <pre>
+ *   31    11  10   9    8    7    6    5    4    3   2    1    0
+ * /--------/----/---/----/----/----/----/----/---/---/----/----\
+ * |        |VLAN|RSS|L4- |L4+ |IP- |IP+ |SCTP|UDP|TCP|IPv6|IPv4|
+ * \--------/----/---/----/----/----/----/----/---/---/----/----/
+ * </pre>
+ * The {@code +} and {@code -} flags tell whether the NIC verified the checksum of the layer and found it right or
+ * wrong; when neither is set, the checksum was not verified and must be checked in software.
+ * <p>
+ * A packet that does not fit in a single packet buffer is stored in a chain of packet buffers linked by the virtual
+ * address of the next segment, which is {@code 0} in the last one. The packet size of every packet buffer is the size
+ * of its own segment, and the first packet buffer stores the number of segments of the whole chain and all the other
+ * metadata of the packet.
  *
  * @author Esaú García Sánchez-Torija
  */
@@ -33,9 +65,30 @@ public final class PacketBufferWrapperConstants {
 	/** The size in bits of the memory pool pointer field. */
 	public static final int MPP_SIZE = Long.SIZE;
 
+	/** The size in bits of the offload flags field. */
+	public static final int OFL_SIZE = Integer.SIZE;
+
 	/** The size in bits of the packet size field. */
 	public static final int PKT_SIZE = Integer.SIZE;
 
+	/** The size in bits of the RSS hash field. */
+	public static final int RSS_SIZE = Integer.SIZE;
+
+	/** The size in bits of the RX flags field. */
+	public static final int RXF_SIZE = Integer.SIZE;
+
+	/** The size in bits of the VLAN tag field. */
+	public static final int VLN_SIZE = Short.SIZE;
+
+	/** The size in bits of the segments field. */
+	public static final int SEG_SIZE = Short.SIZE;
+
+	/** The size in bits of the maximum segment size field. */
+	public static final int MSS_SIZE = Short.SIZE;
+
+	/** The size in bits of the next segment pointer field. */
+	public static final int NXT_SIZE = Long.SIZE;
+
 	/** The size in bits of the packet buffer header. */
 	public static final int HEADER_SIZE = 64 * Byte.SIZE;
 
@@ -47,9 +100,30 @@ public final class PacketBufferWrapperConstants {
 	/** The size in bytes of the memory pool pointer field. */
 	public static final int MPP_BYTES = MPP_SIZE / Byte.SIZE;
 
+	/** The size in bytes of the offload flags field. */
+	public static final int OFL_BYTES = OFL_SIZE / Byte.SIZE;
+
 	/** The size in bytes of the packet size field. */
 	public static final int PKT_BYTES = PKT_SIZE / Byte.SIZE;
 
+	/** The size in bytes of the RSS hash field. */
+	public static final int RSS_BYTES = RSS_SIZE / Byte.SIZE;
+
+	/** The size in bytes of the RX flags field. */
+	public static final int RXF_BYTES = RXF_SIZE / Byte.SIZE;
+
+	/** The size in bytes of the VLAN tag field. */
+	public static final int VLN_BYTES = VLN_SIZE / Byte.SIZE;
+
+	/** The size in bytes of the segments field. */
+	public static final int SEG_BYTES = SEG_SIZE / Byte.SIZE;
+
+	/** The size in bytes of the maximum segment size field. */
+	public static final int MSS_BYTES = MSS_SIZE / Byte.SIZE;
+
+	/** The size in bytes of the next segment pointer field. */
+	public static final int NXT_BYTES = NXT_SIZE / Byte.SIZE;
+
 	/** The size in bytes of the packet buffer header. */
 	public static final int HEADER_BYTES = HEADER_SIZE / Byte.SIZE;
 
@@ -64,10 +138,104 @@ public final class PacketBufferWrapperConstants {
 	/** The offset of the memory pool pointer field. */
 	public static final int MPP_OFFSET = PAP_OFFSET + PAP_BYTES;
 
+	/** The offset of the offload flags field. */
+	public static final int OFL_OFFSET = MPP_OFFSET + MPP_BYTES;
+
 	/** The offset of the packet size field. */
-	public static final int PKT_OFFSET = MPP_OFFSET + Integer.BYTES + MPP_BYTES;
+	public static final int PKT_OFFSET = OFL_OFFSET + OFL_BYTES;
+
+	/** The offset of the RSS hash field. */
+	public static final int RSS_OFFSET = PKT_OFFSET + PKT_BYTES;
+
+	/** The offset of the RX flags field. */
+	public static final int RXF_OFFSET = RSS_OFFSET + RSS_BYTES;
+
+	/** The offset of the VLAN tag field. */
+	public static final int VLN_OFFSET = RXF_OFFSET + RXF_BYTES;
+
+	/** The offset of the segments field. */
+	public static final int SEG_OFFSET = VLN_OFFSET + VLN_BYTES;
+
+	/** The offset of the maximum segment size field. */
+	public static final int MSS_OFFSET = SEG_OFFSET + SEG_BYTES;
+
+	/** The offset of the next segment pointer field, which is aligned to its size. */
+	public static final int NXT_OFFSET = (MSS_OFFSET + MSS_BYTES + NXT_BYTES - 1) & -NXT_BYTES;
 
 	/** The offset of the payload of the buffer. */
 	public static final int PAYLOAD_OFFSET = HEADER_OFFSET + HEADER_BYTES;
 
+	////////////////////////////////////////////////// OFFLOAD FLAGS ///////////////////////////////////////////////////
+
+	/** The shift of the length of the layer 3 header inside the offload flags. */
+	public static final int OFL_L3_LENGTH_SHIFT = 0;
+
+	/** The maximum length of the layer 3 header that can be stored inside the offload flags. */
+	public static final int OFL_L3_LENGTH_MASK = 0x1FF;
+
+	/** The shift of the length of the layer 2 header inside the offload flags. */
+	public static final int OFL_L2_LENGTH_SHIFT = 9;
+
+	/** The maximum length of the layer 2 header that can be stored inside the offload flags. */
+	public static final int OFL_L2_LENGTH_MASK = 0x7F;
+
+	/** The shift of the length of the layer 4 header inside the offload flags. */
+	public static final int OFL_L4_LENGTH_SHIFT = 16;
+
+	/** The maximum length of the layer 4 header that can be stored inside the offload flags. */
+	public static final int OFL_L4_LENGTH_MASK = 0xFF;
+
+	/** The flag that requests the NIC to compute the IPv4 header checksum. */
+	public static final int OFL_IP_CHECKSUM = 1 << 24;
+
+	/** The flag that requests the NIC to compute the UDP checksum. */
+	public static final int OFL_UDP_CHECKSUM = 1 << 25;
+
+	/** The flag that requests the NIC to compute the TCP checksum. */
+	public static final int OFL_TCP_CHECKSUM = 1 << 26;
+
+	/** The flag that tells the NIC that the layer 3 header is an IPv6 header instead of an IPv4 header. */
+	public static final int OFL_IPV6 = 1 << 27;
+
+	/**
+	 * The flag that requests the NIC to split the TCP payload in segments of the maximum segment size, which requires
+	 * {@link #OFL_TCP_CHECKSUM} too.
+	 */
+	public static final int OFL_TSO = 1 << 28;
+
+	///////////////////////////////////////////////////// RX FLAGS /////////////////////////////////////////////////////
+
+	/** The flag that tells that the layer 3 header is an IPv4 header. */
+	public static final int RXF_IPV4 = 1;
+
+	/** The flag that tells that the layer 3 header is an IPv6 header. */
+	public static final int RXF_IPV6 = 1 << 1;
+
+	/** The flag that tells that the layer 4 header is a TCP header. */
+	public static final int RXF_TCP = 1 << 2;
+
+	/** The flag that tells that the layer 4 header is a UDP header. */
+	public static final int RXF_UDP = 1 << 3;
+
+	/** The flag that tells that the layer 4 header is an SCTP header. */
+	public static final int RXF_SCTP = 1 << 4;
+
+	/** The flag that tells that the NIC verified the IPv4 header checksum and it is right. */
+	public static final int RXF_IP_CHECKSUM_GOOD = 1 << 5;
+
+	/** The flag that tells that the NIC verified the IPv4 header checksum and it is wrong. */
+	public static final int RXF_IP_CHECKSUM_BAD = 1 << 6;
+
+	/** The flag that tells that the NIC verified the layer 4 checksum and it is right. */
+	public static final int RXF_L4_CHECKSUM_GOOD = 1 << 7;
+
+	/** The flag that tells that the NIC verified the layer 4 checksum and it is wrong. */
+	public static final int RXF_L4_CHECKSUM_BAD = 1 << 8;
+
+	/** The flag that tells that the RSS hash field is valid. */
+	public static final int RXF_RSS_HASH = 1 << 9;
+
+	/** The flag that tells that the packet had an 802.1Q tag, which is stored in the VLAN tag field. */
+	public static final int RXF_VLAN = 1 << 10;
+
 }
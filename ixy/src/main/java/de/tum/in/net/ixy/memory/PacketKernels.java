@@ -0,0 +1,251 @@
+package de.tum.in.net.ixy.memory;
+
+import de.tum.in.net.ixy.utils.Native;
+
+import lombok.AccessLevel;
+import lombok.Getter;
+import lombok.NoArgsConstructor;
+import lombok.extern.slf4j.Slf4j;
+import lombok.val;
+
+import org.jetbrains.annotations.Contract;
+import org.jetbrains.annotations.NotNull;
+
+import static de.tum.in.net.ixy.BuildConfig.DEBUG;
+import static de.tum.in.net.ixy.BuildConfig.LOG_INFO;
+import static de.tum.in.net.ixy.BuildConfig.LOG_TRACE;
+import static de.tum.in.net.ixy.BuildConfig.LOG_WARN;
+import static de.tum.in.net.ixy.BuildConfig.MEMORY_MANAGER;
+import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_VARHANDLE;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.PAYLOAD_OFFSET;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.PKT_OFFSET;
+
+/**
+ * Bulk kernels that copy, fill or rewrite the payload of a whole batch of packet buffers in a single call.
+ * <p>
+ * The packet buffers are identified by their virtual addresses, as returned by {@link Mempool#pop(long[], int)} or
+ * {@link PacketBufferWrapper#getVirtualAddress()}, and all the offsets are relative to the start of the payload.
+ * <p>
+ * The {@code native} library selects once the widest kernels the CPU supports (AVX2, SSE2 or plain {@code memcpy} and
+ * {@code memset}). When the library is not available, the kernels fall back to the memory manager selected by the
+ * build configuration, copying whole regions with a single bulk write and filling them a {@code long} at a time.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@Slf4j
+@NoArgsConstructor(access = AccessLevel.PRIVATE)
+@SuppressWarnings({"ConstantConditions", "Duplicates", "PMD.AvoidDuplicateLiterals"})
+public final class PacketKernels {
+
+	///////////////////////////////////////////////// STATIC VARIABLES /////////////////////////////////////////////////
+
+	/** The names of the {@code native} kernels, indexed by the level returned by {@link #c_kernel()}. */
+	private static final @NotNull String[] KERNELS = {"scalar", "sse2", "avx2"};
+
+	/** The name of the kernels implemented in Java. */
+	private static final @NotNull String JAVA_KERNEL = "java";
+
+	/** The factor that spreads a {@code byte} over all the bytes of a {@code long}. */
+	private static final long SPREAD = 0x0101010101010101L;
+
+	/** The memory manager used when the {@code native} library is not available. */
+	@SuppressWarnings("NestedConditionalExpression")
+	private static final @NotNull MemoryManager mmanager = MEMORY_MANAGER == PREFER_JNI_FULL
+			? JniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_JNI
+			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
+			: SmartUnsafeMemoryManager.getSingleton();
+
+	/**
+	 * The name of the kernels in use.
+	 * -- GETTER --
+	 * Returns the name of the kernels in use, which is one of {@code avx2}, {@code sse2}, {@code scalar} or {@code
+	 * java}.
+	 *
+	 * @return The name of the kernels.
+	 */
+	@Getter
+	@SuppressWarnings("JavaDoc")
+	private static final @NotNull String kernel;
+
+	/** Whether the {@code native} kernels are available. */
+	private static final boolean available;
+
+	static {
+		Native.loadLibrary("ixy", "resources");
+		var name = JAVA_KERNEL;
+		try {
+			name = KERNELS[c_kernel()];
+		} catch (final UnsatisfiedLinkError e) {
+			if (DEBUG >= LOG_WARN) log.warn("The native packet kernels are not available.", e);
+		}
+		if (DEBUG >= LOG_INFO) log.info("Using the '{}' packet kernels.", name);
+		kernel = name;
+		available = !JAVA_KERNEL.equals(name);
+	}
+
+	////////////////////////////////////////////////// NATIVE METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Returns the level of the kernels selected by the {@code native} library.
+	 *
+	 * @return {@code 0} for the scalar kernels, {@code 1} for the SSE2 kernels or {@code 2} for the AVX2 kernels.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native int c_kernel();
+
+	/**
+	 * Fills the same region of the payload of a batch of packet buffers with a {@code byte}.
+	 *
+	 * @param addresses The virtual addresses of the packet buffers.
+	 * @param count     The number of packet buffers.
+	 * @param offset    The offset of the region inside the payload.
+	 * @param bytes     The size of the region.
+	 * @param value     The {@code byte} to write.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native void c_fill(@NotNull long[] addresses, int count, int offset, int bytes, byte value);
+
+	/**
+	 * Copies the same data into the payload of a batch of packet buffers.
+	 *
+	 * @param addresses The virtual addresses of the packet buffers.
+	 * @param count     The number of packet buffers.
+	 * @param offset    The offset of the region inside the payload.
+	 * @param src       The data.
+	 * @param bytes     The number of bytes to copy.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native void c_copy(@NotNull long[] addresses, int count, int offset, @NotNull byte[] src, int bytes);
+
+	/**
+	 * Writes a template, the packet size and a sequence number into a batch of packet buffers.
+	 *
+	 * @param addresses The virtual addresses of the packet buffers.
+	 * @param count     The number of packet buffers.
+	 * @param template  The template of the payload.
+	 * @param bytes     The size of the template.
+	 * @param field     The offset of the sequence number inside the payload.
+	 * @param value     The sequence number of the first packet buffer.
+	 * @return The sequence number that follows the one of the last packet buffer.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native int c_patch(@NotNull long[] addresses, int count, @NotNull byte[] template, int bytes,
+									  int field, int value);
+
+	////////////////////////////////////////////////// STATIC METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Fills the same region of the payload of a batch of packet buffers with a {@code byte}.
+	 *
+	 * @param addresses The virtual addresses of the packet buffers.
+	 * @param count     The number of packet buffers.
+	 * @param offset    The offset of the region inside the payload.
+	 * @param bytes     The size of the region.
+	 * @param value     The {@code byte} to write.
+	 */
+	public static void fill(final @NotNull long[] addresses, final int count, final int offset, final int bytes,
+							final byte value) {
+		if (!OPTIMIZED) {
+			if (addresses == null) throw new NullPointerException("The parameter 'addresses' MUST NOT be null.");
+			if (count < 0 || count > addresses.length) {
+				throw new IllegalArgumentException("The parameter 'count' MUST be inside [0, addresses.length].");
+			}
+			if (offset < 0) throw new IllegalArgumentException("The parameter 'offset' MUST NOT be negative.");
+			if (bytes < 0) throw new IllegalArgumentException("The parameter 'bytes' MUST NOT be negative.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Filling {} bytes of {} packet buffers.", bytes, count);
+		if (count == 0 || bytes == 0) return;
+		if (available) {
+			c_fill(addresses, count, offset, bytes, value);
+			return;
+		}
+		val word = (value & 0xFF) * SPREAD;
+		val words = bytes & -Long.BYTES;
+		for (var i = 0; i < count; i += 1) {
+			val base = addresses[i] + PAYLOAD_OFFSET + offset;
+			for (var j = 0; j < words; j += Long.BYTES) mmanager.putLong(base + j, word);
+			for (var j = words; j < bytes; j += 1) mmanager.putByte(base + j, value);
+		}
+	}
+
+	/**
+	 * Copies the same data into the payload of a batch of packet buffers.
+	 *
+	 * @param addresses The virtual addresses of the packet buffers.
+	 * @param count     The number of packet buffers.
+	 * @param offset    The offset of the region inside the payload.
+	 * @param src       The data.
+	 * @param bytes     The number of bytes to copy.
+	 */
+	public static void copy(final @NotNull long[] addresses, final int count, final int offset,
+							final @NotNull byte[] src, final int bytes) {
+		if (!OPTIMIZED) {
+			if (addresses == null) throw new NullPointerException("The parameter 'addresses' MUST NOT be null.");
+			if (src == null) throw new NullPointerException("The parameter 'src' MUST NOT be null.");
+			if (count < 0 || count > addresses.length) {
+				throw new IllegalArgumentException("The parameter 'count' MUST be inside [0, addresses.length].");
+			}
+			if (offset < 0) throw new IllegalArgumentException("The parameter 'offset' MUST NOT be negative.");
+			if (bytes < 0 || bytes > src.length) {
+				throw new IllegalArgumentException("The parameter 'bytes' MUST be inside [0, src.length].");
+			}
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Copying {} bytes to {} packet buffers.", bytes, count);
+		if (count == 0 || bytes == 0) return;
+		if (available) {
+			c_copy(addresses, count, offset, src, bytes);
+			return;
+		}
+		for (var i = 0; i < count; i += 1) mmanager.put(addresses[i] + PAYLOAD_OFFSET + offset, bytes, src, 0);
+	}
+
+	/**
+	 * Writes a template into the payload of a batch of packet buffers, sets their size to the size of the template and
+	 * patches an {@code int} field of each one with consecutive sequence numbers.
+	 * <p>
+	 * The sequence number is written with the native byte order, the same way {@link PacketBufferWrapper#putInt(int,
+	 * int)} does.
+	 *
+	 * @param addresses The virtual addresses of the packet buffers.
+	 * @param count     The number of packet buffers.
+	 * @param template  The template of the payload.
+	 * @param bytes     The size of the template.
+	 * @param field     The offset of the sequence number inside the payload.
+	 * @param value     The sequence number of the first packet buffer.
+	 * @return The sequence number that follows the one of the last packet buffer.
+	 */
+	public static int patch(final @NotNull long[] addresses, final int count, final @NotNull byte[] template,
+							final int bytes, final int field, int value) {
+		if (!OPTIMIZED) {
+			if (addresses == null) throw new NullPointerException("The parameter 'addresses' MUST NOT be null.");
+			if (template == null) throw new NullPointerException("The parameter 'template' MUST NOT be null.");
+			if (count < 0 || count > addresses.length) {
+				throw new IllegalArgumentException("The parameter 'count' MUST be inside [0, addresses.length].");
+			}
+			if (bytes <= 0 || bytes > template.length) {
+				throw new IllegalArgumentException("The parameter 'bytes' MUST be inside (0, template.length].");
+			}
+			if (field < 0 || field > bytes - Integer.BYTES) {
+				throw new IllegalArgumentException("The parameter 'field' MUST be inside the template.");
+			}
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Patching {} packet buffers with a template of {} bytes.", count, bytes);
+		if (count == 0) return value;
+		if (available) return c_patch(addresses, count, template, bytes, field, value);
+		for (var i = 0; i < count; i += 1) {
+			val address = addresses[i];
+			mmanager.put(address + PAYLOAD_OFFSET, bytes, template, 0);
+			mmanager.putInt(address + PKT_OFFSET, bytes);
+			mmanager.putInt(address + PAYLOAD_OFFSET + field, value++);
+		}
+		return value;
+	}
+
+}
@@ -0,0 +1,186 @@
+package de.tum.in.net.ixy.memory;
+
+import java.io.FileNotFoundException;
+import java.io.IOException;
+import java.io.RandomAccessFile;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.channels.FileChannel;
+import java.util.Arrays;
+
+import lombok.ToString;
+import lombok.extern.slf4j.Slf4j;
+import lombok.val;
+
+import org.jetbrains.annotations.Contract;
+import org.jetbrains.annotations.NotNull;
+import org.jetbrains.annotations.Nullable;
+
+import static de.tum.in.net.ixy.BuildConfig.DEBUG;
+import static de.tum.in.net.ixy.BuildConfig.LOG_DEBUG;
+import static de.tum.in.net.ixy.BuildConfig.LOG_ERROR;
+import static de.tum.in.net.ixy.BuildConfig.LOG_TRACE;
+import static de.tum.in.net.ixy.utils.Strings.leftPad;
+
+import static java.io.File.separator;
+
+/**
+ * A translator of virtual addresses to physical addresses backed by Linux' {@code /proc/self/pagemap} file.
+ * <p>
+ * The file is opened the first time an address is translated and kept open afterwards. Every read is positional, so
+ * the same instance can be shared by several threads, and whole memory regions are translated with a single read.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@Slf4j
+@ToString(onlyExplicitlyIncluded = true, doNotUseGetters = true)
+final class Pagemap {
+
+	//////////////////////////////////////////////////// FILE PATHS ////////////////////////////////////////////////////
+
+	/** The page map file. */
+	private static final @NotNull String PAGEMAP_PATH = separator + String.join(separator, "proc", "self", "pagemap");
+
+	///////////////////////////////////////////////// STATIC VARIABLES /////////////////////////////////////////////////
+
+	/** The mask of the page frame number of a page map entry. */
+	private static final long PFN_MASK = 0x7F_FFFF_FFFF_FFFFL;
+
+	///////////////////////////////////////////////// MEMBER VARIABLES /////////////////////////////////////////////////
+
+	/** The memory page size. */
+	@ToString.Include
+	private final long pageSize;
+
+	/** The channel of the page map file, or {@code null} if it has not been opened yet. */
+	private volatile @Nullable FileChannel channel;
+
+	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Creates a translator for the given memory page size.
+	 *
+	 * @param pageSize The memory page size.
+	 */
+	Pagemap(final long pageSize) {
+		this.pageSize = pageSize;
+	}
+
+	/**
+	 * Translates a virtual address to a physical address.
+	 *
+	 * @param address The virtual address.
+	 * @return The physical address or {@code 0} if it cannot be translated.
+	 */
+	@Contract(pure = true)
+	long translate(final long address) {
+		if (DEBUG >= LOG_TRACE) log.trace("Translating virtual address 0x{} to physical address.", leftPad(address));
+		val buffer = read(Long.divideUnsigned(address, pageSize), 1);
+		return buffer == null ? 0 : (buffer.getLong(0) & PFN_MASK) * pageSize + (address & (pageSize - 1));
+	}
+
+	/**
+	 * Translates the virtual addresses of {@code count} consecutive blocks of {@code step} bytes to physical addresses.
+	 * <p>
+	 * If {@code hugepageSize} is positive, only the first address of every huge memory page is translated and the rest
+	 * are computed from it. Otherwise the entries of all the memory pages of the region are read at once.
+	 *
+	 * @param address      The virtual address of the first block.
+	 * @param step         The size of a block.
+	 * @param count        The number of blocks.
+	 * @param hugepageSize The huge memory page size that backs the region, or {@code 0} for regular memory pages.
+	 * @param physical     The array where the physical addresses will be stored.
+	 */
+	@Contract(mutates = "param5")
+	void translate(final long address,
+				   final long step,
+				   final int count,
+				   final long hugepageSize,
+				   final @NotNull long[] physical) {
+		if (count <= 0) return;
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Translating {} blocks of {} bytes @ 0x{} to physical addresses.", count, step, leftPad(address));
+		}
+
+		// Huge memory pages are physically contiguous
+		if (hugepageSize > 0) {
+			var page = -1L;
+			var base = 0L;
+			for (var i = 0; i < count; i += 1) {
+				val virtual = address + i * step;
+				val offset = Long.remainderUnsigned(virtual, hugepageSize);
+				if (Long.divideUnsigned(virtual, hugepageSize) != page) {
+					page = Long.divideUnsigned(virtual, hugepageSize);
+					val translated = translate(virtual);
+					base = translated == 0 ? 0 : translated - offset;
+				}
+				physical[i] = base == 0 ? 0 : base + offset;
+			}
+			return;
+		}
+
+		// Read all the page map entries of the memory region at once
+		val first = Long.divideUnsigned(address, pageSize);
+		val last = Long.divideUnsigned(address + (count - 1) * step, pageSize);
+		val buffer = read(first, (int) (last - first + 1));
+		if (buffer == null) {
+			Arrays.fill(physical, 0, count, 0);
+			return;
+		}
+		val mask = pageSize - 1;
+		for (var i = 0; i < count; i += 1) {
+			val virtual = address + i * step;
+			val entry = buffer.getLong((int) (Long.divideUnsigned(virtual, pageSize) - first) * Long.BYTES);
+			physical[i] = (entry & PFN_MASK) * pageSize + (virtual & mask);
+		}
+	}
+
+	/**
+	 * Reads consecutive page map entries with a single positional read.
+	 *
+	 * @param page    The number of the first memory page.
+	 * @param entries The number of entries.
+	 * @return The entries in native order or {@code null} if they cannot be read.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("PMD.DataflowAnomalyAnalysis")
+	private @Nullable ByteBuffer read(final long page, final int entries) {
+		val pagemap = channel();
+		if (pagemap == null) return null;
+		val buffer = ByteBuffer.allocate(entries * Long.BYTES).order(ByteOrder.nativeOrder());
+		try {
+			val position = page * Long.BYTES;
+			while (buffer.hasRemaining()) {
+				if (pagemap.read(buffer, position + buffer.position()) < 0) return null;
+			}
+			return buffer;
+		} catch (final IOException e) {
+			if (DEBUG >= LOG_ERROR) {
+				log.error("The file '{}' cannot be read or we read past its size.", PAGEMAP_PATH, e);
+			}
+		}
+		return null;
+	}
+
+	/**
+	 * Returns the channel of the page map file, opening it if needed.
+	 *
+	 * @return The channel or {@code null} if the file cannot be opened.
+	 */
+	@SuppressWarnings("resource")
+	private @Nullable FileChannel channel() {
+		val current = channel;
+		if (current != null) return current;
+		synchronized (this) {
+			if (channel != null) return channel;
+			if (DEBUG >= LOG_DEBUG) log.debug("Opening file '{}'.", PAGEMAP_PATH);
+			try {
+				channel = new RandomAccessFile(PAGEMAP_PATH, "r").getChannel();
+			} catch (final FileNotFoundException e) {
+				if (DEBUG >= LOG_ERROR) log.error("The file '{}' cannot be found.", PAGEMAP_PATH, e);
+			}
+			return channel;
+		}
+	}
+
+}
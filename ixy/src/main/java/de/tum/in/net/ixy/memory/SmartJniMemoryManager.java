@@ -8,10 +8,8 @@ import java.io.FileInputStream;
 import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.io.InputStreamReader;
-import java.io.RandomAccessFile;
-import java.nio.ByteBuffer;
-import java.nio.ByteOrder;
 import java.nio.charset.StandardCharsets;
+import java.util.Arrays;
 import java.util.Locale;
 import java.util.regex.Pattern;
 
@@ -32,7 +30,6 @@ import static de.tum.in.net.ixy.BuildConfig.LOG_ERROR;
 import static de.tum.in.net.ixy.BuildConfig.LOG_TRACE;
 import static de.tum.in.net.ixy.BuildConfig.LOG_WARN;
 import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
-import static de.tum.in.net.ixy.utils.Strings.leftPad;
 
 import static java.io.File.separator;
 
@@ -55,9 +52,6 @@ public final class SmartJniMemoryManager extends JniMemoryManager {
 	/** The path to the memory info file. */
 	private static final @NotNull String MEMINFO_PATH = separator + String.join(separator, "proc", "meminfo");
 
-	/** The page map file. */
-	private static final @NotNull String PAGEMAP_PATH = separator + String.join(separator, "proc", "self", "pagemap");
-
 	///////////////////////////////////////////////// STATIC VARIABLES /////////////////////////////////////////////////
 
 	/** The factor of 2^10 used for {K,M,G,T}iB units. */
@@ -79,12 +73,16 @@ public final class SmartJniMemoryManager extends JniMemoryManager {
 	/** A cached copy of the output of {@link #getPageSize()}. */
 	private long pageSize;
 
+	/** The translator of virtual addresses to physical addresses. */
+	private final @NotNull Pagemap pagemap;
+
 	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
 
-	/** Private constructor that does nothing. */
+	/** Private constructor that sets the fields {@link #pageSize} and {@link #pagemap}. */
 	private SmartJniMemoryManager() {
 		if (DEBUG >= LOG_TRACE) log.trace("Created a smart JNI-backed memory manager.");
 		pageSize = getPageSize();
+		pagemap = new Pagemap(pageSize);
 	}
 
 	//////////////////////////////////////////////// OVERRIDDEN METHODS ////////////////////////////////////////////////
@@ -104,6 +102,10 @@ public final class SmartJniMemoryManager extends JniMemoryManager {
 		// Trace message
 		if (DEBUG >= LOG_TRACE) log.trace("Checking the huge page size.");
 
+		// Anonymous huge memory pages do not need a mount point
+		val anonymous = getAnonymousHugepageSize();
+		if (anonymous > 0) return anonymous;
+
 		// If no entry exists with the given parameters, then hugepages are definitely not supported
 		if (!existsInMtab(MTAB_PATH, "hugetlbfs", DEFAULT_HUGEPAGE_PATH, "hugetlbfs")) return HUGE_PAGE_NOT_SUPPORTED;
 
@@ -128,8 +130,6 @@ public final class SmartJniMemoryManager extends JniMemoryManager {
 	/** {@inheritDoc} */
 	@Override
 	@Contract(pure = true)
-	@SuppressWarnings("PMD.DataflowAnomalyAnalysis")
-	@SuppressFBWarnings("RCN_REDUNDANT_NULLCHECK_WOULD_HAVE_BEEN_A_NPE")
 	public long virt2phys(final long address) {
 		if (!OPTIMIZED && address == 0) {
 			throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
@@ -141,28 +141,34 @@ public final class SmartJniMemoryManager extends JniMemoryManager {
 			return 0;
 		}
 
-		// Trace message
-		if (DEBUG >= LOG_TRACE) log.trace("Translating virtual address 0x{} to physical address.", leftPad(address));
-		if (DEBUG >= LOG_DEBUG) log.debug("Parsing file '{}'.", PAGEMAP_PATH);
-
-		try (
-				val pagemap = new RandomAccessFile(PAGEMAP_PATH, "r");
-				val channel = pagemap.getChannel().position(Long.divideUnsigned(address, pageSize) * Long.BYTES)
-		) {
-			val buffer = ByteBuffer.allocate(Long.BYTES).order(ByteOrder.nativeOrder());
-			channel.read(buffer);
-			val mask = pageSize - 1;
-			val offset = address & mask;
-			val phys = buffer.flip().getLong();
-			return phys * pageSize + offset;
-		} catch (final FileNotFoundException e) {
-			if (DEBUG >= LOG_ERROR) log.error("The file '{}' cannot be found.", PAGEMAP_PATH, e);
-		} catch (final IOException e) {
-			if (DEBUG >= LOG_ERROR) {
-				log.error("The file '{}' cannot be read, closed or we read past its size.", PAGEMAP_PATH, e);
+		return pagemap.translate(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(mutates = "param5")
+	public void virt2phys(final long address,
+						  final long step,
+						  final int count,
+						  final long hugepageSize,
+						  final @NotNull long[] physical) {
+		if (!OPTIMIZED) {
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+			if (step <= 0) throw new IllegalArgumentException("The parameter 'step' MUST be positive.");
+			if (count < 0) throw new IllegalArgumentException("The parameter 'count' MUST NOT be negative.");
+			if (physical == null) throw new NullPointerException("The parameter 'physical' MUST NOT be null.");
+			if (physical.length < count) {
+				throw new IllegalArgumentException("The parameter 'physical' MUST have at least 'count' elements.");
 			}
 		}
-		return 0;
+
+		// If we are on a non-Linux OS this won't work
+		if (!System.getProperty("os.name").toLowerCase(Locale.getDefault()).contains("lin")) {
+			if (DEBUG >= LOG_WARN) log.warn("Cannot translate virtual addresses in a non-Linux OS.");
+			Arrays.fill(physical, 0, count, 0);
+			return;
+		}
+		pagemap.translate(address, step, count, Math.max(hugepageSize, 0), physical);
 	}
 
 	///////////////////////////////////////////////// INTERNAL METHODS /////////////////////////////////////////////////
@@ -12,9 +12,8 @@ import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.io.InputStreamReader;
 import java.io.RandomAccessFile;
-import java.nio.ByteBuffer;
-import java.nio.ByteOrder;
 import java.nio.charset.StandardCharsets;
+import java.util.Arrays;
 import java.util.Locale;
 import java.util.regex.Pattern;
 
@@ -31,6 +30,7 @@ import org.jetbrains.annotations.Range;
 
 import static de.tum.in.net.ixy.BuildConfig.DEBUG;
 import static de.tum.in.net.ixy.BuildConfig.DEFAULT_HUGEPAGE_PATH;
+import static de.tum.in.net.ixy.BuildConfig.DEFAULT_HUGEPAGE_SIZE;
 import static de.tum.in.net.ixy.BuildConfig.LOG_DEBUG;
 import static de.tum.in.net.ixy.BuildConfig.LOG_ERROR;
 import static de.tum.in.net.ixy.BuildConfig.LOG_TRACE;
@@ -69,14 +69,14 @@ public final class SmartUnsafeMemoryManager extends UnsafeMemoryManager {
 	/** The path to the memory info file. */
 	private static final @NotNull String MEMINFO_PATH = separator + String.join(separator, "proc", "meminfo");
 
-	/** The page map file. */
-	private static final @NotNull String PAGEMAP_PATH = separator + String.join(separator, "proc", "self", "pagemap");
-
 	///////////////////////////////////////////////// STATIC VARIABLES /////////////////////////////////////////////////
 
 	/** The factor of 2^10 used for {K,M,G,T}iB units. */
 	private static final int K_FACTOR = 1024;
 
+	/** The size of the huge memory pages tried when the preferred size cannot be reserved. */
+	private static final long FALLBACK_HUGEPAGE_SIZE = 2 * 1024 * 1024;
+
 	/**
 	 * A cached instance of this class.
 	 * -- GETTER --
@@ -96,6 +96,12 @@ public final class SmartUnsafeMemoryManager extends UnsafeMemoryManager {
 	/** A cached copy of the output of {@link #getHugepageSize()}. */
 	private long hugepageSize;
 
+	/** The size of the anonymous huge memory pages, or {@code 0} if the {@code hugetlbfs} mount point is used. */
+	private long anonymousHugepageSize;
+
+	/** The translator of virtual addresses to physical addresses. */
+	private final @NotNull Pagemap pagemap;
+
 	////////////////////////////////////////////////// NATIVE METHODS //////////////////////////////////////////////////
 
 	/**
@@ -113,15 +119,42 @@ public final class SmartUnsafeMemoryManager extends UnsafeMemoryManager {
 	 * When the parameter {@code huge} is set to {@code true}, normal memory allocation will take place, usually
 	 * implemented with the C library function {@code malloc(size_t)}, and the parameter {@code mnt} will be ignored.
 	 *
-	 * @param bytes The number of bytes.
-	 * @param huge  Whether to enable huge memory pages.
-	 * @param lock  Whether to enable memory locking.
-	 * @param mnt   The {@code hugetlbfs} mount point.
+	 * <p>
+	 * When the parameter {@code pagesize} is positive, anonymous huge memory pages of that size are used instead of a
+	 * file of the {@code hugetlbfs} mount point.
+	 *
+	 * @param bytes    The number of bytes.
+	 * @param huge     Whether to enable huge memory pages.
+	 * @param lock     Whether to enable memory locking.
+	 * @param mnt      The {@code hugetlbfs} mount point.
+	 * @param pagesize The size of the anonymous huge memory pages, or {@code 0} to use the mount point.
+	 * @param node     The NUMA node the huge memory pages are bound to, or {@code -1} to use the default memory policy.
 	 * @return The memory region's base address.
 	 */
 	@Contract(pure = true)
 	@SuppressWarnings("checkstyle:MethodName")
-	private static native long c_allocate(long bytes, boolean huge, boolean lock, @Nullable String mnt);
+	private static native long c_allocate(long bytes, boolean huge, boolean lock, @Nullable String mnt, long pagesize,
+										  int node);
+
+	/**
+	 * Returns the NUMA node a memory region is bound to by its memory policy.
+	 *
+	 * @param address The memory region's base address.
+	 * @return The NUMA node or {@code -1} if the memory region is not bound to any.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native int c_numa_node(long address);
+
+	/**
+	 * Returns whether an anonymous huge memory page of the given size can be reserved.
+	 *
+	 * @param size The size of the huge memory page.
+	 * @return Whether the huge memory page can be reserved.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native boolean c_hugepage_probe(long size);
 
 	/**
 	 * Frees a previously allocated memory region.
@@ -168,7 +201,7 @@ public final class SmartUnsafeMemoryManager extends UnsafeMemoryManager {
 	private SmartUnsafeMemoryManager() {
 		log.trace("Created a smart Unsafe-based memory manager.");
 		pageSize = super.getPageSize();
-		hugepageSize = getHugepageSize();
+		pagemap = new Pagemap(pageSize);
 		Native.loadLibrary("ixy", "resources");
 		if (!isValid()) {
 			try {
@@ -177,6 +210,8 @@ public final class SmartUnsafeMemoryManager extends UnsafeMemoryManager {
 //				e.printStackTrace();
 			}
 		}
+		anonymousHugepageSize = probeAnonymousHugepages();
+		hugepageSize = getHugepageSize();
 	}
 
 	//////////////////////////////////////////////// OVERRIDDEN METHODS ////////////////////////////////////////////////
@@ -210,6 +245,9 @@ public final class SmartUnsafeMemoryManager extends UnsafeMemoryManager {
 		// Trace message
 		if (DEBUG >= LOG_TRACE) log.trace("Checking the huge page size.");
 
+		// Anonymous huge memory pages do not need a mount point
+		if (anonymousHugepageSize > 0) return hugepageSize = anonymousHugepageSize;
+
 		// If no entry exists with the given parameters, then hugepages are definitely not supported
 		if (!existsInMtab(MTAB_PATH, "hugetlbfs", DEFAULT_HUGEPAGE_PATH, "hugetlbfs")) {
 			return hugepageSize = HUGE_PAGE_NOT_SUPPORTED;
@@ -270,7 +308,7 @@ public final class SmartUnsafeMemoryManager extends UnsafeMemoryManager {
 
 		// Call the C implementation
 		try {
-			return c_allocate(bytes, huge, lock, DEFAULT_HUGEPAGE_PATH);
+			return c_allocate(bytes, huge, lock, DEFAULT_HUGEPAGE_PATH, anonymousHugepageSize, -1);
 		} catch (final UnsatisfiedLinkError e) {
 			return 0;
 		}
@@ -317,6 +355,71 @@ public final class SmartUnsafeMemoryManager extends UnsafeMemoryManager {
 		c_free(address, bytes, huge, lock);
 	}
 
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	@SuppressWarnings("BooleanParameter")
+	public long allocate(final long bytes, final long pagesize, final boolean lock) {
+		return allocate(bytes, pagesize, lock, -1);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	@SuppressWarnings("BooleanParameter")
+	public long allocate(long bytes, final long pagesize, final boolean lock, final int node) {
+		if (!OPTIMIZED) {
+			if (bytes <= 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (pagesize <= 0 || Long.bitCount(pagesize) != 1) {
+				throw new IllegalArgumentException("The parameter 'pagesize' MUST be a power of two.");
+			}
+			if (node < -1) throw new IllegalArgumentException("The parameter 'node' MUST NOT be less than -1.");
+		}
+
+		// Round the size to a multiple of the page size
+		val mask = pagesize - 1;
+		bytes = (bytes + mask) & ~mask;
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Allocating {} bytes in huge memory pages of {} bytes on NUMA node {}.", bytes, pagesize, node);
+		}
+
+		// Call the C implementation
+		return c_allocate(bytes, true, lock, DEFAULT_HUGEPAGE_PATH, pagesize, node);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public int getNumaNode(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Checking the NUMA node of 0x{}.", leftPad(address));
+		return c_numa_node(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@SuppressWarnings("BooleanParameter")
+	public void free(long address, long bytes, final long pagesize, final boolean lock) {
+		if (!OPTIMIZED) {
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+			if (bytes <= 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (pagesize <= 0 || Long.bitCount(pagesize) != 1) {
+				throw new IllegalArgumentException("The parameter 'pagesize' MUST be a power of two.");
+			}
+		}
+
+		// Round the size and address to a multiple of the page size
+		val mask = pagesize - 1;
+		address &= ~mask;
+		bytes = (bytes + mask) & ~mask;
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Freeing {} bytes in huge memory pages of {} bytes @ 0x{}.", bytes, pagesize, leftPad(address));
+		}
+
+		// Call the C implementation
+		c_free(address, bytes, true, lock);
+	}
+
 	/** {@inheritDoc} */
 	@Override
 	@Contract(pure = true)
@@ -377,28 +480,34 @@ public final class SmartUnsafeMemoryManager extends UnsafeMemoryManager {
 			return 0;
 		}
 
-		// Trace message
-		if (DEBUG >= LOG_TRACE) log.trace("Translating virtual address 0x{} to physical address.", leftPad(address));
-		if (DEBUG >= LOG_DEBUG) log.debug("Parsing file '{}'.", PAGEMAP_PATH);
-
-		try (
-				val pagemap = new RandomAccessFile(PAGEMAP_PATH, "r");
-				val channel = pagemap.getChannel().position(Long.divideUnsigned(address, pageSize) * Long.BYTES)
-		) {
-			val buffer = ByteBuffer.allocate(Long.BYTES).order(ByteOrder.nativeOrder());
-			channel.read(buffer);
-			val mask = pageSize - 1;
-			val offset = address & mask;
-			val phys = buffer.flip().getLong();
-			return phys * pageSize + offset;
-		} catch (final FileNotFoundException e) {
-			if (DEBUG >= LOG_ERROR) log.error("The file '{}' cannot be found.", PAGEMAP_PATH, e);
-		} catch (final IOException e) {
-			if (DEBUG >= LOG_ERROR) {
-				log.error("The file '{}' cannot be read, closed or we read past its size.", PAGEMAP_PATH, e);
+		return pagemap.translate(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(mutates = "param5")
+	public void virt2phys(final long address,
+						  final long step,
+						  final int count,
+						  final long hugepageSize,
+						  final @NotNull long[] physical) {
+		if (!OPTIMIZED) {
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+			if (step <= 0) throw new IllegalArgumentException("The parameter 'step' MUST be positive.");
+			if (count < 0) throw new IllegalArgumentException("The parameter 'count' MUST NOT be negative.");
+			if (physical == null) throw new NullPointerException("The parameter 'physical' MUST NOT be null.");
+			if (physical.length < count) {
+				throw new IllegalArgumentException("The parameter 'physical' MUST have at least 'count' elements.");
 			}
 		}
-		return 0;
+
+		// If we are on a non-Linux OS this won't work
+		if (!System.getProperty("os.name").toLowerCase(Locale.getDefault()).contains("lin")) {
+			if (DEBUG >= LOG_WARN) log.warn("Cannot translate virtual addresses in a non-Linux OS.");
+			Arrays.fill(physical, 0, count, 0);
+			return;
+		}
+		pagemap.translate(address, step, count, Math.max(hugepageSize, 0), physical);
 	}
 
 	/** {@inheritDoc} */
@@ -418,6 +527,30 @@ public final class SmartUnsafeMemoryManager extends UnsafeMemoryManager {
 
 	///////////////////////////////////////////////// INTERNAL METHODS /////////////////////////////////////////////////
 
+	/**
+	 * Finds the size of the anonymous huge memory pages, which do not need a {@code hugetlbfs} mount point.
+	 * <p>
+	 * The preferred size is the build constant {@code DEFAULT_HUGEPAGE_SIZE}, and if those huge memory pages cannot be
+	 * reserved, {@link #FALLBACK_HUGEPAGE_SIZE 2 MiB} huge memory pages are tried.
+	 *
+	 * @return The size of the anonymous huge memory pages or {@code 0} if they are disabled or not available.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("PMD.AvoidLiteralsInIfCondition")
+	private static long probeAnonymousHugepages() {
+		if (DEFAULT_HUGEPAGE_SIZE <= 0) return 0;
+		try {
+			if (c_hugepage_probe(DEFAULT_HUGEPAGE_SIZE)) return DEFAULT_HUGEPAGE_SIZE;
+			if (DEBUG >= LOG_WARN) log.warn("Cannot reserve huge memory pages of {} bytes.", DEFAULT_HUGEPAGE_SIZE);
+			if (DEFAULT_HUGEPAGE_SIZE > FALLBACK_HUGEPAGE_SIZE && c_hugepage_probe(FALLBACK_HUGEPAGE_SIZE)) {
+				return FALLBACK_HUGEPAGE_SIZE;
+			}
+		} catch (final UnsatisfiedLinkError e) {
+			if (DEBUG >= LOG_WARN) log.warn("Cannot probe huge memory pages without the native library.");
+		}
+		return 0;
+	}
+
 	/**
 	 * Checks an entry exists in a mount table file using the the given column values.
 	 * <p>
@@ -0,0 +1,77 @@
+package de.tum.in.net.ixy.memory;
+
+import de.tum.in.net.ixy.utils.Native;
+
+import lombok.AccessLevel;
+import lombok.NoArgsConstructor;
+import lombok.extern.slf4j.Slf4j;
+
+import org.jetbrains.annotations.Contract;
+
+import static de.tum.in.net.ixy.BuildConfig.DEBUG;
+import static de.tum.in.net.ixy.BuildConfig.LOG_TRACE;
+import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+import static de.tum.in.net.ixy.utils.Strings.leftPad;
+
+/**
+ * Measures the data TLB misses caused by walking a memory region, using Linux' {@code perf_event_open} counters.
+ * <p>
+ * This class is meant to compare how many TLB misses the different huge memory page sizes save, so the counter only
+ * covers the walk of the memory region done by the native library and not the overhead of the JVM.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@Slf4j
+@NoArgsConstructor(access = AccessLevel.PRIVATE)
+public final class TlbCounter {
+
+	static {
+		Native.loadLibrary("ixy", "resources");
+	}
+
+	////////////////////////////////////////////////// NATIVE METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Reads a byte every {@code stride} bytes of a memory region {@code rounds} times and counts the data TLB read
+	 * misses.
+	 *
+	 * @param address The base address of the memory region.
+	 * @param bytes   The size of the memory region.
+	 * @param stride  The distance between two reads.
+	 * @param rounds  The number of times the memory region is walked.
+	 * @return The number of data TLB read misses or {@code -1} if they cannot be counted.
+	 */
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native long c_dtlb_misses(long address, long bytes, long stride, int rounds);
+
+	////////////////////////////////////////////////// STATIC METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Counts the data TLB read misses of walking a memory region.
+	 * <p>
+	 * When the counter is not available, for example because {@code /proc/sys/kernel/perf_event_paranoid} forbids it,
+	 * {@code -1} is returned.
+	 *
+	 * @param address The base address of the memory region.
+	 * @param bytes   The size of the memory region.
+	 * @param stride  The distance between two reads.
+	 * @param rounds  The number of times the memory region is walked.
+	 * @return The number of data TLB read misses or {@code -1} if they cannot be counted.
+	 */
+	@Contract(pure = true)
+	public static long dtlbMisses(final long address, final long bytes, final long stride, final int rounds) {
+		if (!OPTIMIZED) {
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+			if (bytes <= 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (stride <= 0) throw new IllegalArgumentException("The parameter 'stride' MUST be positive.");
+			if (rounds <= 0) throw new IllegalArgumentException("The parameter 'rounds' MUST be positive.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Counting the data TLB misses of {} bytes @ 0x{}.", bytes, leftPad(address));
+		try {
+			return c_dtlb_misses(address, bytes, stride, rounds);
+		} catch (final UnsatisfiedLinkError e) {
+			return -1;
+		}
+	}
+
+}
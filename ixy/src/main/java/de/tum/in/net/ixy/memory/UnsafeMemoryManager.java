@@ -4,6 +4,9 @@ import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
 
 import java.io.File;
 import java.io.IOException;
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.ReadOnlyBufferException;
 
 import lombok.EqualsAndHashCode;
 import lombok.Getter;
@@ -38,6 +41,11 @@ import static de.tum.in.net.ixy.utils.Strings.leftPad;
  *     <li>Memory mapping.</li>
  *     <li>Memory unmapping.</li>
  * </ul>
+ * <p>
+ * The unsafe object does not have opaque nor acquire/release accessors for arbitrary addresses, so opaque and acquire
+ * reads are plain reads followed by a {@link Unsafe#loadFence() load fence}, and opaque and release writes are ordered
+ * writes or plain writes preceded by a {@link Unsafe#storeFence() store fence}. On x86 those fences only restrict the
+ * reordering done by the JIT compiler.
  *
  * @author Esaú García Sánchez-Torija
  */
@@ -72,6 +80,9 @@ class UnsafeMemoryManager implements MemoryManager {
 	@SuppressWarnings({"UseOfSunClasses", "PackageVisibleField"})
 	final @Nullable Unsafe unsafe;
 
+	/** The offset of the field {@code address} of {@link Buffer}, or {@code -1} if it is not available. */
+	private final long addressOffset;
+
 	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
 
 	/** Package-private constructor that sets the {@link #unsafe} field. */
@@ -97,6 +108,27 @@ class UnsafeMemoryManager implements MemoryManager {
 		} finally {
 			unsafe = tmp;
 		}
+		addressOffset = addressOffset(unsafe);
+	}
+
+	/**
+	 * Computes the offset of the field {@code address} of {@link Buffer}, which holds the base virtual address of the
+	 * direct buffers.
+	 *
+	 * @param unsafe The unsafe object.
+	 * @return The offset of the field or {@code -1} if it is not available.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("UseOfSunClasses")
+	private static long addressOffset(final @Nullable Unsafe unsafe) {
+		if (unsafe == null) return -1;
+		try {
+			if (DEBUG >= LOG_TRACE) log.trace("Getting declared field 'address' from 'java.nio.Buffer'.");
+			return unsafe.objectFieldOffset(Buffer.class.getDeclaredField("address"));
+		} catch (final NoSuchFieldException | SecurityException e) {
+			if (DEBUG >= LOG_ERROR) log.error("Error getting declared field.", e);
+		}
+		return -1;
 	}
 
 	/////////////////////////////////////////////// UNSUPPORTED METHODS ////////////////////////////////////////////////
@@ -339,6 +371,118 @@ class UnsafeMemoryManager implements MemoryManager {
 		return unsafe.getLongVolatile(null, address);
 	}
 
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public byte getByteOpaque(final long address) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Reading opaque byte @ 0x{}.", leftPad(address));
+		val value = unsafe.getByte(null, address);
+		unsafe.loadFence();
+		return value;
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public short getShortOpaque(final long address) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Reading opaque short @ 0x{}.", leftPad(address));
+		val value = unsafe.getShort(null, address);
+		unsafe.loadFence();
+		return value;
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public int getIntOpaque(final long address) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Reading opaque int @ 0x{}.", leftPad(address));
+		val value = unsafe.getInt(null, address);
+		unsafe.loadFence();
+		return value;
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public long getLongOpaque(final long address) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Reading opaque long @ 0x{}.", leftPad(address));
+		val value = unsafe.getLong(null, address);
+		unsafe.loadFence();
+		return value;
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public byte getByteAcquire(final long address) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Reading acquire byte @ 0x{}.", leftPad(address));
+		val value = unsafe.getByte(null, address);
+		unsafe.loadFence();
+		return value;
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public short getShortAcquire(final long address) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Reading acquire short @ 0x{}.", leftPad(address));
+		val value = unsafe.getShort(null, address);
+		unsafe.loadFence();
+		return value;
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public int getIntAcquire(final long address) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Reading acquire int @ 0x{}.", leftPad(address));
+		val value = unsafe.getInt(null, address);
+		unsafe.loadFence();
+		return value;
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public long getLongAcquire(final long address) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Reading acquire long @ 0x{}.", leftPad(address));
+		val value = unsafe.getLong(null, address);
+		unsafe.loadFence();
+		return value;
+	}
+
 	/** {@inheritDoc} */
 	@Override
 	public void putByte(final long address, final byte value) {
@@ -427,6 +571,98 @@ class UnsafeMemoryManager implements MemoryManager {
 		unsafe.putLongVolatile(null, address, value);
 	}
 
+	/** {@inheritDoc} */
+	@Override
+	public void putByteOpaque(final long address, final byte value) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Writing opaque byte 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		unsafe.storeFence();
+		unsafe.putByte(null, address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putShortOpaque(final long address, final short value) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Writing opaque short 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		unsafe.storeFence();
+		unsafe.putShort(null, address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putIntOpaque(final long address, final int value) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Writing opaque int 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		unsafe.putOrderedInt(null, address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putLongOpaque(final long address, final long value) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Writing opaque long 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		unsafe.putOrderedLong(null, address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putByteRelease(final long address, final byte value) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Writing release byte 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		unsafe.storeFence();
+		unsafe.putByte(null, address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putShortRelease(final long address, final short value) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Writing release short 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		unsafe.storeFence();
+		unsafe.putShort(null, address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putIntRelease(final long address, final int value) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Writing release int 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		unsafe.putOrderedInt(null, address, value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putLongRelease(final long address, final long value) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Writing release long 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		unsafe.putOrderedLong(null, address, value);
+	}
+
 	/** {@inheritDoc} */
 	@Override
 	public void get(final long src, int bytes, final @NotNull byte[] dest, final int offset) {
@@ -479,4 +715,69 @@ class UnsafeMemoryManager implements MemoryManager {
 		unsafe.copyMemory(src, Unsafe.ARRAY_BYTE_BASE_OFFSET + offset, null, dest, bytes);
 	}
 
+	/** {@inheritDoc} */
+	@Override
+	public void get(final long src, int bytes, final @NotNull ByteBuffer dest) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (src == 0) throw new IllegalArgumentException("The parameter 'src' MUST NOT be 0.");
+			if (bytes < 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (dest == null) throw new NullPointerException("The parameter 'dest' MUST NOT be null.");
+			if (dest.isReadOnly()) throw new ReadOnlyBufferException();
+			if (dest.remaining() < bytes) {
+				if (DEBUG >= LOG_WARN) {
+					log.warn("You are trying to write more bytes than the buffer can hold. Adapting bytes.");
+				}
+				bytes = dest.remaining();
+			}
+			if (bytes == 0) return;
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Copying memory region @ 0x{} ({} bytes).", leftPad(src), bytes);
+		val position = dest.position();
+		if (dest.isDirect() && addressOffset >= 0) {
+			unsafe.copyMemory(null, src, null, unsafe.getLong(dest, addressOffset) + position, bytes);
+		} else if (dest.hasArray()) {
+			val base = Unsafe.ARRAY_BYTE_BASE_OFFSET + dest.arrayOffset() + position;
+			unsafe.copyMemory(null, src, dest.array(), base, bytes);
+		} else {
+			val copy = new byte[bytes];
+			unsafe.copyMemory(null, src, copy, Unsafe.ARRAY_BYTE_BASE_OFFSET, bytes);
+			dest.put(copy);
+			return;
+		}
+		dest.position(position + bytes);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void put(final long dest, int bytes, final @NotNull ByteBuffer src) {
+		if (!OPTIMIZED) {
+			if (unsafe == null) throw new NullPointerException("The Unsafe object is not available.");
+			if (dest == 0) throw new IllegalArgumentException("The parameter 'dest' MUST NOT be 0.");
+			if (bytes < 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (src == null) throw new NullPointerException("The parameter 'src' MUST NOT be null.");
+			if (src.remaining() < bytes) {
+				if (DEBUG >= LOG_WARN) {
+					log.warn("You are trying to read more bytes than the buffer holds. Adapting bytes.");
+				}
+				bytes = src.remaining();
+			}
+			if (bytes == 0) return;
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Copying memory region @ 0x{} ({} bytes).", leftPad(dest), bytes);
+		val position = src.position();
+		if (src.isDirect() && addressOffset >= 0) {
+			unsafe.copyMemory(null, unsafe.getLong(src, addressOffset) + position, null, dest, bytes);
+		} else if (src.hasArray()) {
+			val base = Unsafe.ARRAY_BYTE_BASE_OFFSET + src.arrayOffset() + position;
+			unsafe.copyMemory(src.array(), base, null, dest, bytes);
+		} else {
+			val copy = new byte[bytes];
+			src.get(copy);
+			unsafe.copyMemory(copy, Unsafe.ARRAY_BYTE_BASE_OFFSET, null, dest, bytes);
+			return;
+		}
+		src.position(position + bytes);
+	}
+
 }
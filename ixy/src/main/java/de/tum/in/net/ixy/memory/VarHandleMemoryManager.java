@@ -0,0 +1,1009 @@
+package de.tum.in.net.ixy.memory;
+
+import de.tum.in.net.ixy.utils.Native;
+
+import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
+
+import java.io.BufferedReader;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.FileNotFoundException;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.io.RandomAccessFile;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.VarHandle;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.channels.FileChannel;
+import java.nio.charset.StandardCharsets;
+import java.util.Arrays;
+import java.util.Locale;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.regex.Pattern;
+
+import lombok.EqualsAndHashCode;
+import lombok.Getter;
+import lombok.RequiredArgsConstructor;
+import lombok.ToString;
+import lombok.extern.slf4j.Slf4j;
+import lombok.val;
+
+import org.jetbrains.annotations.Contract;
+import org.jetbrains.annotations.NotNull;
+import org.jetbrains.annotations.Nullable;
+import org.jetbrains.annotations.Range;
+
+import static de.tum.in.net.ixy.BuildConfig.DEBUG;
+import static de.tum.in.net.ixy.BuildConfig.DEFAULT_HUGEPAGE_PATH;
+import static de.tum.in.net.ixy.BuildConfig.LOG_DEBUG;
+import static de.tum.in.net.ixy.BuildConfig.LOG_ERROR;
+import static de.tum.in.net.ixy.BuildConfig.LOG_TRACE;
+import static de.tum.in.net.ixy.BuildConfig.LOG_WARN;
+import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+import static de.tum.in.net.ixy.utils.Strings.leftPad;
+
+import static java.io.File.separator;
+
+/**
+ * Implementation of a memory manager backed up by {@link VarHandle variable handles} over direct {@link ByteBuffer
+ * byte buffers}.
+ * <p>
+ * Every allocated or mapped memory region is a direct byte buffer, either created with {@link
+ * ByteBuffer#allocateDirect(int)} or mapped from a {@code hugetlbfs} file or a device resource with {@link
+ * FileChannel#map(FileChannel.MapMode, long, long)}. The memory manager keeps track of the virtual address of every
+ * region, so any virtual address inside a region can be read or written with a byte buffer view variable handle, which
+ * supports all the memory orderings of the {@link MemoryManager} interface without {@link sun.misc.Unsafe the unsafe
+ * object} nor a {@code native} call per access. The {@code native} library is only used to query some system
+ * properties and the base address of the byte buffers.
+ * <p>
+ * The following limitations apply:
+ * <ul>
+ *     <li>Memory regions cannot be bigger than {@link Integer#MAX_VALUE} bytes.</li>
+ *     <li>Memory locking is only supported with huge memory pages, which are never swapped.</li>
+ *     <li>Freed and unmapped regions are forgotten right away, but they are released by the garbage collector.</li>
+ *     <li>Virtual addresses that do not belong to a region of this memory manager cannot be accessed.</li>
+ * </ul>
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@Slf4j
+@ToString(onlyExplicitlyIncluded = true, doNotUseGetters = true)
+@EqualsAndHashCode(onlyExplicitlyIncluded = true, doNotUseGetters = true)
+@SuppressWarnings({"ConstantConditions", "Duplicates", "PMD.AvoidDuplicateLiterals", "PMD.BeanMembersShouldSerialize"})
+public final class VarHandleMemoryManager implements MemoryManager {
+
+	//////////////////////////////////////////////////// FILE PATHS ////////////////////////////////////////////////////
+
+	/** The path to the mounted (filesystem) table. */
+	private static final @NotNull String MTAB_PATH = separator + String.join(separator, "etc", "mtab");
+
+	/** The path to the memory info file. */
+	private static final @NotNull String MEMINFO_PATH = separator + String.join(separator, "proc", "meminfo");
+
+	///////////////////////////////////////////////// STATIC VARIABLES /////////////////////////////////////////////////
+
+	/** The factor of 2^10 used for {K,M,G,T}iB units. */
+	private static final int K_FACTOR = 1024;
+
+	/** The variable handle used to access {@code short}s. */
+	private static final @NotNull VarHandle SHORT =
+			MethodHandles.byteBufferViewVarHandle(short[].class, ByteOrder.nativeOrder());
+
+	/** The variable handle used to access {@code int}s. */
+	private static final @NotNull VarHandle INT =
+			MethodHandles.byteBufferViewVarHandle(int[].class, ByteOrder.nativeOrder());
+
+	/** The variable handle used to access {@code long}s. */
+	private static final @NotNull VarHandle LONG =
+			MethodHandles.byteBufferViewVarHandle(long[].class, ByteOrder.nativeOrder());
+
+	/** The identifier of the next hugepage file. */
+	private static final @NotNull AtomicInteger hugepageId = new AtomicInteger();
+
+	/**
+	 * A cached instance of this class.
+	 * -- GETTER --
+	 * Returns a singleton instance.
+	 *
+	 * @return The singleton instance.
+	 */
+	@Getter
+	@SuppressWarnings("JavaDoc")
+	private static final MemoryManager singleton = new VarHandleMemoryManager();
+
+	////////////////////////////////////////////////// NATIVE METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Returns whether the library is loaded and supported by the operative system.
+	 *
+	 * @return The support status.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native boolean c_is_valid();
+
+	/**
+	 * Returns the size of a memory address.
+	 *
+	 * @return The size of a memory address.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native int c_address_size();
+
+	/**
+	 * Returns the size of a memory page.
+	 *
+	 * @return The size of a memory page.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native int c_page_size();
+
+	/**
+	 * Returns the base virtual address of a direct byte buffer.
+	 *
+	 * @param buffer The direct byte buffer.
+	 * @return The base virtual address.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings("checkstyle:MethodName")
+	private static native long c_address(@NotNull ByteBuffer buffer);
+
+	///////////////////////////////////////////////// MEMBER VARIABLES /////////////////////////////////////////////////
+
+	/** A cached copy of the output of {@link #getPageSize()}. */
+	private long pageSize;
+
+	/** A cached copy of the output of {@link #getHugepageSize()}. */
+	private long hugepageSize;
+
+	/** The translator of virtual addresses to physical addresses. */
+	private final @NotNull Pagemap pagemap;
+
+	/**
+	 * The registered memory regions sorted by their base virtual address, which are replaced as a whole when a region
+	 * is added or removed.
+	 */
+	private volatile @NotNull Region[] regions = new Region[0];
+
+	/** The last region that was accessed, which is checked before any other region. */
+	private @Nullable Region last;
+
+	////////////////////////////////////////////////// MEMBER METHODS //////////////////////////////////////////////////
+
+	/** Private constructor that sets the fields {@link #pageSize} and {@link #hugepageSize}. */
+	private VarHandleMemoryManager() {
+		if (DEBUG >= LOG_TRACE) log.trace("Creating a VarHandle-based memory manager.");
+		Native.loadLibrary("ixy", "resources");
+		if (!isValid()) {
+			try {
+				System.loadLibrary("ixy");
+			} catch (final UnsatisfiedLinkError e) {
+//				e.printStackTrace();
+			}
+		}
+		pageSize = isValid() ? getPageSize() : 0;
+		pagemap = new Pagemap(pageSize);
+		hugepageSize = getHugepageSize();
+	}
+
+	//////////////////////////////////////////////// OVERRIDDEN METHODS ////////////////////////////////////////////////
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public boolean isValid() {
+		if (DEBUG >= LOG_TRACE) log.trace("Checking if the native library is loaded.");
+		try {
+			return c_is_valid();
+		} catch (final UnsatisfiedLinkError e) {
+			return false;
+		}
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public int getAddressSize() {
+		if (DEBUG >= LOG_TRACE) log.trace("Computing address size.");
+		return c_address_size();
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public long getPageSize() {
+		if (DEBUG >= LOG_TRACE) log.trace("Computing page size.");
+		return pageSize = c_page_size();
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	@SuppressWarnings("PMD.DataflowAnomalyAnalysis")
+	public long getHugepageSize() {
+		// Trace message
+		if (DEBUG >= LOG_TRACE) log.trace("Checking the huge page size.");
+
+		// If no entry exists with the given parameters, then hugepages are definitely not supported
+		if (!existsInMtab(MTAB_PATH, "hugetlbfs", DEFAULT_HUGEPAGE_PATH, "hugetlbfs")) {
+			return hugepageSize = HUGE_PAGE_NOT_SUPPORTED;
+		}
+
+		// Read the /proc/meminfo file to get the size of a hugepage
+		if (DEBUG >= LOG_DEBUG) log.debug("Parsing file '{}'.", MEMINFO_PATH);
+		try (val meminfo = bufferedReader(new File(MEMINFO_PATH))) {
+			val pattern = Pattern.compile("Hugepagesize:[\\t\\s ]+(\\d+)[\\t\\s ]+([kMG]?B)");
+			for (var line = meminfo.readLine(); line != null; line = meminfo.readLine()) {
+				val matcher = pattern.matcher(line);
+				if (matcher.find()) {
+					return hugepageSize = applyFactor(Long.parseLong(matcher.group(1)), matcher.group(2));
+				}
+			}
+		} catch (final FileNotFoundException e) {
+			if (DEBUG >= LOG_ERROR) log.error("The file '{}' cannot be found.", MEMINFO_PATH, e);
+		} catch (final IOException e) {
+			if (DEBUG >= LOG_ERROR) log.error("The file '{}' cannot be read or closed.", MEMINFO_PATH, e);
+		}
+		return hugepageSize = 0;
+	}
+
+	/**
+	 * {@inheritDoc}
+	 * <p>
+	 * The regions of this memory manager are files of the {@code hugetlbfs} mount point, so only the huge memory page
+	 * size of the mount point is returned.
+	 */
+	@Override
+	@Contract(value = " -> new", pure = true)
+	public @NotNull long[] getHugepageSizes() {
+		val size = getHugepageSize();
+		return size > 0 ? new long[] {size} : new long[0];
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	@SuppressWarnings("BooleanParameter")
+	public long allocate(long bytes, final boolean huge, final boolean lock) {
+		if (!OPTIMIZED && bytes <= 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+
+		// Non-hugepage memory is allocated by the JVM, which cannot lock it
+		if (!huge) {
+			if (lock) throw new UnsupportedOperationException("Memory locking requires huge memory pages.");
+			if (DEBUG >= LOG_TRACE) log.trace("Allocating {} bytes.", bytes);
+			if (bytes > Integer.MAX_VALUE - pageSize) return 0;
+			val buffer = ByteBuffer.allocateDirect((int) (bytes + pageSize)).alignedSlice((int) pageSize);
+			return register(buffer);
+		}
+
+		// If no huge memory page file support has been detected, exit right away
+		if (hugepageSize <= 0) {
+			if (DEBUG >= LOG_TRACE) log.trace("Allocating {} hugepage-based bytes.", bytes);
+			return 0;
+		}
+
+		// Round the size to a multiple of the page size
+		val mask = hugepageSize - 1;
+		bytes = (bytes & mask) == 0 ? bytes : (bytes + hugepageSize) & ~mask;
+		if (DEBUG >= LOG_TRACE) log.trace("Allocating {} hugepage-based bytes.", bytes);
+		if (bytes > Integer.MAX_VALUE) return 0;
+
+		// Map a new hugepage file and remove it to avoid any other process from mapping it
+		val pid = ProcessHandle.current().pid();
+		val file = new File(DEFAULT_HUGEPAGE_PATH, String.format("ixy-%d-%d", pid, hugepageId.getAndIncrement()));
+		try (
+				val randomAccessFile = new RandomAccessFile(file, "rw");
+				val channel = randomAccessFile.getChannel()
+		) {
+			val buffer = channel.map(FileChannel.MapMode.READ_WRITE, 0, bytes);
+			if (lock) buffer.load();
+			return register(buffer);
+		} catch (final IOException e) {
+			if (DEBUG >= LOG_ERROR) log.error("The hugepage file '{}' cannot be mapped.", file.getAbsolutePath(), e);
+			return 0;
+		} finally {
+			if (file.exists() && !file.delete() && DEBUG >= LOG_WARN) {
+				log.warn("The hugepage file '{}' cannot be removed.", file.getAbsolutePath());
+			}
+		}
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@SuppressWarnings("BooleanParameter")
+	public void free(final long address, final long bytes, final boolean huge, final boolean lock) {
+		if (!OPTIMIZED) {
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+			if (bytes <= 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Freeing {} bytes @ 0x{}.", bytes, leftPad(address));
+		unregister(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	@SuppressWarnings("BooleanParameter")
+	public long mmap(final @NotNull File file, final boolean huge, final boolean lock)
+			throws FileNotFoundException, IOException {
+		if (!OPTIMIZED) {
+			if (file == null) throw new NullPointerException("The parameter 'file' MUST NOT be null.");
+			if (!file.exists()) throw new FileNotFoundException("The parameter 'file' MUST exist.");
+			if (!file.canRead()) throw new IllegalArgumentException("The parameter 'file' MUST be readable.");
+			if (!file.canWrite()) throw new IllegalArgumentException("The parameter 'file' MUST be writable.");
+		}
+
+		// Trace message
+		if (DEBUG >= LOG_TRACE) log.trace("Mapping file: {}", file.getAbsolutePath());
+
+		// Map the whole file, the mapping outlives the channel
+		try (
+				val randomAccessFile = new RandomAccessFile(file, "rw");
+				val channel = randomAccessFile.getChannel()
+		) {
+			val size = channel.size();
+			if (size > Integer.MAX_VALUE) throw new IOException("The file is too big to be mapped.");
+			val buffer = channel.map(FileChannel.MapMode.READ_WRITE, 0, size);
+			if (lock) buffer.load();
+			return register(buffer);
+		}
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@SuppressWarnings("BooleanParameter")
+	public void munmap(final long address, final @NotNull File file, final boolean huge, final boolean lock)
+			throws FileNotFoundException, IOException {
+		if (!OPTIMIZED) {
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+			if (file == null) throw new NullPointerException("The parameter 'file' MUST NOT be null.");
+			if (!file.exists()) throw new FileNotFoundException("The parameter 'file' MUST exist.");
+			if (!file.canRead()) throw new IllegalArgumentException("The parameter 'file' MUST be readable.");
+			if (!file.canWrite()) throw new IllegalArgumentException("The parameter 'file' MUST be writable.");
+		}
+
+		// Trace message
+		if (DEBUG >= LOG_TRACE) log.trace("Destroying file mapping: {}", file.getAbsolutePath());
+		unregister(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public byte getByte(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading byte @ 0x{}.", leftPad(address));
+		val region = region(address);
+		return region.buffer.get((int) (address - region.base));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public short getShort(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading short @ 0x{}.", leftPad(address));
+		val region = region(address);
+		return (short) SHORT.get(region.buffer, (int) (address - region.base));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public int getInt(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading int @ 0x{}.", leftPad(address));
+		val region = region(address);
+		return (int) INT.get(region.buffer, (int) (address - region.base));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public long getLong(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading long @ 0x{}.", leftPad(address));
+		val region = region(address);
+		return (long) LONG.get(region.buffer, (int) (address - region.base));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public byte getByteVolatile(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading volatile byte @ 0x{}.", leftPad(address));
+		val region = region(address);
+		VarHandle.fullFence();
+		val value = region.buffer.get((int) (address - region.base));
+		VarHandle.acquireFence();
+		return value;
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public short getShortVolatile(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading volatile short @ 0x{}.", leftPad(address));
+		val region = region(address);
+		return (short) SHORT.getVolatile(region.buffer, (int) (address - region.base));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public int getIntVolatile(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading volatile int @ 0x{}.", leftPad(address));
+		val region = region(address);
+		return (int) INT.getVolatile(region.buffer, (int) (address - region.base));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public long getLongVolatile(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading volatile long @ 0x{}.", leftPad(address));
+		val region = region(address);
+		return (long) LONG.getVolatile(region.buffer, (int) (address - region.base));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public byte getByteOpaque(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading opaque byte @ 0x{}.", leftPad(address));
+		val region = region(address);
+		val value = region.buffer.get((int) (address - region.base));
+		VarHandle.acquireFence();
+		return value;
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public short getShortOpaque(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading opaque short @ 0x{}.", leftPad(address));
+		val region = region(address);
+		return (short) SHORT.getOpaque(region.buffer, (int) (address - region.base));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public int getIntOpaque(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading opaque int @ 0x{}.", leftPad(address));
+		val region = region(address);
+		return (int) INT.getOpaque(region.buffer, (int) (address - region.base));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public long getLongOpaque(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading opaque long @ 0x{}.", leftPad(address));
+		val region = region(address);
+		return (long) LONG.getOpaque(region.buffer, (int) (address - region.base));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public byte getByteAcquire(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading acquire byte @ 0x{}.", leftPad(address));
+		val region = region(address);
+		val value = region.buffer.get((int) (address - region.base));
+		VarHandle.acquireFence();
+		return value;
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public short getShortAcquire(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading acquire short @ 0x{}.", leftPad(address));
+		val region = region(address);
+		return (short) SHORT.getAcquire(region.buffer, (int) (address - region.base));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public int getIntAcquire(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading acquire int @ 0x{}.", leftPad(address));
+		val region = region(address);
+		return (int) INT.getAcquire(region.buffer, (int) (address - region.base));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public long getLongAcquire(final long address) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Reading acquire long @ 0x{}.", leftPad(address));
+		val region = region(address);
+		return (long) LONG.getAcquire(region.buffer, (int) (address - region.base));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putByte(final long address, final byte value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing byte 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		region.buffer.put((int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putShort(final long address, final short value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing short 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		SHORT.set(region.buffer, (int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putInt(final long address, final int value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing int 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		INT.set(region.buffer, (int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putLong(final long address, final long value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing long 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		LONG.set(region.buffer, (int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putByteVolatile(final long address, final byte value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing volatile byte 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		VarHandle.releaseFence();
+		region.buffer.put((int) (address - region.base), value);
+		VarHandle.fullFence();
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putShortVolatile(final long address, final short value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing volatile short 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		SHORT.setVolatile(region.buffer, (int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putIntVolatile(final long address, final int value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing volatile int 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		INT.setVolatile(region.buffer, (int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putLongVolatile(final long address, final long value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing volatile long 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		LONG.setVolatile(region.buffer, (int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putByteOpaque(final long address, final byte value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing opaque byte 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		VarHandle.releaseFence();
+		region.buffer.put((int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putShortOpaque(final long address, final short value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing opaque short 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		SHORT.setOpaque(region.buffer, (int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putIntOpaque(final long address, final int value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing opaque int 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		INT.setOpaque(region.buffer, (int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putLongOpaque(final long address, final long value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing opaque long 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		LONG.setOpaque(region.buffer, (int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putByteRelease(final long address, final byte value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing release byte 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		VarHandle.releaseFence();
+		region.buffer.put((int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putShortRelease(final long address, final short value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing release short 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		SHORT.setRelease(region.buffer, (int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putIntRelease(final long address, final int value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing release int 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		INT.setRelease(region.buffer, (int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void putLongRelease(final long address, final long value) {
+		if (!OPTIMIZED && address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		if (DEBUG >= LOG_TRACE) log.trace("Writing release long 0x{} @ 0x{}.", leftPad(value), leftPad(address));
+		val region = region(address);
+		LONG.setRelease(region.buffer, (int) (address - region.base), value);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void get(final long src, int bytes, final @NotNull byte[] dest, final int offset) {
+		if (!OPTIMIZED) {
+			if (src == 0) throw new IllegalArgumentException("The parameter 'src' MUST NOT be 0.");
+			if (bytes < 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (dest == null) throw new NullPointerException("The parameter 'dest' MUST NOT be null.");
+			if (offset < 0 || offset >= dest.length) {
+				throw new ArrayIndexOutOfBoundsException("The parameter 'offset' MUST be inside [0, dest.length).");
+			}
+			val diff = dest.length - offset;
+			if (diff < bytes) {
+				if (DEBUG >= LOG_WARN) {
+					log.warn("You are trying to write more bytes than the buffer can hold. Adapting bytes.");
+				}
+				bytes = diff;
+			}
+			if (bytes == 0) return;
+		}
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Copying memory region @ 0x{} + {} ({} bytes).", leftPad(src), offset, bytes);
+		}
+		val region = region(src);
+		region.buffer.duplicate().position((int) (src - region.base)).get(dest, offset, bytes);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void put(final long dest, int bytes, final @NotNull byte[] src, final int offset) {
+		if (!OPTIMIZED) {
+			if (dest == 0) throw new IllegalArgumentException("The parameter 'dest' MUST NOT be 0.");
+			if (bytes < 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (src == null) throw new NullPointerException("The parameter 'src' MUST NOT be null.");
+			if (offset < 0 || offset >= src.length) {
+				throw new ArrayIndexOutOfBoundsException("The parameter 'offset' MUST be inside [0, src.length).");
+			}
+			val diff = src.length - offset;
+			if (diff < bytes) {
+				if (DEBUG >= LOG_WARN) {
+					log.warn("You are trying to write more bytes than the buffer can hold. Adapting bytes.");
+				}
+				bytes = diff;
+			}
+			if (bytes == 0) return;
+		}
+		if (DEBUG >= LOG_TRACE) {
+			log.trace("Copying memory region @ 0x{} + {} ({} bytes).", leftPad(dest), offset, bytes);
+		}
+		val region = region(dest);
+		region.buffer.duplicate().position((int) (dest - region.base)).put(src, offset, bytes);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void get(final long src, int bytes, final @NotNull ByteBuffer dest) {
+		if (!OPTIMIZED) {
+			if (src == 0) throw new IllegalArgumentException("The parameter 'src' MUST NOT be 0.");
+			if (bytes < 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (dest == null) throw new NullPointerException("The parameter 'dest' MUST NOT be null.");
+			if (dest.remaining() < bytes) {
+				if (DEBUG >= LOG_WARN) {
+					log.warn("You are trying to write more bytes than the buffer can hold. Adapting bytes.");
+				}
+				bytes = dest.remaining();
+			}
+			if (bytes == 0) return;
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Copying memory region @ 0x{} ({} bytes).", leftPad(src), bytes);
+		val region = region(src);
+		val start = (int) (src - region.base);
+		dest.put(region.buffer.duplicate().position(start).limit(start + bytes));
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	public void put(final long dest, int bytes, final @NotNull ByteBuffer src) {
+		if (!OPTIMIZED) {
+			if (dest == 0) throw new IllegalArgumentException("The parameter 'dest' MUST NOT be 0.");
+			if (bytes < 0) throw new IllegalArgumentException("The parameter 'bytes' MUST be positive.");
+			if (src == null) throw new NullPointerException("The parameter 'src' MUST NOT be null.");
+			if (src.remaining() < bytes) {
+				if (DEBUG >= LOG_WARN) {
+					log.warn("You are trying to read more bytes than the buffer holds. Adapting bytes.");
+				}
+				bytes = src.remaining();
+			}
+			if (bytes == 0) return;
+		}
+		if (DEBUG >= LOG_TRACE) log.trace("Copying memory region @ 0x{} ({} bytes).", leftPad(dest), bytes);
+		val region = region(dest);
+		val position = src.position();
+		region.buffer.duplicate().position((int) (dest - region.base)).put(src.duplicate().limit(position + bytes));
+		src.position(position + bytes);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(pure = true)
+	public long virt2phys(final long address) {
+		if (!OPTIMIZED && address == 0) {
+			throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+		}
+
+		// If we are on a non-Linux OS this won't work
+		if (!System.getProperty("os.name").toLowerCase(Locale.getDefault()).contains("lin")) {
+			if (DEBUG >= LOG_WARN) log.warn("Cannot translate virtual addresses in a non-Linux OS.");
+			return 0;
+		}
+
+		return pagemap.translate(address);
+	}
+
+	/** {@inheritDoc} */
+	@Override
+	@Contract(mutates = "param5")
+	public void virt2phys(final long address,
+						  final long step,
+						  final int count,
+						  final long hugepageSize,
+						  final @NotNull long[] physical) {
+		if (!OPTIMIZED) {
+			if (address == 0) throw new IllegalArgumentException("The parameter 'address' MUST NOT be 0.");
+			if (step <= 0) throw new IllegalArgumentException("The parameter 'step' MUST be positive.");
+			if (count < 0) throw new IllegalArgumentException("The parameter 'count' MUST NOT be negative.");
+			if (physical == null) throw new NullPointerException("The parameter 'physical' MUST NOT be null.");
+			if (physical.length < count) {
+				throw new IllegalArgumentException("The parameter 'physical' MUST have at least 'count' elements.");
+			}
+		}
+
+		// If we are on a non-Linux OS this won't work
+		if (!System.getProperty("os.name").toLowerCase(Locale.getDefault()).contains("lin")) {
+			if (DEBUG >= LOG_WARN) log.warn("Cannot translate virtual addresses in a non-Linux OS.");
+			Arrays.fill(physical, 0, count, 0);
+			return;
+		}
+		pagemap.translate(address, step, count, Math.max(hugepageSize, 0), physical);
+	}
+
+	///////////////////////////////////////////////// INTERNAL METHODS /////////////////////////////////////////////////
+
+	/**
+	 * Registers a direct byte buffer as a new memory region.
+	 *
+	 * @param buffer The direct byte buffer.
+	 * @return The base virtual address of the memory region.
+	 */
+	private synchronized long register(final @NotNull ByteBuffer buffer) {
+		val base = c_address(buffer);
+		if (base == 0) return 0;
+		// Keep the regions sorted so they can be looked up with a binary search
+		val current = regions;
+		var index = 0;
+		while (index < current.length && current[index].base < base) index += 1;
+		val copy = new Region[current.length + 1];
+		System.arraycopy(current, 0, copy, 0, index);
+		copy[index] = new Region(base, base + buffer.capacity(), buffer);
+		System.arraycopy(current, index, copy, index + 1, current.length - index);
+		regions = copy;
+		return base;
+	}
+
+	/**
+	 * Forgets the memory region that contains a virtual address.
+	 *
+	 * @param address The virtual address.
+	 */
+	private synchronized void unregister(final long address) {
+		val current = regions;
+		for (var i = 0; i < current.length; i += 1) {
+			if (current[i].contains(address)) {
+				val copy = new Region[current.length - 1];
+				System.arraycopy(current, 0, copy, 0, i);
+				System.arraycopy(current, i + 1, copy, i, copy.length - i);
+				last = null;
+				regions = copy;
+				return;
+			}
+		}
+		if (DEBUG >= LOG_WARN) log.warn("The address 0x{} does not belong to any memory region.", leftPad(address));
+	}
+
+	/**
+	 * Finds the memory region that contains a virtual address.
+	 * <p>
+	 * The packet buffers of a batch usually belong to the same memory pool, so the last region that was found is
+	 * checked first, and the sorted regions are searched with a binary search otherwise, so the descriptor rings and
+	 * the memory pools of many queues do not make every miss linear.
+	 *
+	 * @param address The virtual address.
+	 * @return The memory region.
+	 * @throws IllegalArgumentException If the virtual address does not belong to any memory region.
+	 */
+	@Contract(pure = true)
+	private @NotNull Region region(final long address) {
+		val cached = last;
+		if (cached != null && cached.contains(address)) return cached;
+		val current = regions;
+		var low = 0;
+		var high = current.length - 1;
+		while (low <= high) {
+			val middle = (low + high) >>> 1;
+			val region = current[middle];
+			if (address < region.base) {
+				high = middle - 1;
+			} else if (address >= region.end) {
+				low = middle + 1;
+			} else {
+				last = region;
+				return region;
+			}
+		}
+		throw new IllegalArgumentException(String.format("The address 0x%x does not belong to any memory region.",
+				address));
+	}
+
+	/**
+	 * Checks an entry exists in a mount table file using the the given column values.
+	 * <p>
+	 * This method assumes the mount table follows the same format as Linux' {@code /etc/mtab} file.
+	 *
+	 * @param path The mount table path.
+	 * @param fs   The file system type.
+	 * @param mnt  The mount path.
+	 * @param type The mount type.
+	 * @return Whether the entry exists.
+	 */
+	@Contract(pure = true)
+	@SuppressWarnings({"HardcodedFileSeparator", "SameParameterValue", "PMD.DataflowAnomalyAnalysis"})
+	private static boolean existsInMtab(final @NotNull String path,
+										final @NotNull String fs,
+										final @NotNull String mnt,
+										final @NotNull String type) {
+		if (DEBUG >= LOG_DEBUG) log.debug("Parsing file '{}'.", MTAB_PATH);
+		try (val mtab = bufferedReader(new File(path))) {
+			val qfs = Pattern.quote(fs);
+			val qmnt = Pattern.quote(mnt);
+			val qtype = Pattern.quote(type);
+			val pattern = Pattern.compile(String.format("^%s[\\t\\s ]+%s[\\t\\s ]+%s[\\t\\s ]+.*$", qfs, qmnt, qtype));
+			for (var line = mtab.readLine(); line != null; line = mtab.readLine()) {
+				if (pattern.matcher(line).matches()) return true;
+			}
+		} catch (final FileNotFoundException e) {
+			if (DEBUG >= LOG_ERROR) log.error("The file '{}' cannot be found.", MTAB_PATH, e);
+		} catch (final IOException e) {
+			if (DEBUG >= LOG_ERROR) log.error("The file '{}' cannot be read or closed.", MTAB_PATH, e);
+		}
+		return false;
+	}
+
+	/**
+	 * Creates a {@link BufferedReader buffered reader} using {@code file} as input.
+	 *
+	 * @param file The file.
+	 * @return A buffered reader.
+	 * @throws FileNotFoundException If the parameter {@code file} does not exist.
+	 */
+	@Contract(pure = true)
+	private static @NotNull BufferedReader bufferedReader(final @NotNull File file) throws FileNotFoundException {
+		val fis = new FileInputStream(file);
+		val ifs = new InputStreamReader(fis, StandardCharsets.UTF_8);
+		return new BufferedReader(ifs);
+	}
+
+	/**
+	 * Applies a factor to a number based on the {@code unit}.
+	 * <p>
+	 * It only accepts the units {@code GB}, {@code MB}, {@code kB} and {@code B}.
+	 *
+	 * @param x    The magnitude.
+	 * @param unit The units.
+	 * @return The magnitude multiplied by the unit.
+	 */
+	@Contract(pure = true)
+	@SuppressFBWarnings("SF_SWITCH_FALLTHROUGH")
+	@SuppressWarnings("PMD.MissingBreakInSwitch")
+	private static long applyFactor(@Range(from = 0, to = Long.MAX_VALUE) long x, final @NotNull String unit) {
+		switch (unit) {
+			case "GB":
+				x *= K_FACTOR; // fall through
+			// fall through
+			case "MB":
+				x *= K_FACTOR; // fall through
+			// fall through
+			case "kB":
+				x *= K_FACTOR; // fall through
+				break;
+			default:
+				x *= 0;
+		}
+		return x;
+	}
+
+	////////////////////////////////////////////////// INNER CLASSES ///////////////////////////////////////////////////
+
+	/** A memory region backed by a direct byte buffer. */
+	@RequiredArgsConstructor
+	private static final class Region {
+
+		/** The base virtual address. */
+		private final long base;
+
+		/** The virtual address right after the end of the region. */
+		private final long end;
+
+		/** The direct byte buffer. */
+		private final @NotNull ByteBuffer buffer;
+
+		/**
+		 * Checks whether a virtual address belongs to this region.
+		 *
+		 * @param address The virtual address.
+		 * @return Whether the virtual address belongs to this region.
+		 */
+		@Contract(pure = true)
+		boolean contains(final long address) {
+			return address >= base && address < end;
+		}
+
+	}
+
+}
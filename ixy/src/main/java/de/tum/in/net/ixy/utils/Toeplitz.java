@@ -0,0 +1,222 @@
+package de.tum.in.net.ixy.utils;
+
+import lombok.AccessLevel;
+import lombok.NoArgsConstructor;
+import lombok.val;
+
+import org.jetbrains.annotations.Contract;
+import org.jetbrains.annotations.NotNull;
+
+import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+
+/**
+ * Software implementation of the Toeplitz hash used by Receive Side Scaling (RSS).
+ * <p>
+ * The NIC hashes the addresses and ports of every received packet with a secret key and uses the hash to select the
+ * RX queue, so computing the same hash in software allows tests and applications to predict the queue where a flow
+ * will land. The input is always in network byte order: source address, destination address, source port and
+ * destination port.
+ *
+ * @author Esaú García Sánchez-Torija
+ * @see <a href="https://docs.microsoft.com/en-us/windows-hardware/drivers/network/rss-hashing-functions">RSS Hashing
+ * 		Functions</a>
+ */
+@NoArgsConstructor(access = AccessLevel.PRIVATE)
+@SuppressWarnings({"ConstantConditions", "PMD.AvoidDuplicateLiterals"})
+public final class Toeplitz {
+
+	///////////////////////////////////////////////// STATIC VARIABLES /////////////////////////////////////////////////
+
+	/** The size in bytes of an RSS key. */
+	public static final int KEY_BYTES = 40;
+
+	/** The size in bytes of an IPv6 address. */
+	private static final int IPV6_BYTES = 16;
+
+	/** The key used by the reference implementation, which spreads the flows evenly. */
+	private static final @NotNull byte[] DEFAULT_KEY = {
+			(byte) 0x6D, (byte) 0x5A, (byte) 0x56, (byte) 0xDA, (byte) 0x25, (byte) 0x5B, (byte) 0x0E, (byte) 0xC2,
+			(byte) 0x41, (byte) 0x67, (byte) 0x25, (byte) 0x3D, (byte) 0x43, (byte) 0xA3, (byte) 0x8F, (byte) 0xB0,
+			(byte) 0xD0, (byte) 0xCA, (byte) 0x2B, (byte) 0xCB, (byte) 0xAE, (byte) 0x7B, (byte) 0x30, (byte) 0xB4,
+			(byte) 0x77, (byte) 0xCB, (byte) 0x2D, (byte) 0xA3, (byte) 0x80, (byte) 0x30, (byte) 0xF2, (byte) 0x0C,
+			(byte) 0x6A, (byte) 0x42, (byte) 0xB7, (byte) 0x3B, (byte) 0xBE, (byte) 0xAC, (byte) 0x01, (byte) 0xFA
+	};
+
+	////////////////////////////////////////////////// STATIC METHODS //////////////////////////////////////////////////
+
+	/**
+	 * Returns a copy of the key used by the reference implementation.
+	 *
+	 * @return The default key.
+	 */
+	@Contract(value = " -> new", pure = true)
+	public static @NotNull byte[] getDefaultKey() {
+		return DEFAULT_KEY.clone();
+	}
+
+	/**
+	 * Computes the Toeplitz hash of a region of a {@code byte[]}.
+	 *
+	 * @param key    The key, which must be at least 4 bytes longer than the region.
+	 * @param input  The input.
+	 * @param offset The offset of the region.
+	 * @param length The size of the region.
+	 * @return The hash.
+	 */
+	@Contract(pure = true)
+	public static int hash(final @NotNull byte[] key, final @NotNull byte[] input, final int offset, final int length) {
+		if (!OPTIMIZED) {
+			if (key == null) throw new NullPointerException("The parameter 'key' MUST NOT be null.");
+			if (input == null) throw new NullPointerException("The parameter 'input' MUST NOT be null.");
+			if (offset < 0 || length < 0 || offset > input.length - length) {
+				throw new IllegalArgumentException("The region MUST be inside the input.");
+			}
+			if (length > key.length - Integer.BYTES) {
+				throw new IllegalArgumentException("The parameter 'key' MUST be 4 bytes longer than the region.");
+			}
+		}
+		var result = 0;
+		for (var i = 0; i < length; i += 1) result = mix(key, i, input[offset + i], Byte.SIZE, result);
+		return result;
+	}
+
+	/**
+	 * Computes the Toeplitz hash of an IPv4 address pair.
+	 *
+	 * @param key         The key.
+	 * @param source      The source address.
+	 * @param destination The destination address.
+	 * @return The hash.
+	 */
+	@Contract(pure = true)
+	public static int ipv4(final @NotNull byte[] key, final int source, final int destination) {
+		if (!OPTIMIZED) checkKey(key);
+		val result = mix(key, 0, source, Integer.SIZE, 0);
+		return mix(key, Integer.BYTES, destination, Integer.SIZE, result);
+	}
+
+	/**
+	 * Computes the Toeplitz hash of an IPv4 address pair and a TCP or UDP port pair.
+	 *
+	 * @param key             The key.
+	 * @param source          The source address.
+	 * @param destination     The destination address.
+	 * @param sourcePort      The source port.
+	 * @param destinationPort The destination port.
+	 * @return The hash.
+	 */
+	@Contract(pure = true)
+	public static int ipv4(final @NotNull byte[] key, final int source, final int destination, final int sourcePort,
+						   final int destinationPort) {
+		val result = ipv4(key, source, destination);
+		return ports(key, 2 * Integer.BYTES, sourcePort, destinationPort, result);
+	}
+
+	/**
+	 * Computes the Toeplitz hash of an IPv6 address pair.
+	 *
+	 * @param key         The key.
+	 * @param source      The source address.
+	 * @param destination The destination address.
+	 * @return The hash.
+	 */
+	@Contract(pure = true)
+	public static int ipv6(final @NotNull byte[] key, final @NotNull byte[] source, final @NotNull byte[] destination) {
+		if (!OPTIMIZED) {
+			checkKey(key);
+			if (source == null || source.length != IPV6_BYTES) {
+				throw new IllegalArgumentException("The parameter 'source' MUST be an IPv6 address.");
+			}
+			if (destination == null || destination.length != IPV6_BYTES) {
+				throw new IllegalArgumentException("The parameter 'destination' MUST be an IPv6 address.");
+			}
+		}
+		var result = 0;
+		for (var i = 0; i < IPV6_BYTES; i += 1) result = mix(key, i, source[i], Byte.SIZE, result);
+		for (var i = 0; i < IPV6_BYTES; i += 1) result = mix(key, IPV6_BYTES + i, destination[i], Byte.SIZE, result);
+		return result;
+	}
+
+	/**
+	 * Computes the Toeplitz hash of an IPv6 address pair and a TCP or UDP port pair.
+	 *
+	 * @param key             The key.
+	 * @param source          The source address.
+	 * @param destination     The destination address.
+	 * @param sourcePort      The source port.
+	 * @param destinationPort The destination port.
+	 * @return The hash.
+	 */
+	@Contract(pure = true)
+	public static int ipv6(final @NotNull byte[] key, final @NotNull byte[] source, final @NotNull byte[] destination,
+						   final int sourcePort, final int destinationPort) {
+		val result = ipv6(key, source, destination);
+		return ports(key, 2 * IPV6_BYTES, sourcePort, destinationPort, result);
+	}
+
+	/**
+	 * Adds a port pair to a partial hash.
+	 *
+	 * @param key             The key.
+	 * @param position        The position of the port pair inside the input.
+	 * @param sourcePort      The source port.
+	 * @param destinationPort The destination port.
+	 * @param result          The partial hash.
+	 * @return The updated hash.
+	 */
+	@Contract(pure = true)
+	private static int ports(final @NotNull byte[] key, final int position, final int sourcePort,
+							 final int destinationPort, final int result) {
+		val ports = (sourcePort & 0xFFFF) << Short.SIZE | destinationPort & 0xFFFF;
+		return mix(key, position, ports, Integer.SIZE, result);
+	}
+
+	/**
+	 * Adds the most significant bits of a value to a partial hash.
+	 * <p>
+	 * Every set bit of the input XORs into the hash the 32 bits of the key that start at the position of that bit.
+	 *
+	 * @param key      The key.
+	 * @param position The position in bytes of the value inside the input.
+	 * @param value    The value.
+	 * @param bits     The number of bits of the value.
+	 * @param result   The partial hash.
+	 * @return The updated hash.
+	 */
+	@Contract(pure = true)
+	private static int mix(final @NotNull byte[] key, final int position, final int value, final int bits,
+						   int result) {
+		for (var i = 0; i < bits; i += 1) {
+			if ((value >>> (bits - 1 - i) & 1) != 0) result ^= window(key, position * Byte.SIZE + i);
+		}
+		return result;
+	}
+
+	/**
+	 * Returns the 32 bits of the key that start at a given bit.
+	 *
+	 * @param key The key.
+	 * @param bit The position of the first bit.
+	 * @return The window of the key.
+	 */
+	@Contract(pure = true)
+	private static int window(final @NotNull byte[] key, final int bit) {
+		val index = bit >>> 3;
+		var window = 0L;
+		for (var i = index; i <= index + Integer.BYTES; i += 1) {
+			window = window << Byte.SIZE | (i < key.length ? key[i] & 0xFF : 0);
+		}
+		return (int) (window >>> (Byte.SIZE - (bit & 7)));
+	}
+
+	/**
+	 * Checks that a key is big enough to hash the longest input.
+	 *
+	 * @param key The key.
+	 */
+	private static void checkKey(final @NotNull byte[] key) {
+		if (key == null) throw new NullPointerException("The parameter 'key' MUST NOT be null.");
+		if (key.length < KEY_BYTES) throw new IllegalArgumentException("The parameter 'key' MUST have 40 bytes.");
+	}
+
+}
@@ -0,0 +1,42 @@
+package de.tum.in.net.ixy;
+
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+
+import lombok.val;
+
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.io.TempDir;
+import org.junit.jupiter.api.parallel.Execution;
+import org.junit.jupiter.api.parallel.ExecutionMode;
+
+import static org.assertj.core.api.Assertions.assertThat;
+
+/**
+ * Tests the class {@link Device}.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@DisplayName("Device")
+@Execution(ExecutionMode.CONCURRENT)
+final class DeviceTest {
+
+	@Test
+	@DisplayName("readNumaNode(Path)")
+	void readNumaNode(final @TempDir Path dir) throws IOException {
+		val file = dir.resolve("numa_node");
+		assertThat(Device.readNumaNode(file)).isEqualTo(-1);
+		for (val node : new int[] {0, 1, 7}) {
+			Files.write(file, (node + "\n").getBytes(StandardCharsets.US_ASCII));
+			assertThat(Device.readNumaNode(file)).isEqualTo(node);
+		}
+		Files.write(file, "-1\n".getBytes(StandardCharsets.US_ASCII));
+		assertThat(Device.readNumaNode(file)).isEqualTo(-1);
+		Files.write(file, "unknown\n".getBytes(StandardCharsets.US_ASCII));
+		assertThat(Device.readNumaNode(file)).isEqualTo(-1);
+	}
+
+}
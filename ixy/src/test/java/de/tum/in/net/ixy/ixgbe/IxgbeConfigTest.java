@@ -0,0 +1,74 @@
+package de.tum.in.net.ixy.ixgbe;
+
+import lombok.val;
+
+import org.assertj.core.api.SoftAssertions;
+
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.parallel.Execution;
+import org.junit.jupiter.api.parallel.ExecutionMode;
+
+import static org.assertj.core.api.Assertions.assertThatExceptionOfType;
+
+/**
+ * Tests the class {@link IxgbeConfig}.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@DisplayName("IxgbeConfig")
+@Execution(ExecutionMode.CONCURRENT)
+final class IxgbeConfigTest {
+
+	@Test
+	@DisplayName("Wrong arguments produce exceptions")
+	void exceptions() {
+		val config = new IxgbeConfig();
+		assertThatExceptionOfType(NullPointerException.class).isThrownBy(() -> new IxgbeConfig(null));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> config.setRxEntries(32));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> config.setRxEntries(8192));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> config.setTxEntries(1000));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> config.setBufferSize(1024));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> config.setBufferSize(3072));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> config.setBufferSize(32768));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> config.setMempoolEntries(0));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> config.setTxCleanBatch(0));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> config.setTxThresholds(41, 8, 4));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> config.setTxThresholds(36, 128, 4));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> config.setTxThresholds(36, 8, -1));
+	}
+
+	@Test
+	@DisplayName("The combination of the values is checked")
+	void check() {
+		val config = new IxgbeConfig().setTxEntries(IxgbeConfig.MIN_ENTRIES).setTxCleanBatch(IxgbeConfig.MIN_ENTRIES);
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(config::check);
+		config.setTxCleanBatch(IxgbeConfig.MIN_ENTRIES / 2);
+		config.check();
+	}
+
+	@Test
+	@DisplayName("The configuration can be copied")
+	void copy() {
+		val config = new IxgbeConfig()
+				.setRxEntries(4096)
+				.setTxEntries(1024)
+				.setBufferSize(4096)
+				.setMempoolEntries(8192)
+				.setTxCleanBatch(64)
+				.setTxThresholds(32, 1, 0);
+		val copy = new IxgbeConfig(config);
+		config.setRxEntries(IxgbeConfig.DEFAULT_RX_ENTRIES);
+		val softly = new SoftAssertions();
+		softly.assertThat(copy.getRxEntries()).as("RX entries").isEqualTo(4096);
+		softly.assertThat(copy.getTxEntries()).as("TX entries").isEqualTo(1024);
+		softly.assertThat(copy.getBufferSize()).as("Buffer size").isEqualTo(4096);
+		softly.assertThat(copy.getMempoolEntries()).as("Memory pool entries").isEqualTo(8192);
+		softly.assertThat(copy.getTxCleanBatch()).as("TX clean batch").isEqualTo(64);
+		softly.assertThat(copy.getTxPrefetchThreshold()).as("Prefetch threshold").isEqualTo(32);
+		softly.assertThat(copy.getTxHostThreshold()).as("Host threshold").isEqualTo(1);
+		softly.assertThat(copy.getTxWritebackThreshold()).as("Writeback threshold").isEqualTo(0);
+		softly.assertAll();
+	}
+
+}
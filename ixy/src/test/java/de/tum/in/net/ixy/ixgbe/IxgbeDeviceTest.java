@@ -0,0 +1,148 @@
+package de.tum.in.net.ixy.ixgbe;
+
+import de.tum.in.net.ixy.memory.JniMemoryManager;
+import de.tum.in.net.ixy.memory.MemoryManager;
+import de.tum.in.net.ixy.memory.PacketBufferWrapperConstants;
+
+import lombok.val;
+
+import org.assertj.core.api.SoftAssertions;
+
+import org.jetbrains.annotations.NotNull;
+
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.condition.EnabledOnOs;
+import org.junit.jupiter.api.condition.OS;
+import org.junit.jupiter.api.parallel.Execution;
+import org.junit.jupiter.api.parallel.ExecutionMode;
+
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Tests the parts of the class {@link IxgbeDevice} that do not need a NIC.
+ * <p>
+ * The descriptor rings are emulated in regular memory, writing back the descriptors as the NIC would, and the Flow
+ * Director hashes are compared against the values the Linux ixgbe driver computes.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@EnabledOnOs(OS.LINUX)
+@DisplayName("IxgbeDevice")
+@Execution(ExecutionMode.CONCURRENT)
+final class IxgbeDeviceTest {
+
+	/** The number of descriptors of the emulated ring. */
+	private static final int CAPACITY = 8;
+
+	/** The size of a descriptor. */
+	private static final int DESCRIPTOR_SIZE = 16;
+
+	/** The size of a packet buffer. */
+	private static final int BUFFER_SIZE = 2048;
+
+	/** The number of segments of the emulated jumbo frame. */
+	private static final int SEGMENTS = 5;
+
+	/** The size of every segment of the emulated jumbo frame. */
+	private static final int SEGMENT_SIZE = 1024;
+
+	/** The memory manager, which also loads the library that contains the {@code native} batches. */
+	private static final @NotNull MemoryManager mmanager = JniMemoryManager.getSingleton();
+
+	@Test
+	@DisplayName("c_rx_batch() collects a packet with more segments than the requested packets")
+	void rxBatchSegments() {
+		assumeTrue(mmanager.isValid());
+		val bytes = CAPACITY * (DESCRIPTOR_SIZE + BUFFER_SIZE);
+		val ring = mmanager.allocate(bytes, false, false);
+		assumeTrue(ring != 0);
+		try {
+			// Write back a jumbo frame spread over several descriptors, followed by a descriptor the NIC still owns
+			val buffers = new long[CAPACITY];
+			for (var i = 0; i < CAPACITY; i += 1) {
+				buffers[i] = ring + CAPACITY * DESCRIPTOR_SIZE + i * BUFFER_SIZE;
+				val desc = ring + i * DESCRIPTOR_SIZE;
+				var status = 0;
+				if (i < SEGMENTS) status |= IxgbeDefs.RXDADV_STAT_DD;
+				if (i == SEGMENTS - 1) status |= IxgbeDefs.RXDADV_STAT_EOP;
+				mmanager.putInt(desc, 0);
+				mmanager.putInt(desc + 4, 0);
+				mmanager.putInt(desc + 8, status);
+				mmanager.putInt(desc + 12, i < SEGMENTS ? SEGMENT_SIZE : 0);
+			}
+
+			// Ask for a single packet, which needs more descriptors than that
+			val received = new long[CAPACITY];
+			val consumed = IxgbeDevice.c_rx_batch(ring, 0, CAPACITY, buffers, received, received.length, 1);
+			val softly = new SoftAssertions();
+			softly.assertThat(consumed).as("Consumed descriptors").isEqualTo(SEGMENTS);
+			for (var i = 0; i < SEGMENTS; i += 1) {
+				softly.assertThat(received[i]).as("Segment #%d", i).isEqualTo(buffers[i]);
+				softly.assertThat(mmanager.getInt(buffers[i] + PacketBufferWrapperConstants.PKT_OFFSET))
+						.as("Size of segment #%d", i).isEqualTo(SEGMENT_SIZE);
+				softly.assertThat(mmanager.getLong(buffers[i] + PacketBufferWrapperConstants.NXT_OFFSET))
+						.as("Next of segment #%d", i).isEqualTo(i == SEGMENTS - 1 ? 0 : buffers[i + 1]);
+			}
+			softly.assertThat(mmanager.getShort(buffers[0] + PacketBufferWrapperConstants.SEG_OFFSET))
+					.as("Segments").isEqualTo((short) SEGMENTS);
+			softly.assertAll();
+		} finally {
+			mmanager.free(ring, bytes, false, false);
+		}
+	}
+
+	@Test
+	@DisplayName("The RX segments never exceed the payload of the packet buffers")
+	void rxSegments() {
+		val softly = new SoftAssertions();
+		softly.assertThat(IxgbeDevice.rxSegmentKb(IxgbeConfig.MIN_BUFFER_SIZE)).as("Minimum segment").isEqualTo(1);
+		softly.assertThat(IxgbeDevice.computeRxBufferSize(IxgbeDevice.DEFAULT_MTU, IxgbeConfig.MIN_BUFFER_SIZE))
+				.as("Buffer size of the default MTU").isEqualTo(4096);
+		for (var bufferSize = IxgbeConfig.MIN_BUFFER_SIZE; bufferSize <= IxgbeConfig.MAX_BUFFER_SIZE; bufferSize <<= 1) {
+			for (var mtu = IxgbeDevice.MIN_MTU; mtu <= IxgbeDevice.MAX_MTU; mtu += 1) {
+				val rxBufferSize = IxgbeDevice.computeRxBufferSize(mtu, bufferSize);
+				val segmentBytes = IxgbeDevice.rxSegmentKb(rxBufferSize) * 1024;
+				softly.assertThat(rxBufferSize).as("Buffer size of MTU %d", mtu).isGreaterThanOrEqualTo(bufferSize);
+				softly.assertThat(segmentBytes).as("SRRCTL of MTU %d and %d bytes", mtu, bufferSize)
+						.isPositive()
+						.isLessThanOrEqualTo(rxBufferSize - PacketBufferWrapperConstants.PAYLOAD_OFFSET);
+			}
+		}
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("fdirPerfectHash(int, int) && fdirSignatureHash(int, int) match the Linux ixgbe driver")
+	void fdirHashes() {
+		// The flow type, addresses, ports and the hashes ixgbe_atr_compute_perfect_hash_82599() and
+		// ixgbe_atr_compute_sig_hash_82599() compute for them
+		val flows = new int[][] {
+				{IxgbeDefs.ATR_FLOW_TYPE_TCPV4, 0x00000000, 0x00000000, 0, 0, 0x0A52, 0x6A124A52},
+				{IxgbeDefs.ATR_FLOW_TYPE_TCPV4, 0x0A000001, 0x0A000002, 1234, 80, 0x08C9, 0x6B6C48C9},
+				{IxgbeDefs.ATR_FLOW_TYPE_UDPV4, 0xC0A80101, 0xC0A80164, 53, 5353, 0x0B4B, 0x7A414B4B},
+				{IxgbeDefs.ATR_FLOW_TYPE_TCPV4, 0xFFFFFFFF, 0x00000000, 0xFFFF, 0, 0x094A, 0x06EA694A}
+		};
+		val softly = new SoftAssertions();
+		for (val flow : flows) {
+			val common = flow[1] ^ flow[2] ^ (flow[3] << Short.SIZE | flow[4]);
+			softly.assertThat(IxgbeDevice.fdirPerfectHash(flow[0], common))
+					.as("Perfect hash of 0x%08X", common).isEqualTo(flow[5]);
+			softly.assertThat(IxgbeDevice.fdirSignatureHash(flow[0], common))
+					.as("Signature hash of 0x%08X", common).isEqualTo(flow[6]);
+		}
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("fdirAddress(int) && fdirPorts(int, int) match the Linux ixgbe driver")
+	void fdirRegisters() {
+		// ixgbe_fdir_write_perfect_filter_82599() writes the addresses in network byte order and the ports in host order
+		val softly = new SoftAssertions();
+		softly.assertThat(IxgbeDevice.fdirAddress(0x0A000001)).as("FDIRIPSA of 10.0.0.1").isEqualTo(0x0100000A);
+		softly.assertThat(IxgbeDevice.fdirAddress(0xC0A80164)).as("FDIRIPDA of 192.168.1.100").isEqualTo(0x6401A8C0);
+		softly.assertThat(IxgbeDevice.fdirPorts(1234, 80)).as("FDIRPORT of 1234 -> 80").isEqualTo(0x005004D2);
+		softly.assertAll();
+	}
+
+}
@@ -0,0 +1,6 @@
+/**
+ * Contains the tests for the package {@link de.tum.in.net.ixy.ixgbe}.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+package de.tum.in.net.ixy.ixgbe;
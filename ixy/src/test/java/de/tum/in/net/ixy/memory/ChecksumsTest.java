@@ -0,0 +1,281 @@
+package de.tum.in.net.ixy.memory;
+
+import java.security.SecureRandom;
+import java.util.Random;
+
+import lombok.val;
+
+import org.assertj.core.api.SoftAssertions;
+
+import org.jetbrains.annotations.NotNull;
+
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.TestReporter;
+import org.junit.jupiter.api.parallel.Execution;
+import org.junit.jupiter.api.parallel.ExecutionMode;
+
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.PAYLOAD_OFFSET;
+
+import static org.assertj.core.api.Assertions.assertThat;
+
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Tests the class {@link Checksums}.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@DisplayName("Checksums")
+@Execution(ExecutionMode.CONCURRENT)
+final class ChecksumsTest {
+
+	/** The example of the section 3 of RFC 1071. */
+	private static final @NotNull byte[] RFC_1071 = bytes(0x00, 0x01, 0xF2, 0x03, 0xF4, 0xF5, 0xF6, 0xF7);
+
+	/** An IPv4 header whose checksum is {@code 0xB861}. */
+	private static final @NotNull byte[] IPV4_HEADER = bytes(
+			0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x40, 0x11,
+			0xB8, 0x61, 0xC0, 0xA8, 0x00, 0x01, 0xC0, 0xA8, 0x00, 0xC7
+	);
+
+	/** An IPv4 packet that transports a UDP datagram whose checksum is {@code 0x03D7}. */
+	private static final @NotNull byte[] UDP_PACKET = bytes(
+			0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x40, 0x11,
+			0x00, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x02,
+			0x00, 0x2A, 0x05, 0x39, 0x00, 0x0C, 0x00, 0x00,
+			0x69, 0x78, 0x79, 0x21
+	);
+
+	/** An IPv4 packet that transports a TCP segment. */
+	private static final @NotNull byte[] TCP_PACKET = bytes(
+			0x45, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x40, 0x00, 0x40, 0x06,
+			0xAA, 0xAA, 0x0A, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x02,
+			0x00, 0x2A, 0x05, 0x39, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+			0x50, 0x18, 0x01, 0x00, 0xAA, 0xAA, 0x00, 0x00,
+			0x69, 0x78, 0x79, 0x21
+	);
+
+	/** The maximum size of the random regions. */
+	private static final int MAX_SIZE = 2048;
+
+	/** The size of the region used to measure the throughput, which matches an MTU sized packet. */
+	private static final int BENCHMARK_SIZE = 1500;
+
+	/** The number of sums computed by every benchmark round. */
+	private static final int ITERATIONS = 100_000;
+
+	/** The number of benchmark rounds run before measuring, which give the JIT compiler time to compile the loops. */
+	private static final int WARMUP_ROUNDS = 5;
+
+	/** The number of measured benchmark rounds. */
+	private static final int ROUNDS = 10;
+
+	/** A cached instance of a pseudo-random number generator. */
+	private static final Random random = new SecureRandom();
+
+	/** The memory manager. */
+	private static final MemoryManager mmanager = UnsafeMemoryManager.getSingleton();
+
+	@Test
+	@DisplayName("checksum(byte[], int, int) matches the reference vectors")
+	void vectors() {
+		val softly = new SoftAssertions();
+		softly.assertThat(Checksums.sum(RFC_1071, 0, RFC_1071.length, 0)).isEqualTo(0xDDF2);
+		softly.assertThat(Checksums.checksum(RFC_1071, 0, RFC_1071.length)).isEqualTo((short) 0x220D);
+		softly.assertThat(Checksums.checksum(IPV4_HEADER, 0, IPV4_HEADER.length)).isEqualTo((short) 0);
+		val header = IPV4_HEADER.clone();
+		softly.assertThat(Checksums.ipv4(header, 0)).isEqualTo((short) 0xB861);
+		softly.assertThat(header).isEqualTo(IPV4_HEADER);
+		val packet = UDP_PACKET.clone();
+		softly.assertThat(Checksums.udp(packet, 0)).isEqualTo((short) 0x03D7);
+		softly.assertThat(packet[26]).isEqualTo((byte) 0x03);
+		softly.assertThat(packet[27]).isEqualTo((byte) 0xD7);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("sum(long, int, int) matches sum(byte[], int, int, int)")
+	void sum() {
+		val address = mmanager.allocate(MAX_SIZE + Long.BYTES, false, false);
+		assumeTrue(address != 0);
+		val data = new byte[MAX_SIZE];
+		random.nextBytes(data);
+		mmanager.put(address, data.length, data, 0);
+		val softly = new SoftAssertions();
+		for (var offset = 0; offset < Long.BYTES; offset += 1) {
+			for (var bytes = 0; bytes <= MAX_SIZE - offset; bytes += 1 + random.nextInt(Long.BYTES)) {
+				val initial = random.nextInt(0x10000);
+				softly.assertThat(Checksums.sum(address + offset, bytes, initial))
+						.as("%d bytes @ %d", bytes, offset)
+						.isEqualTo(reference(data, offset, bytes, initial));
+			}
+		}
+		mmanager.free(address, MAX_SIZE + Long.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("update(short, short, short) and update(short, int, int) match a full computation")
+	void update() {
+		val data = new byte[MAX_SIZE];
+		random.nextBytes(data);
+		val field = random.nextInt(MAX_SIZE / 2 - 2) * 2;
+		val checksum = Checksums.checksum(data, 0, data.length);
+
+		val previousShort = (short) (((data[field] & 0xFF) << Byte.SIZE) | (data[field + 1] & 0xFF));
+		val currentShort = (short) random.nextInt();
+		data[field] = (byte) (currentShort >> Byte.SIZE);
+		data[field + 1] = (byte) currentShort;
+		val updatedShort = Checksums.update(checksum, previousShort, currentShort);
+
+		val previousInt = ((currentShort & 0xFFFF) << Short.SIZE)
+				| ((data[field + 2] & 0xFF) << Byte.SIZE) | (data[field + 3] & 0xFF);
+		val currentInt = random.nextInt();
+		for (var i = 0; i < Integer.BYTES; i += 1) {
+			data[field + i] = (byte) (currentInt >>> (Integer.SIZE - (i + 1) * Byte.SIZE));
+		}
+		val updatedInt = Checksums.update(updatedShort, previousInt, currentInt);
+
+		// The incremental update may produce the other representation of zero, so compare the values
+		assertThat(equivalent(updatedInt, Checksums.checksum(data, 0, data.length))).isTrue();
+	}
+
+	@Test
+	@DisplayName("ipv4(PacketBufferWrapper, int) and udp(PacketBufferWrapper, int) write the checksums")
+	void packet() {
+		val size = PAYLOAD_OFFSET + UDP_PACKET.length;
+		val address = mmanager.allocate(size, false, false);
+		assumeTrue(address != 0);
+		mmanager.put(address + PAYLOAD_OFFSET, UDP_PACKET.length, UDP_PACKET, 0);
+		val packet = new PacketBufferWrapper(address);
+		val softly = new SoftAssertions();
+		softly.assertThat(Checksums.udp(packet, 0)).isEqualTo((short) 0x03D7);
+		softly.assertThat(Checksums.getNetworkShort(packet, 26)).isEqualTo((short) 0x03D7);
+		val ip = Checksums.ipv4(packet, 0);
+		softly.assertThat(Checksums.getNetworkShort(packet, 10)).isEqualTo(ip);
+		val data = new byte[UDP_PACKET.length];
+		mmanager.get(address + PAYLOAD_OFFSET, data.length, data, 0);
+		softly.assertThat(Checksums.checksum(data, 0, 20)).isEqualTo((short) 0);
+		mmanager.free(address, size, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("offload(byte[], int) writes the pseudo header sum and packs the offload flags")
+	void offload() {
+		val packet = UDP_PACKET.clone();
+		packet[10] = (byte) 0xAA;
+		val offload = Checksums.offload(packet, 0);
+		val softly = new SoftAssertions();
+		softly.assertThat(offload).isEqualTo(PacketBufferWrapper.offload(0, 20, 8,
+				PacketBufferWrapperConstants.OFL_IP_CHECKSUM | PacketBufferWrapperConstants.OFL_UDP_CHECKSUM));
+		softly.assertThat(packet[10]).isZero();
+		softly.assertThat(packet[11]).isZero();
+
+		// The NIC adds the sum of the datagram to the pseudo header sum and complements the result
+		val pseudo = ((packet[26] & 0xFF) << Byte.SIZE) | (packet[27] & 0xFF);
+		packet[26] = 0;
+		packet[27] = 0;
+		softly.assertThat(Checksums.finish(Checksums.sum(packet, 20, 12, pseudo))).isEqualTo((short) 0x03D7);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("segmentation(PacketBufferWrapper, int, int) writes the pseudo header sum without the length")
+	void segmentation() {
+		val size = PAYLOAD_OFFSET + TCP_PACKET.length;
+		val address = mmanager.allocate(size, false, false);
+		assumeTrue(address != 0);
+		mmanager.put(address + PAYLOAD_OFFSET, TCP_PACKET.length, TCP_PACKET, 0);
+		val packet = new PacketBufferWrapper(address);
+		val offload = Checksums.segmentation(packet, 0, 1448);
+		val softly = new SoftAssertions();
+		softly.assertThat(offload).isEqualTo(PacketBufferWrapper.offload(0, 20, 20,
+				PacketBufferWrapperConstants.OFL_IP_CHECKSUM | PacketBufferWrapperConstants.OFL_TCP_CHECKSUM
+						| PacketBufferWrapperConstants.OFL_TSO));
+		softly.assertThat(packet.getOffload()).isEqualTo(offload);
+		softly.assertThat(packet.getMss()).isEqualTo(1448);
+		softly.assertThat(Checksums.getNetworkShort(packet, 10)).isZero();
+		softly.assertThat(Checksums.getNetworkShort(packet, 36))
+				.isEqualTo((short) Checksums.pseudoHeader(0x0A000001, 0x0A000002, Checksums.PROTOCOL_TCP, 0));
+		mmanager.free(address, size, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("Throughput of sum(long, int, int)")
+	void throughput(final TestReporter reporter) {
+		val address = mmanager.allocate(BENCHMARK_SIZE, false, false);
+		assumeTrue(address != 0);
+		val data = new byte[BENCHMARK_SIZE];
+		random.nextBytes(data);
+		mmanager.put(address, data.length, data, 0);
+		val expected = reference(data, 0, data.length, 0);
+		for (var i = 0; i < WARMUP_ROUNDS; i += 1) assertThat(round(address)).isEqualTo(expected);
+		val start = System.nanoTime();
+		for (var i = 0; i < ROUNDS; i += 1) assertThat(round(address)).isEqualTo(expected);
+		val elapsed = System.nanoTime() - start;
+		mmanager.free(address, BENCHMARK_SIZE, false, false);
+		val bits = (double) ROUNDS * ITERATIONS * BENCHMARK_SIZE * Byte.SIZE;
+		reporter.publishEntry("Checksums.sum", String.format("%.2f Gbit/s", bits / elapsed));
+	}
+
+	/**
+	 * Sums the same memory region several times.
+	 *
+	 * @param address The address of the memory region.
+	 * @return The sum of the memory region, which must be the same every time.
+	 */
+	private static int round(final long address) {
+		var sum = 0;
+		for (var i = 0; i < ITERATIONS; i += 1) sum = Checksums.sum(address, BENCHMARK_SIZE, 0);
+		return sum;
+	}
+
+	/**
+	 * Computes the one's complement sum of a region byte by byte, as described in RFC 1071.
+	 *
+	 * @param data    The data.
+	 * @param offset  The offset of the region.
+	 * @param bytes   The size of the region.
+	 * @param initial The partial sum.
+	 * @return The folded 16 bit sum.
+	 */
+	private static int reference(final @NotNull byte[] data, final int offset, final int bytes, final int initial) {
+		var sum = (long) initial;
+		for (var i = 0; i < bytes; i += 1) {
+			val value = data[offset + i] & 0xFF;
+			sum += i % 2 == 0 ? value << Byte.SIZE : value;
+		}
+		while (sum > 0xFFFF) sum = (sum & 0xFFFF) + (sum >> Short.SIZE);
+		return (int) sum;
+	}
+
+	/**
+	 * Checks whether two checksums represent the same one's complement value, which happens when both are equal or one
+	 * is the negative zero of the other.
+	 *
+	 * @param a The first checksum.
+	 * @param b The second checksum.
+	 * @return Whether both checksums are equivalent.
+	 */
+	private static boolean equivalent(final short a, final short b) {
+		val x = a & 0xFFFF;
+		val y = b & 0xFFFF;
+		return x == y || x + y == 0xFFFF && (x == 0 || y == 0);
+	}
+
+	/**
+	 * Creates a {@code byte[]} from a list of unsigned bytes.
+	 *
+	 * @param values The unsigned bytes.
+	 * @return The {@code byte[]}.
+	 */
+	private static @NotNull byte[] bytes(final int... values) {
+		val data = new byte[values.length];
+		for (var i = 0; i < values.length; i += 1) data[i] = (byte) values[i];
+		return data;
+	}
+
+}
@@ -0,0 +1,116 @@
+package de.tum.in.net.ixy.memory;
+
+import lombok.val;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.parallel.Execution;
+import org.junit.jupiter.api.parallel.ExecutionMode;
+
+import static de.tum.in.net.ixy.BuildConfig.MEMORY_MANAGER;
+import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_VARHANDLE;
+
+import static org.assertj.core.api.Assertions.assertThat;
+import static org.assertj.core.api.Assertions.assertThatExceptionOfType;
+
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Tests the class {@link DmaArena}.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@DisplayName("DmaArena")
+@Execution(ExecutionMode.SAME_THREAD)
+final class DmaArenaTest {
+
+	/** The size of a descriptor ring. */
+	private static final int RING_SIZE = 8192;
+
+	/** The alignment of a descriptor ring. */
+	private static final int RING_ALIGNMENT = 128;
+
+	/** The memory manager. */
+	@SuppressWarnings("NestedConditionalExpression")
+	private static final MemoryManager mmanager = MEMORY_MANAGER == PREFER_JNI_FULL
+			? JniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_JNI
+			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
+			: SmartUnsafeMemoryManager.getSingleton();
+
+	/** The arena. */
+	private DmaArena arena;
+
+	// Creates an arena if huge memory pages are supported
+	@BeforeEach
+	void setUp() {
+		assumeTrue(mmanager.getHugepageSize() > 0);
+		arena = new DmaArena(mmanager);
+	}
+
+	// Releases the regions reserved by the arena
+	@AfterEach
+	void tearDown() {
+		if (arena != null) arena.free();
+	}
+
+	@Test
+	@DisplayName("Wrong arguments produce exceptions")
+	void exceptions() {
+		assumeTrue(!OPTIMIZED);
+		assertThatExceptionOfType(NullPointerException.class).isThrownBy(() -> new DmaArena(null));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> new DmaArena(mmanager, -1));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> arena.allocate(0, RING_ALIGNMENT));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> arena.allocate(RING_SIZE, 0));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> arena.allocate(RING_SIZE, 3));
+	}
+
+	@Test
+	@DisplayName("allocate(long, long) shares regions between chunks")
+	void allocate() {
+		val granularity = arena.getGranularity();
+		val count = (int) (2 * arena.getRegionSize() / RING_SIZE);
+		for (var i = 0; i < count; i += 1) {
+			val virtual = arena.allocate(RING_SIZE, RING_ALIGNMENT).getVirtual();
+			assertThat(virtual).isNotZero();
+			assertThat(virtual % RING_ALIGNMENT).isZero();
+			assertThat(virtual / granularity).isEqualTo((virtual + RING_SIZE - 1) / granularity);
+		}
+		assertThat(arena.getRegions()).isEqualTo(2);
+		assertThat(arena.getAllocations()).isEqualTo(count);
+		assertThat(arena.getUsed()).isEqualTo((long) count * RING_SIZE);
+		assertThat(arena.getReserved()).isEqualTo(2 * arena.getRegionSize());
+		assertThat(arena.getUsed() + arena.getWasted() + arena.getAvailable()).isEqualTo(arena.getReserved());
+	}
+
+	@Test
+	@DisplayName("allocate(long, long) never crosses a huge memory page boundary")
+	void boundaries() {
+		val granularity = arena.getGranularity();
+		val first = arena.allocate(granularity - RING_ALIGNMENT, RING_ALIGNMENT).getVirtual();
+		val second = arena.allocate(RING_SIZE, RING_ALIGNMENT).getVirtual();
+		assertThat(first % granularity).isZero();
+		assertThat(second - first).isEqualTo(granularity);
+		assertThat(arena.getWasted()).isEqualTo(RING_ALIGNMENT);
+	}
+
+	@Test
+	@DisplayName("allocate(long, long) reserves dedicated regions for big chunks")
+	void dedicated() {
+		val bytes = arena.getRegionSize() + 1;
+		val virtual = arena.allocate(bytes, RING_ALIGNMENT).getVirtual();
+		assertThat(virtual).isNotZero();
+		assertThat(virtual % arena.getGranularity()).isZero();
+		assertThat(arena.getRegions()).isEqualTo(1);
+		assertThat(arena.getReserved()).isEqualTo(arena.getRegionSize() + arena.getGranularity());
+		assertThat(arena.getAvailable()).isZero();
+	}
+
+}
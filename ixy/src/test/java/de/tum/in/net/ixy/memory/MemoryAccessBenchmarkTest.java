@@ -0,0 +1,186 @@
+package de.tum.in.net.ixy.memory;
+
+import lombok.val;
+
+import org.jetbrains.annotations.NotNull;
+
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.TestReporter;
+import org.junit.jupiter.api.condition.EnabledOnOs;
+import org.junit.jupiter.api.condition.OS;
+import org.junit.jupiter.api.parallel.Execution;
+import org.junit.jupiter.api.parallel.ExecutionMode;
+
+import static org.assertj.core.api.Assertions.assertThat;
+
+/**
+ * Compares the cost of the scalar accessors of the {@code native} memory managers against the ones of {@link
+ * SmartUnsafeMemoryManager}.
+ * <p>
+ * The scalar accessors of {@link JniMemoryManager} are exported as critical natives, so once the loops are compiled
+ * their cost should be close to the one of the {@code Unsafe}-based memory manager. The {@link VarHandleMemoryManager}
+ * is compared on the access pattern of the RX and TX batches instead, which alternate between a descriptor ring and
+ * the packet buffers, two different memory regions.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@EnabledOnOs(OS.LINUX)
+@DisplayName("Memory accessors benchmark")
+@Execution(ExecutionMode.SAME_THREAD)
+final class MemoryAccessBenchmarkTest {
+
+	/** The number of integers the accessed memory region holds, which keeps it inside the L1 cache. */
+	private static final int SLOTS = 1024;
+
+	/** The number of writes and reads of every round. */
+	private static final int ITERATIONS = 1_000_000;
+
+	/** The number of rounds run before measuring, which give the JIT compiler time to compile the loops. */
+	private static final int WARMUP_ROUNDS = 10;
+
+	/** The number of measured rounds. */
+	private static final int ROUNDS = 10;
+
+	/** The sum of all the values written during a round. */
+	private static final long EXPECTED = (long) ITERATIONS * (ITERATIONS - 1) / 2;
+
+	/** The number of descriptors of the emulated descriptor ring. */
+	private static final int DESCRIPTORS = 512;
+
+	/** The size of a descriptor. */
+	private static final int DESCRIPTOR_SIZE = 16;
+
+	/** The distance between two emulated packet buffers, which only need their header. */
+	private static final int STRIDE = PacketBufferWrapperConstants.PAYLOAD_OFFSET;
+
+	@Test
+	@DisplayName("Scalar accessors of the native memory managers vs SmartUnsafeMemoryManager")
+	void accessors(final TestReporter reporter) {
+		val mmanagers = new MemoryManager[] {
+				JniMemoryManager.getSingleton(),
+				SmartJniMemoryManager.getSingleton(),
+				SmartUnsafeMemoryManager.getSingleton()
+		};
+		for (val mmanager : mmanagers) {
+			if (!mmanager.isValid()) continue;
+			val bytes = SLOTS * Integer.BYTES;
+			val address = mmanager.allocate(bytes, false, false);
+			if (address == 0) continue;
+			try {
+				for (var i = 0; i < WARMUP_ROUNDS; i++) {
+					assertThat(plain(mmanager, address)).isEqualTo(EXPECTED);
+					assertThat(volatiles(mmanager, address)).isEqualTo(EXPECTED);
+				}
+				var start = System.nanoTime();
+				for (var i = 0; i < ROUNDS; i++) assertThat(plain(mmanager, address)).isEqualTo(EXPECTED);
+				val plain = System.nanoTime() - start;
+				start = System.nanoTime();
+				for (var i = 0; i < ROUNDS; i++) assertThat(volatiles(mmanager, address)).isEqualTo(EXPECTED);
+				val volatiles = System.nanoTime() - start;
+				val name = mmanager.getClass().getSimpleName();
+				reporter.publishEntry(name + ".getInt/putInt", perOperation(plain));
+				reporter.publishEntry(name + ".getIntVolatile/putIntVolatile", perOperation(volatiles));
+			} finally {
+				mmanager.free(address, bytes, false, false);
+			}
+		}
+	}
+
+	@Test
+	@DisplayName("Descriptor ring accesses of VarHandleMemoryManager vs SmartUnsafeMemoryManager")
+	void descriptors(final TestReporter reporter) {
+		val mmanagers = new MemoryManager[] {
+				VarHandleMemoryManager.getSingleton(),
+				SmartUnsafeMemoryManager.getSingleton()
+		};
+		for (val mmanager : mmanagers) {
+			if (!mmanager.isValid()) continue;
+			val ringBytes = DESCRIPTORS * DESCRIPTOR_SIZE;
+			val bufferBytes = DESCRIPTORS * STRIDE;
+			val ring = mmanager.allocate(ringBytes, false, false);
+			if (ring == 0) continue;
+			val buffers = mmanager.allocate(bufferBytes, false, false);
+			try {
+				if (buffers == 0) continue;
+				for (var i = 0; i < WARMUP_ROUNDS; i++) assertThat(ring(mmanager, ring, buffers)).isEqualTo(EXPECTED);
+				val start = System.nanoTime();
+				for (var i = 0; i < ROUNDS; i++) assertThat(ring(mmanager, ring, buffers)).isEqualTo(EXPECTED);
+				val elapsed = System.nanoTime() - start;
+				reporter.publishEntry(mmanager.getClass().getSimpleName() + " descriptor ring", perOperation(elapsed));
+			} finally {
+				if (buffers != 0) mmanager.free(buffers, bufferBytes, false, false);
+				mmanager.free(ring, ringBytes, false, false);
+			}
+		}
+	}
+
+	/**
+	 * Writes descriptors the way the TX batches do and reads them back the way the RX batches do, copying the length of
+	 * every descriptor to the header of its packet buffer.
+	 *
+	 * @param mmanager The memory manager.
+	 * @param ring     The base address of the descriptor ring.
+	 * @param buffers  The base address of the packet buffers.
+	 * @return The sum of the values read.
+	 */
+	private static long ring(final @NotNull MemoryManager mmanager, final long ring, final long buffers) {
+		var sum = 0L;
+		for (var i = 0; i < ITERATIONS; i++) {
+			val index = i & (DESCRIPTORS - 1);
+			val desc = ring + (long) index * DESCRIPTOR_SIZE;
+			mmanager.putLongVolatile(desc, buffers + (long) index * STRIDE);
+			mmanager.putIntVolatile(desc + 8, i);
+			mmanager.putShort(desc + 12, (short) i);
+			sum += mmanager.getIntVolatile(desc + 8);
+			val buffer = mmanager.getLongVolatile(desc);
+			mmanager.putInt(buffer + PacketBufferWrapperConstants.PKT_OFFSET, mmanager.getShort(desc + 12) & 0xFFFF);
+		}
+		return sum;
+	}
+
+	/**
+	 * Writes and reads back integers using the plain accessors.
+	 *
+	 * @param mmanager The memory manager.
+	 * @param address  The base address of the memory region.
+	 * @return The sum of the values read.
+	 */
+	private static long plain(final @NotNull MemoryManager mmanager, final long address) {
+		var sum = 0L;
+		for (var i = 0; i < ITERATIONS; i++) {
+			val slot = address + (long) (i & (SLOTS - 1)) * Integer.BYTES;
+			mmanager.putInt(slot, i);
+			sum += mmanager.getInt(slot);
+		}
+		return sum;
+	}
+
+	/**
+	 * Writes and reads back integers using the volatile accessors.
+	 *
+	 * @param mmanager The memory manager.
+	 * @param address  The base address of the memory region.
+	 * @return The sum of the values read.
+	 */
+	private static long volatiles(final @NotNull MemoryManager mmanager, final long address) {
+		var sum = 0L;
+		for (var i = 0; i < ITERATIONS; i++) {
+			val slot = address + (long) (i & (SLOTS - 1)) * Integer.BYTES;
+			mmanager.putIntVolatile(slot, i);
+			sum += mmanager.getIntVolatile(slot);
+		}
+		return sum;
+	}
+
+	/**
+	 * Formats the average time of a single access.
+	 *
+	 * @param elapsed The time spent by all the measured rounds, in nanoseconds.
+	 * @return The average time of a single access.
+	 */
+	private static @NotNull String perOperation(final long elapsed) {
+		return String.format("%.2f ns/op", (double) elapsed / ((double) ROUNDS * ITERATIONS * 2));
+	}
+
+}
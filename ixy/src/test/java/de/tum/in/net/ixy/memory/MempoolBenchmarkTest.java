@@ -0,0 +1,181 @@
+package de.tum.in.net.ixy.memory;
+
+import lombok.val;
+
+import org.jetbrains.annotations.NotNull;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.TestReporter;
+import org.junit.jupiter.api.condition.EnabledOnOs;
+import org.junit.jupiter.api.condition.OS;
+import org.junit.jupiter.api.parallel.Execution;
+import org.junit.jupiter.api.parallel.ExecutionMode;
+
+import static de.tum.in.net.ixy.BuildConfig.MEMORY_MANAGER;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_VARHANDLE;
+
+import static org.assertj.core.api.Assertions.assertThat;
+
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Compares the cost of extracting and inserting packet buffers from the different kinds of {@link Mempool memory
+ * pools}.
+ * <p>
+ * Every operation extracts a batch of packet buffers and inserts it back, the way the RX and TX batches of a driver
+ * do. The single-threaded memory pools are measured using both the packet buffer wrappers and their virtual
+ * addresses, and the concurrent memory pools are measured with and without per-thread caches.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@EnabledOnOs(OS.LINUX)
+@DisplayName("Mempool benchmark")
+@Execution(ExecutionMode.SAME_THREAD)
+final class MempoolBenchmarkTest {
+
+	/** The number of packet buffers of the memory pools. */
+	private static final int CAPACITY = 512;
+
+	/** The size of every packet buffer. */
+	private static final int ENTRY_SIZE = 2048;
+
+	/** The number of packet buffers extracted and inserted by every operation. */
+	private static final int BATCH = 32;
+
+	/** The number of operations of every round. */
+	private static final int ITERATIONS = 100_000;
+
+	/** The number of rounds run before measuring, which give the JIT compiler time to compile the loops. */
+	private static final int WARMUP_ROUNDS = 10;
+
+	/** The number of measured rounds. */
+	private static final int ROUNDS = 10;
+
+	/** The memory manager. */
+	@SuppressWarnings("NestedConditionalExpression")
+	private static final MemoryManager mmanager = MEMORY_MANAGER == PREFER_JNI_FULL
+			? JniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_JNI
+			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
+			: SmartUnsafeMemoryManager.getSingleton();
+
+	/** The allocated region. */
+	private long virtual;
+
+	// Allocates the memory region shared by the memory pools of every test
+	@BeforeEach
+	void setUp() {
+		virtual = mmanager.allocate(CAPACITY * ENTRY_SIZE, false, false);
+	}
+
+	// Releases the memory allocated by setUp()
+	@AfterEach
+	void tearDown() {
+		if (virtual != 0) mmanager.free(virtual, CAPACITY * ENTRY_SIZE, false, false);
+	}
+
+	@Test
+	@DisplayName("pop(long[], int) && push(long[], int) vs pop(PacketBufferWrapper[]) && push(PacketBufferWrapper)")
+	void singleThreaded(final TestReporter reporter) {
+		assumeTrue(virtual != 0);
+		val mempool = new Mempool(CAPACITY);
+		mempool.allocate(ENTRY_SIZE, new DmaMemory(virtual, 0));
+
+		val addresses = new long[BATCH];
+		for (var i = 0; i < WARMUP_ROUNDS; i += 1) assertThat(addresses(mempool, addresses)).isEqualTo(expected());
+		var start = System.nanoTime();
+		for (var i = 0; i < ROUNDS; i += 1) assertThat(addresses(mempool, addresses)).isEqualTo(expected());
+		reporter.publishEntry("Mempool.pop(long[], int)/push(long[], int)", perOperation(System.nanoTime() - start));
+
+		val buffers = new PacketBufferWrapper[BATCH];
+		for (var i = 0; i < WARMUP_ROUNDS; i += 1) assertThat(wrappers(mempool, buffers)).isEqualTo(expected());
+		start = System.nanoTime();
+		for (var i = 0; i < ROUNDS; i += 1) assertThat(wrappers(mempool, buffers)).isEqualTo(expected());
+		reporter.publishEntry("Mempool.pop(PacketBufferWrapper[])/push(PacketBufferWrapper)",
+				perOperation(System.nanoTime() - start));
+		assertThat(mempool.size()).isEqualTo(CAPACITY);
+	}
+
+	@Test
+	@DisplayName("Concurrent memory pools with and without per-thread caches")
+	void concurrent(final TestReporter reporter) {
+		assumeTrue(virtual != 0);
+		for (val cacheSize : new int[] {0, BATCH}) {
+			val mempool = new Mempool(CAPACITY, cacheSize);
+			mempool.allocate(ENTRY_SIZE, new DmaMemory(virtual, 0));
+			val buffers = new PacketBufferWrapper[BATCH];
+			for (var i = 0; i < WARMUP_ROUNDS; i += 1) assertThat(wrappers(mempool, buffers)).isEqualTo(expected());
+			val start = System.nanoTime();
+			for (var i = 0; i < ROUNDS; i += 1) assertThat(wrappers(mempool, buffers)).isEqualTo(expected());
+			val elapsed = System.nanoTime() - start;
+			mempool.flush();
+			assertThat(mempool.size()).isEqualTo(CAPACITY);
+			reporter.publishEntry(String.format("Mempool(%d, %d).pop(PacketBufferWrapper[])/push(PacketBufferWrapper)",
+					CAPACITY, cacheSize), perOperation(elapsed));
+		}
+	}
+
+	/**
+	 * Extracts and inserts back batches of virtual addresses {@link #ITERATIONS} times.
+	 *
+	 * @param mempool   The memory pool.
+	 * @param addresses The array that holds the virtual addresses of a batch.
+	 * @return The number of packet buffers extracted.
+	 */
+	private static long addresses(final @NotNull Mempool mempool, final @NotNull long[] addresses) {
+		var sum = 0L;
+		for (var i = 0; i < ITERATIONS; i += 1) {
+			val count = mempool.pop(addresses, BATCH);
+			mempool.push(addresses, count);
+			sum += count;
+		}
+		return sum;
+	}
+
+	/**
+	 * Extracts and inserts back batches of packet buffer wrappers {@link #ITERATIONS} times.
+	 *
+	 * @param mempool The memory pool.
+	 * @param buffers The array that holds the packet buffer wrappers of a batch.
+	 * @return The number of packet buffers extracted.
+	 */
+	private static long wrappers(final @NotNull Mempool mempool, final @NotNull PacketBufferWrapper[] buffers) {
+		var sum = 0L;
+		for (var i = 0; i < ITERATIONS; i += 1) {
+			val count = mempool.pop(buffers);
+			for (var j = 0; j < count; j += 1) {
+				mempool.push(buffers[j]);
+				buffers[j] = null;
+			}
+			sum += count;
+		}
+		return sum;
+	}
+
+	/**
+	 * Computes the number of packet buffers a round extracts.
+	 *
+	 * @return The number of packet buffers.
+	 */
+	private static long expected() {
+		return (long) ITERATIONS * BATCH;
+	}
+
+	/**
+	 * Formats the average cost of a single batch of the measured rounds.
+	 *
+	 * @param elapsed The nanoseconds the measured rounds took.
+	 * @return The formatted cost.
+	 */
+	private static @NotNull String perOperation(final long elapsed) {
+		return String.format("%.2f ns/batch", (double) elapsed / ((double) ROUNDS * ITERATIONS));
+	}
+
+}
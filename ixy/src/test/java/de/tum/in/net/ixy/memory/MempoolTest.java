@@ -0,0 +1,214 @@
+package de.tum.in.net.ixy.memory;
+
+import java.lang.management.ManagementFactory;
+import java.util.HashSet;
+
+import lombok.val;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.parallel.Execution;
+import org.junit.jupiter.api.parallel.ExecutionMode;
+
+import static de.tum.in.net.ixy.BuildConfig.DEBUG;
+import static de.tum.in.net.ixy.BuildConfig.LOG_TRACE;
+import static de.tum.in.net.ixy.BuildConfig.MEMORY_MANAGER;
+import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_VARHANDLE;
+
+import static org.assertj.core.api.Assertions.assertThat;
+import static org.assertj.core.api.Assertions.assertThatExceptionOfType;
+
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Tests the class {@link Mempool}.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@DisplayName("Mempool")
+@Execution(ExecutionMode.SAME_THREAD)
+final class MempoolTest {
+
+	/** The number of packet buffers of the memory pool. */
+	private static final int CAPACITY = 64;
+
+	/** The size of every packet buffer. */
+	private static final int ENTRY_SIZE = 2048;
+
+	/** The number of iterations used to measure the allocations. */
+	private static final int ITERATIONS = 100_000;
+
+	/** The number of threads used to stress a concurrent memory pool. */
+	private static final int THREADS = 4;
+
+	/** The number of packet buffers every thread extracts at once from a concurrent memory pool. */
+	private static final int BATCH = 8;
+
+	/** The memory manager. */
+	@SuppressWarnings("NestedConditionalExpression")
+	private static final MemoryManager mmanager = MEMORY_MANAGER == PREFER_JNI_FULL
+			? JniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_JNI
+			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
+			: SmartUnsafeMemoryManager.getSingleton();
+
+	/** The allocated region. */
+	private long virtual;
+
+	/** The memory pool. */
+	private Mempool mempool;
+
+	// Allocates the memory region and the memory pool that uses it
+	@BeforeEach
+	void setUp() {
+		virtual = mmanager.allocate(CAPACITY * ENTRY_SIZE, false, false);
+		mempool = new Mempool(CAPACITY);
+		if (virtual != 0) mempool.allocate(ENTRY_SIZE, new DmaMemory(virtual, 0));
+	}
+
+	// Releases the memory allocated by setUp()
+	@AfterEach
+	void tearDown() {
+		if (virtual != 0) mmanager.free(virtual, CAPACITY * ENTRY_SIZE, false, false);
+	}
+
+	@Test
+	@DisplayName("Wrong arguments produce exceptions")
+	void exceptions() {
+		assumeTrue(!OPTIMIZED);
+		assertThat(virtual).isNotZero();
+		assertThatExceptionOfType(IllegalStateException.class).isThrownBy(() -> new Mempool(1).wrap(virtual));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> mempool.wrap(virtual - 1));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> mempool.wrap(virtual + 1));
+		assertThatExceptionOfType(IllegalArgumentException.class)
+				.isThrownBy(() -> mempool.wrap(virtual + CAPACITY * ENTRY_SIZE));
+	}
+
+	@Test
+	@DisplayName("reserve(int) && release(int)")
+	void reserveRelease() {
+		mempool.reserve(CAPACITY / 2);
+		mempool.reserve(CAPACITY / 2);
+		assertThat(mempool.getReserved()).isEqualTo(CAPACITY);
+		assertThatExceptionOfType(IllegalStateException.class).isThrownBy(() -> mempool.reserve(1));
+		mempool.release(CAPACITY / 2);
+		assertThat(mempool.getReserved()).isEqualTo(CAPACITY / 2);
+		mempool.reserve(1);
+		assertThat(mempool.getReserved()).isEqualTo(CAPACITY / 2 + 1);
+	}
+
+	@Test
+	@DisplayName("getCacheSize()")
+	void getCacheSize() {
+		assertThat(mempool.getCacheSize()).isZero();
+		assertThat(new Mempool(CAPACITY, BATCH).getCacheSize()).isEqualTo(BATCH);
+	}
+
+	@Test
+	@DisplayName("wrap(long)")
+	void wrap() {
+		assertThat(virtual).isNotZero();
+		PacketBufferWrapper buffer;
+		while ((buffer = mempool.pop()) != null) {
+			assertThat(mempool.wrap(buffer.getVirtualAddress())).isSameAs(buffer);
+		}
+	}
+
+	@Test
+	@DisplayName("find(PacketBufferWrapper)")
+	void find() {
+		assertThat(virtual).isNotZero();
+		assertThat(mempool.getId()).isNotNegative();
+		PacketBufferWrapper buffer;
+		while ((buffer = mempool.pop()) != null) {
+			assertThat(Mempool.find(buffer)).isSameAs(mempool);
+		}
+	}
+
+	@Test
+	@DisplayName("pop(long[], int) && push(long[], int)")
+	void popPushAddresses() {
+		assertThat(virtual).isNotZero();
+		val addresses = new long[CAPACITY];
+		assertThat(mempool.pop(addresses, CAPACITY)).isEqualTo(CAPACITY);
+		assertThat(mempool.size()).isZero();
+		assertThat(mempool.pop()).isNull();
+		assertThat(addresses).doesNotHaveDuplicates().allMatch(address -> (address - virtual) % ENTRY_SIZE == 0);
+		assertThat(mempool.push(addresses, CAPACITY)).isEqualTo(CAPACITY);
+		assertThat(mempool.size()).isEqualTo(CAPACITY);
+		assertThat(mempool.wrap(mempool.pop().getVirtualAddress())).isNotNull();
+	}
+
+	@Test
+	@DisplayName("pop() && wrap(long) && push(PacketBufferWrapper) do not allocate")
+	void allocationFree() {
+		assumeTrue(DEBUG < LOG_TRACE);
+		assertThat(virtual).isNotZero();
+		val threads = (com.sun.management.ThreadMXBean) ManagementFactory.getThreadMXBean();
+		assumeTrue(threads.isThreadAllocatedMemorySupported());
+		threads.setThreadAllocatedMemoryEnabled(true);
+		val thread = Thread.currentThread().getId();
+
+		// Warm up the code paths, then measure the same loop
+		cycle();
+		val start = threads.getThreadAllocatedBytes(thread);
+		cycle();
+		val end = threads.getThreadAllocatedBytes(thread);
+
+		// A single allocation per iteration would take way more than one byte per iteration
+		assertThat(end - start).isLessThan(ITERATIONS);
+	}
+
+	@Test
+	@DisplayName("A concurrent memory pool does not lose nor duplicate packet buffers")
+	void concurrent() throws InterruptedException {
+		assertThat(virtual).isNotZero();
+		for (val cacheSize : new int[] {0, BATCH / 2}) {
+			val pool = new Mempool(CAPACITY, cacheSize);
+			pool.allocate(ENTRY_SIZE, new DmaMemory(virtual, 0));
+
+			// Make every thread extract and insert packet buffers as fast as possible
+			val threads = new Thread[THREADS];
+			for (var i = 0; i < THREADS; i += 1) {
+				threads[i] = new Thread(() -> {
+					val buffers = new PacketBufferWrapper[BATCH];
+					for (var j = 0; j < ITERATIONS; j += 1) {
+						val count = pool.pop(buffers);
+						for (var k = 0; k < count; k += 1) {
+							pool.push(buffers[k]);
+							buffers[k] = null;
+						}
+					}
+					pool.flush();
+				});
+				threads[i].start();
+			}
+			for (val thread : threads) thread.join();
+
+			// Every packet buffer must be inside the memory pool exactly once
+			val seen = new HashSet<Long>();
+			PacketBufferWrapper buffer;
+			while ((buffer = pool.pop()) != null) {
+				assertThat(seen.add(buffer.getVirtualAddress())).as("Duplicated packet buffer").isTrue();
+			}
+			assertThat(seen).as("Lost packet buffers").hasSize(CAPACITY);
+		}
+	}
+
+	/** Simulates the receiving path of a driver {@link #ITERATIONS} times. */
+	private void cycle() {
+		for (var i = 0; i < ITERATIONS; i += 1) {
+			val buffer = mempool.pop();
+			val wrapped = mempool.wrap(buffer.getVirtualAddress());
+			mempool.push(wrapped);
+		}
+	}
+
+}
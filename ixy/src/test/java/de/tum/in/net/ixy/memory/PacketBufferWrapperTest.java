@@ -6,6 +6,8 @@ import java.util.Random;
 
 import lombok.val;
 
+import org.assertj.core.api.SoftAssertions;
+
 import org.jetbrains.annotations.Contract;
 
 import org.junit.jupiter.api.AfterEach;
@@ -19,6 +21,7 @@ import static de.tum.in.net.ixy.BuildConfig.MEMORY_MANAGER;
 import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
 import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI;
 import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_VARHANDLE;
 
 import static org.assertj.core.api.Assertions.assertThat;
 import static org.assertj.core.api.Assertions.assertThatExceptionOfType;
@@ -49,6 +52,8 @@ final class PacketBufferWrapperTest {
 			? JniMemoryManager.getSingleton()
 			: MEMORY_MANAGER == PREFER_JNI
 			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
 			: SmartUnsafeMemoryManager.getSingleton();
 
 	// Generates a random virtual address and creates the packet buffer instance using the mocked memory manager
@@ -194,6 +199,120 @@ final class PacketBufferWrapperTest {
 		}
 	}
 
+	@Test
+	@DisplayName("The offload flags can be read")
+	void getOffload() {
+		assume();
+		val offset = PacketBufferWrapperConstants.HEADER_OFFSET + PacketBufferWrapperConstants.OFL_OFFSET;
+		for (val virtual : virtuals) {
+			assertThat(virtual).isNotZero();
+			val offload = random.nextInt();
+			mmanager.putIntVolatile(virtual + offset, offload);
+			val packet = new PacketBufferWrapper(virtual);
+			assertThat(packet.getOffload()).as("Offload flags").isEqualTo(offload);
+		}
+	}
+
+	@Test
+	@DisplayName("The offload flags can be written without modifying the size")
+	void setOffload() {
+		assume();
+		val offset = PacketBufferWrapperConstants.HEADER_OFFSET + PacketBufferWrapperConstants.OFL_OFFSET;
+		for (val virtual : virtuals) {
+			assertThat(virtual).isNotZero();
+			val packet = new PacketBufferWrapper(virtual);
+			val size = random.nextInt();
+			val offload = random.nextInt();
+			packet.setSize(size);
+			packet.setOffload(offload);
+			assertThat(mmanager.getIntVolatile(virtual + offset)).as("Offload flags").isEqualTo(offload);
+			assertThat(packet.getSize()).as("Packet size").isEqualTo(size);
+		}
+	}
+
+	@Test
+	@DisplayName("The RX flags, RSS hash and VLAN tag can be written and read without modifying the size")
+	void rxMetadata() {
+		assume();
+		val base = PacketBufferWrapperConstants.HEADER_OFFSET;
+		for (val virtual : virtuals) {
+			assertThat(virtual).isNotZero();
+			val packet = new PacketBufferWrapper(virtual);
+			val size = random.nextInt();
+			val flags = random.nextInt();
+			val hash = random.nextInt();
+			val tag = (short) random.nextInt();
+			packet.setSize(size);
+			packet.setRxFlags(flags);
+			packet.setRssHash(hash);
+			packet.setVlanTag(tag);
+			val softly = new SoftAssertions();
+			softly.assertThat(mmanager.getIntVolatile(virtual + base + PacketBufferWrapperConstants.RXF_OFFSET))
+					.as("RX flags").isEqualTo(flags);
+			softly.assertThat(mmanager.getIntVolatile(virtual + base + PacketBufferWrapperConstants.RSS_OFFSET))
+					.as("RSS hash").isEqualTo(hash);
+			softly.assertThat(mmanager.getShortVolatile(virtual + base + PacketBufferWrapperConstants.VLN_OFFSET))
+					.as("VLAN tag").isEqualTo(tag);
+			softly.assertThat(packet.getRxFlags()).as("RX flags").isEqualTo(flags);
+			softly.assertThat(packet.getRssHash()).as("RSS hash").isEqualTo(hash);
+			softly.assertThat(packet.getVlanTag()).as("VLAN tag").isEqualTo(tag);
+			softly.assertThat(packet.getSize()).as("Packet size").isEqualTo(size);
+			softly.assertAll();
+		}
+	}
+
+	@Test
+	@DisplayName("The segments, MSS and next segment pointer can be written and read without modifying the metadata")
+	void chain() {
+		assume();
+		val base = PacketBufferWrapperConstants.HEADER_OFFSET;
+		for (val virtual : virtuals) {
+			assertThat(virtual).isNotZero();
+			val packet = new PacketBufferWrapper(virtual);
+			val tag = (short) random.nextInt();
+			val segments = random.nextInt(0xFFFF + 1);
+			val mss = random.nextInt(0xFFFF + 1);
+			val next = random.nextLong();
+			packet.setVlanTag(tag);
+			packet.setSegments(segments);
+			packet.setMss(mss);
+			packet.setNext(next);
+			val softly = new SoftAssertions();
+			softly.assertThat(mmanager.getShortVolatile(virtual + base + PacketBufferWrapperConstants.SEG_OFFSET))
+					.as("Segments").isEqualTo((short) segments);
+			softly.assertThat(mmanager.getShortVolatile(virtual + base + PacketBufferWrapperConstants.MSS_OFFSET))
+					.as("MSS").isEqualTo((short) mss);
+			softly.assertThat(mmanager.getLongVolatile(virtual + base + PacketBufferWrapperConstants.NXT_OFFSET))
+					.as("Next segment").isEqualTo(next);
+			softly.assertThat(packet.getSegments()).as("Segments").isEqualTo(segments);
+			softly.assertThat(packet.getMss()).as("MSS").isEqualTo(mss);
+			softly.assertThat(packet.getNext()).as("Next segment").isEqualTo(next);
+			softly.assertThat(packet.getVlanTag()).as("VLAN tag").isEqualTo(tag);
+			softly.assertAll();
+		}
+	}
+
+	@Test
+	@DisplayName("The offload flags are packed")
+	void offload() {
+		val l2 = random.nextInt(PacketBufferWrapperConstants.OFL_L2_LENGTH_MASK + 1);
+		val l3 = random.nextInt(PacketBufferWrapperConstants.OFL_L3_LENGTH_MASK + 1);
+		val l4 = random.nextInt(PacketBufferWrapperConstants.OFL_L4_LENGTH_MASK + 1);
+		val flags = PacketBufferWrapperConstants.OFL_IP_CHECKSUM | PacketBufferWrapperConstants.OFL_TCP_CHECKSUM;
+		val offload = PacketBufferWrapper.offload(l2, l3, l4, flags);
+		assertThat(offload & 0xFFFF).as("MAC and IP lengths").isEqualTo(l2 << 9 | l3);
+		assertThat((offload >>> 16) & 0xFF).as("L4 length").isEqualTo(l4);
+		assertThat(offload & 0xFF000000).as("Flags").isEqualTo(flags);
+		if (!OPTIMIZED) {
+			assertThatExceptionOfType(IllegalArgumentException.class)
+					.isThrownBy(() -> PacketBufferWrapper.offload(128, 0, 0, 0));
+			assertThatExceptionOfType(IllegalArgumentException.class)
+					.isThrownBy(() -> PacketBufferWrapper.offload(0, 512, 0, 0));
+			assertThatExceptionOfType(IllegalArgumentException.class)
+					.isThrownBy(() -> PacketBufferWrapper.offload(0, 0, 256, 0));
+		}
+	}
+
 	@Test
 	@DisplayName("A byte can be read")
 	void getByte() {
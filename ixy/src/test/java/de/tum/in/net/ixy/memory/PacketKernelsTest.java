@@ -0,0 +1,193 @@
+package de.tum.in.net.ixy.memory;
+
+import java.security.SecureRandom;
+import java.util.Random;
+
+import lombok.val;
+
+import org.assertj.core.api.SoftAssertions;
+
+import org.jetbrains.annotations.Contract;
+import org.jetbrains.annotations.NotNull;
+
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.parallel.Execution;
+import org.junit.jupiter.api.parallel.ExecutionMode;
+
+import static de.tum.in.net.ixy.BuildConfig.MEMORY_MANAGER;
+import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_VARHANDLE;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.PAYLOAD_OFFSET;
+import static de.tum.in.net.ixy.memory.PacketBufferWrapperConstants.PKT_OFFSET;
+
+import static org.assertj.core.api.Assertions.assertThat;
+import static org.assertj.core.api.Assertions.assertThatExceptionOfType;
+
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Tests the class {@link PacketKernels}.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@DisplayName("PacketKernels")
+@Execution(ExecutionMode.CONCURRENT)
+final class PacketKernelsTest {
+
+	/** The number of packet buffers of every batch. */
+	private static final int COUNT = 16;
+
+	/** The size of the payload of every packet buffer. */
+	private static final int PAYLOAD_SIZE = 256;
+
+	/** The distance between two packet buffers. */
+	private static final int STRIDE = PAYLOAD_OFFSET + PAYLOAD_SIZE;
+
+	/** A cached instance of a pseudo-random number generator. */
+	private static final Random random = new SecureRandom();
+
+	/** The memory manager. */
+	@SuppressWarnings("NestedConditionalExpression")
+	private static final MemoryManager mmanager = MEMORY_MANAGER == PREFER_JNI_FULL
+			? JniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_JNI
+			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
+			: SmartUnsafeMemoryManager.getSingleton();
+
+	@Test
+	@DisplayName("getKernel()")
+	void getKernel() {
+		assertThat(PacketKernels.getKernel()).isIn("avx2", "sse2", "scalar", "java");
+	}
+
+	@Test
+	@DisplayName("Wrong arguments produce exceptions")
+	void exceptions() {
+		assumeTrue(!OPTIMIZED);
+		val addresses = new long[1];
+		val data = new byte[Integer.BYTES];
+		assertThatExceptionOfType(NullPointerException.class).isThrownBy(() -> PacketKernels.fill(null, 0, 0, 0, (byte) 0));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> PacketKernels.fill(addresses, 2, 0, 0, (byte) 0));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> PacketKernels.fill(addresses, 1, -1, 0, (byte) 0));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> PacketKernels.fill(addresses, 1, 0, -1, (byte) 0));
+		assertThatExceptionOfType(NullPointerException.class).isThrownBy(() -> PacketKernels.copy(addresses, 1, 0, null, 0));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> PacketKernels.copy(addresses, -1, 0, data, 0));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> PacketKernels.copy(addresses, 1, 0, data, 5));
+		assertThatExceptionOfType(NullPointerException.class).isThrownBy(() -> PacketKernels.patch(addresses, 1, null, 4, 0, 0));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> PacketKernels.patch(addresses, 1, data, 0, 0, 0));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> PacketKernels.patch(addresses, 1, data, 4, 1, 0));
+	}
+
+	@Test
+	@DisplayName("fill(long[], int, int, int, byte)")
+	void fill() {
+		val base = assumeAllocate();
+		val addresses = addresses(base);
+		val offset = random.nextInt(PAYLOAD_SIZE / 2);
+		val bytes = random.nextInt(PAYLOAD_SIZE - offset);
+		val value = (byte) random.nextInt();
+		PacketKernels.fill(addresses, COUNT, offset, bytes, value);
+
+		val softly = new SoftAssertions();
+		for (val address : addresses) {
+			val payload = payload(address);
+			for (var i = 0; i < PAYLOAD_SIZE; i += 1) {
+				softly.assertThat(payload[i]).isEqualTo(i >= offset && i < offset + bytes ? value : 0);
+			}
+		}
+		mmanager.free(base, (long) COUNT * STRIDE, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("copy(long[], int, int, byte[], int)")
+	void copy() {
+		val base = assumeAllocate();
+		val addresses = addresses(base);
+		val offset = random.nextInt(PAYLOAD_SIZE / 2);
+		val data = new byte[random.nextInt(PAYLOAD_SIZE - offset) + 1];
+		random.nextBytes(data);
+		PacketKernels.copy(addresses, COUNT, offset, data, data.length);
+
+		val softly = new SoftAssertions();
+		for (val address : addresses) {
+			val payload = payload(address);
+			for (var i = 0; i < PAYLOAD_SIZE; i += 1) {
+				softly.assertThat(payload[i]).isEqualTo(i >= offset && i < offset + data.length ? data[i - offset] : 0);
+			}
+		}
+		mmanager.free(base, (long) COUNT * STRIDE, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("patch(long[], int, byte[], int, int, int)")
+	void patch() {
+		val base = assumeAllocate();
+		val addresses = addresses(base);
+		val template = new byte[random.nextInt(PAYLOAD_SIZE - Integer.BYTES) + Integer.BYTES];
+		random.nextBytes(template);
+		val field = random.nextInt(template.length - Integer.BYTES + 1);
+		val start = random.nextInt();
+		assertThat(PacketKernels.patch(addresses, COUNT, template, template.length, field, start))
+				.isEqualTo(start + COUNT);
+
+		val softly = new SoftAssertions();
+		for (var i = 0; i < COUNT; i += 1) {
+			val address = addresses[i];
+			softly.assertThat(mmanager.getInt(address + PKT_OFFSET)).isEqualTo(template.length);
+			softly.assertThat(mmanager.getInt(address + PAYLOAD_OFFSET + field)).isEqualTo(start + i);
+			val payload = payload(address);
+			for (var j = 0; j < template.length; j += 1) {
+				if (j < field || j >= field + Integer.BYTES) softly.assertThat(payload[j]).isEqualTo(template[j]);
+			}
+		}
+		mmanager.free(base, (long) COUNT * STRIDE, false, false);
+		softly.assertAll();
+	}
+
+	/**
+	 * Allocates zeroed memory for a batch of packet buffers or skips the test.
+	 *
+	 * @return The base address of the memory region.
+	 */
+	private static long assumeAllocate() {
+		val size = COUNT * STRIDE;
+		val base = mmanager.allocate(size, false, false);
+		assumeTrue(base != 0);
+		mmanager.put(base, size, new byte[size], 0);
+		return base;
+	}
+
+	/**
+	 * Computes the virtual addresses of the packet buffers of a batch.
+	 *
+	 * @param base The base address of the memory region.
+	 * @return The virtual addresses.
+	 */
+	@Contract(value = "_ -> new", pure = true)
+	private static @NotNull long[] addresses(final long base) {
+		val addresses = new long[COUNT];
+		for (var i = 0; i < COUNT; i += 1) addresses[i] = base + (long) i * STRIDE;
+		return addresses;
+	}
+
+	/**
+	 * Reads the payload of a packet buffer.
+	 *
+	 * @param address The virtual address of the packet buffer.
+	 * @return The payload.
+	 */
+	@Contract(value = "_ -> new", pure = true)
+	private static @NotNull byte[] payload(final long address) {
+		val payload = new byte[PAYLOAD_SIZE];
+		mmanager.get(address + PAYLOAD_OFFSET, PAYLOAD_SIZE, payload, 0);
+		return payload;
+	}
+
+}
@@ -5,6 +5,7 @@ import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.io.RandomAccessFile;
 import java.lang.reflect.Field;
+import java.nio.ByteBuffer;
 import java.nio.file.Files;
 import java.nio.file.Path;
 import java.nio.file.Paths;
@@ -305,6 +306,174 @@ final class SmartJniMemoryManagerTest {
 		softly.assertAll();
 	}
 
+	@Test
+	@DisplayName("getByteOpaque(long) && putByteOpaque(long, byte)")
+	void getByteOpaque_putByteOpaque() {
+		val address = assumeAllocate(Byte.BYTES);
+		val delta = (byte) (1 + random.nextInt(Byte.MAX_VALUE));
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getByteOpaque(address);
+		mmanager.putByteOpaque(address, delta);
+		softly.assertThat(mmanager.getByteOpaque(address)).isEqualTo(delta);
+		mmanager.putByteOpaque(address, (byte) (value + delta));
+		softly.assertThat(mmanager.getByteOpaque(address)).isEqualTo((byte) (value + delta));
+		mmanager.putByteOpaque(address, value);
+		softly.assertThat(mmanager.getByteOpaque(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Byte.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getShortOpaque(long) && putShortOpaque(long, short)")
+	void getShortOpaque_putShortOpaque() {
+		val address = assumeAllocate(Short.BYTES);
+		val delta = (short) (1 + random.nextInt(Short.MAX_VALUE));
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getShortOpaque(address);
+		mmanager.putShortOpaque(address, delta);
+		softly.assertThat(mmanager.getShortOpaque(address)).isEqualTo(delta);
+		mmanager.putShortOpaque(address, (short) (value + delta));
+		softly.assertThat(mmanager.getShortOpaque(address)).isEqualTo((short) (value + delta));
+		mmanager.putShortOpaque(address, value);
+		softly.assertThat(mmanager.getShortOpaque(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Short.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getIntOpaque(long) && putIntOpaque(long, int)")
+	void getIntOpaque_putIntOpaque() {
+		val address = assumeAllocate(Integer.BYTES);
+		val delta = 1 + random.nextInt(Integer.MAX_VALUE);
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getIntOpaque(address);
+		mmanager.putIntOpaque(address, delta);
+		softly.assertThat(mmanager.getIntOpaque(address)).isEqualTo(delta);
+		mmanager.putIntOpaque(address, value + delta);
+		softly.assertThat(mmanager.getIntOpaque(address)).isEqualTo(value + delta);
+		mmanager.putIntOpaque(address, value);
+		softly.assertThat(mmanager.getIntOpaque(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Integer.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getLongOpaque(long) && putLongOpaque(long, long)")
+	void getLongOpaque_putLongOpaque() {
+		val address = assumeAllocate(Long.BYTES);
+		val delta = 1 + (random.nextLong() & Long.MAX_VALUE);
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getLongOpaque(address);
+		mmanager.putLongOpaque(address, delta);
+		softly.assertThat(mmanager.getLongOpaque(address)).isEqualTo(delta);
+		mmanager.putLongOpaque(address, value + delta);
+		softly.assertThat(mmanager.getLongOpaque(address)).isEqualTo(value + delta);
+		mmanager.putLongOpaque(address, value);
+		softly.assertThat(mmanager.getLongOpaque(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Long.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getByteAcquire(long) && putByteRelease(long, byte)")
+	void getByteAcquire_putByteRelease() {
+		val address = assumeAllocate(Byte.BYTES);
+		val delta = (byte) (1 + random.nextInt(Byte.MAX_VALUE));
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getByteAcquire(address);
+		mmanager.putByteRelease(address, delta);
+		softly.assertThat(mmanager.getByteAcquire(address)).isEqualTo(delta);
+		mmanager.putByteRelease(address, (byte) (value + delta));
+		softly.assertThat(mmanager.getByteAcquire(address)).isEqualTo((byte) (value + delta));
+		mmanager.putByteRelease(address, value);
+		softly.assertThat(mmanager.getByteAcquire(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Byte.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getShortAcquire(long) && putShortRelease(long, short)")
+	void getShortAcquire_putShortRelease() {
+		val address = assumeAllocate(Short.BYTES);
+		val delta = (short) (1 + random.nextInt(Short.MAX_VALUE));
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getShortAcquire(address);
+		mmanager.putShortRelease(address, delta);
+		softly.assertThat(mmanager.getShortAcquire(address)).isEqualTo(delta);
+		mmanager.putShortRelease(address, (short) (value + delta));
+		softly.assertThat(mmanager.getShortAcquire(address)).isEqualTo((short) (value + delta));
+		mmanager.putShortRelease(address, value);
+		softly.assertThat(mmanager.getShortAcquire(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Short.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getIntAcquire(long) && putIntRelease(long, int)")
+	void getIntAcquire_putIntRelease() {
+		val address = assumeAllocate(Integer.BYTES);
+		val delta = 1 + random.nextInt(Integer.MAX_VALUE);
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getIntAcquire(address);
+		mmanager.putIntRelease(address, delta);
+		softly.assertThat(mmanager.getIntAcquire(address)).isEqualTo(delta);
+		mmanager.putIntRelease(address, value + delta);
+		softly.assertThat(mmanager.getIntAcquire(address)).isEqualTo(value + delta);
+		mmanager.putIntRelease(address, value);
+		softly.assertThat(mmanager.getIntAcquire(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Integer.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getLongAcquire(long) && putLongRelease(long, long)")
+	void getLongAcquire_putLongRelease() {
+		val address = assumeAllocate(Long.BYTES);
+		val delta = 1 + (random.nextLong() & Long.MAX_VALUE);
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getLongAcquire(address);
+		mmanager.putLongRelease(address, delta);
+		softly.assertThat(mmanager.getLongAcquire(address)).isEqualTo(delta);
+		mmanager.putLongRelease(address, value + delta);
+		softly.assertThat(mmanager.getLongAcquire(address)).isEqualTo(value + delta);
+		mmanager.putLongRelease(address, value);
+		softly.assertThat(mmanager.getLongAcquire(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Long.BYTES, false, false);
+		softly.assertAll();
+	}
+
 	@Test
 	@DisplayName("get(long, int, byte[], int) && put(long, int, byte[], int)")
 	void get_put() {
@@ -349,6 +518,37 @@ final class SmartJniMemoryManagerTest {
 		softly.assertAll();
 	}
 
+	@Test
+	@DisplayName("get(long, int, ByteBuffer) && put(long, int, ByteBuffer)")
+	void get_put_buffer() {
+		val size = (int) createSize(0xFF);
+		val data = new byte[size];
+		random.nextBytes(data);
+		val address = assumeAllocate(size);
+
+		// Copy the data from and to both heap and direct buffers and test the value
+		val softly = new SoftAssertions();
+		for (val buffer : new ByteBuffer[] {ByteBuffer.allocate(size), ByteBuffer.allocateDirect(size)}) {
+			mmanager.put(address, size, new byte[size], 0);
+			buffer.put(data).flip();
+			mmanager.put(address, size, buffer);
+			softly.assertThat(buffer.position()).isEqualTo(size);
+			val copy = new byte[size];
+			mmanager.get(address, size, copy, 0);
+			softly.assertThat(copy).isEqualTo(data);
+
+			buffer.clear();
+			mmanager.get(address, size, buffer);
+			softly.assertThat(buffer.position()).isEqualTo(size);
+			buffer.flip().get(copy);
+			softly.assertThat(copy).isEqualTo(data);
+		}
+
+		// Free the memory and test
+		mmanager.free(address, size, false, false);
+		softly.assertAll();
+	}
+
 	@Test
 	@DisplayName("virt2phys(long)")
 	void virt2phys() {
@@ -367,6 +567,26 @@ final class SmartJniMemoryManagerTest {
 		}
 	}
 
+	@Test
+	@DisplayName("virt2phys(long, long, int, boolean, long[])")
+	void virt2physBulk() {
+		assumeTrue(mmanager != null);
+		val step = 2048;
+		val count = 64;
+		for (val huge : Arrays.asList(false, true)) {
+			val virt = mmanager.allocate((long) step * count, huge, false);
+			for (var i = 0; i < count; i += 1) mmanager.putByte(virt + i * step, (byte) i);
+			val physical = new long[count];
+			mmanager.virt2phys(virt, step, count, huge, physical);
+			val softly = new SoftAssertions();
+			for (var i = 0; i < count; i += 1) {
+				softly.assertThat(physical[i]).isNotZero().isEqualTo(mmanager.virt2phys(virt + i * step));
+			}
+			mmanager.free(virt, (long) step * count, huge, false);
+			softly.assertAll();
+		}
+	}
+
 	@Test
 	@DisplayName("dmaAllocate(long, boolean, boolean)")
 	void dmaAllocate() {
@@ -5,6 +5,7 @@ import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.io.RandomAccessFile;
 import java.lang.reflect.Field;
+import java.nio.ByteBuffer;
 import java.nio.file.Files;
 import java.nio.file.Path;
 import java.nio.file.Paths;
@@ -108,6 +109,51 @@ final class SmartUnsafeMemoryManagerTest {
 		softly.assertAll();
 	}
 
+	@Test
+	@DisplayName("getHugepageSizes()")
+	void getHugepageSizes() {
+		assumeTrue(mmanager != null);
+		val sizes = mmanager.getHugepageSizes();
+		assertThat(sizes).isSorted().doesNotHaveDuplicates();
+		for (val size : sizes) {
+			assertThat(size).isPositive().withFailMessage("should be a power of two").isEqualTo(size & -size);
+		}
+	}
+
+	@Test
+	@DisplayName("allocate(long, long, boolean) && free(long, long, long, boolean)")
+	void allocate_free_pagesize() {
+		assumeTrue(mmanager != null);
+		val softly = new SoftAssertions();
+		for (val pagesize : mmanager.getHugepageSizes()) {
+			for (val lock : Arrays.asList(false, true)) {
+				val bytes = createSize(0xFFFF);
+				val address = mmanager.allocate(bytes, pagesize, lock);
+				softly.assertThat(address).isNotZero();
+				softly.assertThat(address % pagesize).isZero();
+				if (address != 0) mmanager.free(address, bytes, pagesize, lock);
+			}
+		}
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("allocate(long, long, boolean, int) && getNumaNode(long)")
+	void allocate_numa() {
+		assumeTrue(mmanager != null);
+		assumeTrue(Files.isDirectory(Paths.get("/sys/devices/system/node/node0")));
+		val sizes = mmanager.getHugepageSizes();
+		assumeTrue(sizes.length > 0);
+		val pagesize = sizes[0];
+		val address = mmanager.allocate(pagesize, pagesize, true, 0);
+		assertThat(address).isNotZero();
+		try {
+			assertThat(mmanager.getNumaNode(address)).isZero();
+		} finally {
+			mmanager.free(address, pagesize, pagesize, true);
+		}
+	}
+
 	@Test
 	@DisplayName("mmap(File, boolean, boolean)")
 	void mmap_munmap(@TempDir final Path dir) throws IOException {
@@ -303,6 +349,174 @@ final class SmartUnsafeMemoryManagerTest {
 		softly.assertAll();
 	}
 
+	@Test
+	@DisplayName("getByteOpaque(long) && putByteOpaque(long, byte)")
+	void getByteOpaque_putByteOpaque() {
+		val address = assumeAllocate(Byte.BYTES);
+		val delta = (byte) (1 + random.nextInt(Byte.MAX_VALUE));
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getByteOpaque(address);
+		mmanager.putByteOpaque(address, delta);
+		softly.assertThat(mmanager.getByteOpaque(address)).isEqualTo(delta);
+		mmanager.putByteOpaque(address, (byte) (value + delta));
+		softly.assertThat(mmanager.getByteOpaque(address)).isEqualTo((byte) (value + delta));
+		mmanager.putByteOpaque(address, value);
+		softly.assertThat(mmanager.getByteOpaque(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Byte.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getShortOpaque(long) && putShortOpaque(long, short)")
+	void getShortOpaque_putShortOpaque() {
+		val address = assumeAllocate(Short.BYTES);
+		val delta = (short) (1 + random.nextInt(Short.MAX_VALUE));
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getShortOpaque(address);
+		mmanager.putShortOpaque(address, delta);
+		softly.assertThat(mmanager.getShortOpaque(address)).isEqualTo(delta);
+		mmanager.putShortOpaque(address, (short) (value + delta));
+		softly.assertThat(mmanager.getShortOpaque(address)).isEqualTo((short) (value + delta));
+		mmanager.putShortOpaque(address, value);
+		softly.assertThat(mmanager.getShortOpaque(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Short.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getIntOpaque(long) && putIntOpaque(long, int)")
+	void getIntOpaque_putIntOpaque() {
+		val address = assumeAllocate(Integer.BYTES);
+		val delta = 1 + random.nextInt(Integer.MAX_VALUE);
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getIntOpaque(address);
+		mmanager.putIntOpaque(address, delta);
+		softly.assertThat(mmanager.getIntOpaque(address)).isEqualTo(delta);
+		mmanager.putIntOpaque(address, value + delta);
+		softly.assertThat(mmanager.getIntOpaque(address)).isEqualTo(value + delta);
+		mmanager.putIntOpaque(address, value);
+		softly.assertThat(mmanager.getIntOpaque(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Integer.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getLongOpaque(long) && putLongOpaque(long, long)")
+	void getLongOpaque_putLongOpaque() {
+		val address = assumeAllocate(Long.BYTES);
+		val delta = 1 + (random.nextLong() & Long.MAX_VALUE);
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getLongOpaque(address);
+		mmanager.putLongOpaque(address, delta);
+		softly.assertThat(mmanager.getLongOpaque(address)).isEqualTo(delta);
+		mmanager.putLongOpaque(address, value + delta);
+		softly.assertThat(mmanager.getLongOpaque(address)).isEqualTo(value + delta);
+		mmanager.putLongOpaque(address, value);
+		softly.assertThat(mmanager.getLongOpaque(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Long.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getByteAcquire(long) && putByteRelease(long, byte)")
+	void getByteAcquire_putByteRelease() {
+		val address = assumeAllocate(Byte.BYTES);
+		val delta = (byte) (1 + random.nextInt(Byte.MAX_VALUE));
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getByteAcquire(address);
+		mmanager.putByteRelease(address, delta);
+		softly.assertThat(mmanager.getByteAcquire(address)).isEqualTo(delta);
+		mmanager.putByteRelease(address, (byte) (value + delta));
+		softly.assertThat(mmanager.getByteAcquire(address)).isEqualTo((byte) (value + delta));
+		mmanager.putByteRelease(address, value);
+		softly.assertThat(mmanager.getByteAcquire(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Byte.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getShortAcquire(long) && putShortRelease(long, short)")
+	void getShortAcquire_putShortRelease() {
+		val address = assumeAllocate(Short.BYTES);
+		val delta = (short) (1 + random.nextInt(Short.MAX_VALUE));
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getShortAcquire(address);
+		mmanager.putShortRelease(address, delta);
+		softly.assertThat(mmanager.getShortAcquire(address)).isEqualTo(delta);
+		mmanager.putShortRelease(address, (short) (value + delta));
+		softly.assertThat(mmanager.getShortAcquire(address)).isEqualTo((short) (value + delta));
+		mmanager.putShortRelease(address, value);
+		softly.assertThat(mmanager.getShortAcquire(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Short.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getIntAcquire(long) && putIntRelease(long, int)")
+	void getIntAcquire_putIntRelease() {
+		val address = assumeAllocate(Integer.BYTES);
+		val delta = 1 + random.nextInt(Integer.MAX_VALUE);
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getIntAcquire(address);
+		mmanager.putIntRelease(address, delta);
+		softly.assertThat(mmanager.getIntAcquire(address)).isEqualTo(delta);
+		mmanager.putIntRelease(address, value + delta);
+		softly.assertThat(mmanager.getIntAcquire(address)).isEqualTo(value + delta);
+		mmanager.putIntRelease(address, value);
+		softly.assertThat(mmanager.getIntAcquire(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Integer.BYTES, false, false);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("getLongAcquire(long) && putLongRelease(long, long)")
+	void getLongAcquire_putLongRelease() {
+		val address = assumeAllocate(Long.BYTES);
+		val delta = 1 + (random.nextLong() & Long.MAX_VALUE);
+
+		// Overwrite the data several times and test the value
+		val softly = new SoftAssertions();
+		val value = mmanager.getLongAcquire(address);
+		mmanager.putLongRelease(address, delta);
+		softly.assertThat(mmanager.getLongAcquire(address)).isEqualTo(delta);
+		mmanager.putLongRelease(address, value + delta);
+		softly.assertThat(mmanager.getLongAcquire(address)).isEqualTo(value + delta);
+		mmanager.putLongRelease(address, value);
+		softly.assertThat(mmanager.getLongAcquire(address)).isEqualTo(value);
+
+		// Free the memory and test
+		mmanager.free(address, Long.BYTES, false, false);
+		softly.assertAll();
+	}
+
 	@Test
 	@DisplayName("get(long, int, byte[], int) && put(long, int, byte[], int)")
 	void get_put() {
@@ -347,6 +561,37 @@ final class SmartUnsafeMemoryManagerTest {
 		softly.assertAll();
 	}
 
+	@Test
+	@DisplayName("get(long, int, ByteBuffer) && put(long, int, ByteBuffer)")
+	void get_put_buffer() {
+		val size = (int) createSize(0xFF);
+		val data = new byte[size];
+		random.nextBytes(data);
+		val address = assumeAllocate(size);
+
+		// Copy the data from and to both heap and direct buffers and test the value
+		val softly = new SoftAssertions();
+		for (val buffer : new ByteBuffer[] {ByteBuffer.allocate(size), ByteBuffer.allocateDirect(size)}) {
+			mmanager.put(address, size, new byte[size], 0);
+			buffer.put(data).flip();
+			mmanager.put(address, size, buffer);
+			softly.assertThat(buffer.position()).isEqualTo(size);
+			val copy = new byte[size];
+			mmanager.get(address, size, copy, 0);
+			softly.assertThat(copy).isEqualTo(data);
+
+			buffer.clear();
+			mmanager.get(address, size, buffer);
+			softly.assertThat(buffer.position()).isEqualTo(size);
+			buffer.flip().get(copy);
+			softly.assertThat(copy).isEqualTo(data);
+		}
+
+		// Free the memory and test
+		mmanager.free(address, size, false, false);
+		softly.assertAll();
+	}
+
 	@Test
 	@DisplayName("virt2phys(long)")
 	void virt2phys() {
@@ -362,6 +607,26 @@ final class SmartUnsafeMemoryManagerTest {
 		softly.assertAll();
 	}
 
+	@Test
+	@DisplayName("virt2phys(long, long, int, boolean, long[])")
+	void virt2physBulk() {
+		assumeTrue(mmanager != null);
+		val step = 2048;
+		val count = 64;
+		for (val huge : Arrays.asList(false, true)) {
+			val virt = mmanager.allocate((long) step * count, huge, false);
+			for (var i = 0; i < count; i += 1) mmanager.putByte(virt + i * step, (byte) i);
+			val physical = new long[count];
+			mmanager.virt2phys(virt, step, count, huge, physical);
+			val softly = new SoftAssertions();
+			for (var i = 0; i < count; i += 1) {
+				softly.assertThat(physical[i]).isNotZero().isEqualTo(mmanager.virt2phys(virt + i * step));
+			}
+			mmanager.free(virt, (long) step * count, huge, false);
+			softly.assertAll();
+		}
+	}
+
 	@Test
 	@DisplayName("dmaAllocate(long, boolean, boolean)")
 	@SuppressWarnings({"CodeBlock2Expr", "ResultOfMethodCallIgnored"})
@@ -0,0 +1,101 @@
+package de.tum.in.net.ixy.memory;
+
+import lombok.val;
+
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.TestReporter;
+import org.junit.jupiter.api.condition.EnabledOnOs;
+import org.junit.jupiter.api.condition.OS;
+import org.junit.jupiter.api.parallel.Execution;
+import org.junit.jupiter.api.parallel.ExecutionMode;
+
+import static de.tum.in.net.ixy.BuildConfig.MEMORY_MANAGER;
+import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.BuildConfig.PREFER_VARHANDLE;
+
+import static org.assertj.core.api.Assertions.assertThat;
+import static org.assertj.core.api.Assertions.assertThatExceptionOfType;
+
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Tests the class {@link TlbCounter} and compares the data TLB misses of the available huge memory page sizes.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@EnabledOnOs(OS.LINUX)
+@DisplayName("TlbCounter")
+@Execution(ExecutionMode.SAME_THREAD)
+final class TlbCounterTest {
+
+	/** The size of the walked memory region. */
+	private static final long BYTES = 64 * 1024 * 1024;
+
+	/** The distance between two reads, which touches a different regular memory page and cache line every time. */
+	private static final long STRIDE = 4096 + 64;
+
+	/** The number of times the memory region is walked. */
+	private static final int ROUNDS = 8;
+
+	/** The memory manager. */
+	@SuppressWarnings("NestedConditionalExpression")
+	private static final MemoryManager mmanager = MEMORY_MANAGER == PREFER_JNI_FULL
+			? JniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_JNI
+			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
+			: SmartUnsafeMemoryManager.getSingleton();
+
+	@Test
+	@DisplayName("Wrong arguments produce exceptions")
+	void exceptions() {
+		assumeTrue(!OPTIMIZED);
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> TlbCounter.dtlbMisses(0, 1, 1, 1));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> TlbCounter.dtlbMisses(1, 0, 1, 1));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> TlbCounter.dtlbMisses(1, 1, 0, 1));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> TlbCounter.dtlbMisses(1, 1, 1, 0));
+	}
+
+	@Test
+	@DisplayName("Huge memory pages produce fewer data TLB misses than regular memory pages")
+	void dtlbMisses(final TestReporter reporter) {
+		val regular = mmanager.allocate(BYTES, false, false);
+		assumeTrue(regular != 0);
+		try {
+			val baseline = walk(regular);
+			assumeTrue(baseline >= 0);
+			reporter.publishEntry("regular", Long.toString(baseline));
+			for (val pagesize : mmanager.getHugepageSizes()) {
+				val huge = mmanager.allocate(BYTES, pagesize, false);
+				if (huge == 0) continue;
+				try {
+					val misses = walk(huge);
+					reporter.publishEntry(Long.toString(pagesize), Long.toString(misses));
+					assertThat(misses).isNotNegative().isLessThanOrEqualTo(baseline);
+				} finally {
+					mmanager.free(huge, BYTES, pagesize, false);
+				}
+			}
+		} finally {
+			mmanager.free(regular, BYTES, false, false);
+		}
+	}
+
+	/**
+	 * Touches every memory page of a memory region and counts the data TLB misses of walking it.
+	 *
+	 * @param address The base address of the memory region.
+	 * @return The number of data TLB misses.
+	 */
+	private static long walk(final long address) {
+		for (var offset = 0L; offset < BYTES; offset += mmanager.getPageSize()) {
+			mmanager.putByte(address + offset, (byte) 0);
+		}
+		return TlbCounter.dtlbMisses(address, BYTES, STRIDE, ROUNDS);
+	}
+
+}
@@ -0,0 +1,102 @@
+package de.tum.in.net.ixy.utils;
+
+import lombok.val;
+
+import org.assertj.core.api.SoftAssertions;
+
+import org.jetbrains.annotations.NotNull;
+
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.parallel.Execution;
+import org.junit.jupiter.api.parallel.ExecutionMode;
+
+import static de.tum.in.net.ixy.BuildConfig.OPTIMIZED;
+
+import static org.assertj.core.api.Assertions.assertThat;
+import static org.assertj.core.api.Assertions.assertThatExceptionOfType;
+
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+/**
+ * Tests the class {@link Toeplitz} with the verification suite of the reference implementation.
+ *
+ * @author Esaú García Sánchez-Torija
+ */
+@DisplayName("Toeplitz")
+@Execution(ExecutionMode.CONCURRENT)
+final class ToeplitzTest {
+
+	/** The default key. */
+	private static final @NotNull byte[] KEY = Toeplitz.getDefaultKey();
+
+	/** The IPv6 address {@code 3ffe:2501:200:1fff::7}. */
+	private static final @NotNull byte[] IPV6_SOURCE = {
+			0x3F, (byte) 0xFE, 0x25, 0x01, 0x02, 0x00, 0x1F, (byte) 0xFF, 0, 0, 0, 0, 0, 0, 0, 0x07
+	};
+
+	/** The IPv6 address {@code 3ffe:2501:200:3::1}. */
+	private static final @NotNull byte[] IPV6_DESTINATION = {
+			0x3F, (byte) 0xFE, 0x25, 0x01, 0x02, 0x00, 0x00, 0x03, 0, 0, 0, 0, 0, 0, 0, 0x01
+	};
+
+	@Test
+	@DisplayName("Wrong arguments produce exceptions")
+	void exceptions() {
+		assumeTrue(!OPTIMIZED);
+		val input = new byte[Integer.BYTES];
+		assertThatExceptionOfType(NullPointerException.class).isThrownBy(() -> Toeplitz.hash(null, input, 0, 0));
+		assertThatExceptionOfType(NullPointerException.class).isThrownBy(() -> Toeplitz.hash(KEY, null, 0, 0));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> Toeplitz.hash(KEY, input, 1, 4));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> Toeplitz.hash(input, input, 0, 4));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> Toeplitz.ipv4(input, 0, 0));
+		assertThatExceptionOfType(IllegalArgumentException.class).isThrownBy(() -> Toeplitz.ipv6(KEY, input, input));
+	}
+
+	@Test
+	@DisplayName("getDefaultKey() returns a copy")
+	void getDefaultKey() {
+		val key = Toeplitz.getDefaultKey();
+		assertThat(key).hasSize(Toeplitz.KEY_BYTES).isEqualTo(KEY).isNotSameAs(KEY);
+	}
+
+	@Test
+	@DisplayName("ipv4(byte[], int, int) and ipv4(byte[], int, int, int, int) match the reference vectors")
+	void ipv4() {
+		val softly = new SoftAssertions();
+		softly.assertThat(Toeplitz.ipv4(KEY, 0x420995BB, 0xA18E6450)).isEqualTo(0x323E8FC2);
+		softly.assertThat(Toeplitz.ipv4(KEY, 0x420995BB, 0xA18E6450, 2794, 1766)).isEqualTo(0x51CCC178);
+		softly.assertThat(Toeplitz.ipv4(KEY, 0xC75C6F02, 0x41458C53)).isEqualTo(0xD718262A);
+		softly.assertThat(Toeplitz.ipv4(KEY, 0xC75C6F02, 0x41458C53, 14230, 4739)).isEqualTo(0xC626B0EA);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("ipv6(byte[], byte[], byte[]) and ipv6(byte[], byte[], byte[], int, int) match the reference vectors")
+	void ipv6() {
+		val softly = new SoftAssertions();
+		softly.assertThat(Toeplitz.ipv6(KEY, IPV6_SOURCE, IPV6_DESTINATION)).isEqualTo(0x2CC18CD5);
+		softly.assertThat(Toeplitz.ipv6(KEY, IPV6_SOURCE, IPV6_DESTINATION, 2794, 1766)).isEqualTo(0x40207D3D);
+		softly.assertAll();
+	}
+
+	@Test
+	@DisplayName("hash(byte[], byte[], int, int) matches the specialized methods")
+	void hash() {
+		val input = new byte[2 + 2 * Integer.BYTES + 2 * Short.BYTES];
+		val addresses = new int[]{0x420995BB, 0xA18E6450};
+		for (var i = 0; i < Integer.BYTES; i += 1) {
+			input[2 + i] = (byte) (addresses[0] >>> (Integer.SIZE - (i + 1) * Byte.SIZE));
+			input[2 + Integer.BYTES + i] = (byte) (addresses[1] >>> (Integer.SIZE - (i + 1) * Byte.SIZE));
+		}
+		input[10] = (byte) (2794 >>> Byte.SIZE);
+		input[11] = (byte) 2794;
+		input[12] = (byte) (1766 >>> Byte.SIZE);
+		input[13] = (byte) 1766;
+		val softly = new SoftAssertions();
+		softly.assertThat(Toeplitz.hash(KEY, input, 2, 2 * Integer.BYTES)).isEqualTo(0x323E8FC2);
+		softly.assertThat(Toeplitz.hash(KEY, input, 2, input.length - 2)).isEqualTo(0x51CCC178);
+		softly.assertAll();
+	}
+
+}
@@ -8,6 +8,7 @@ import de.tum.in.net.ixy.memory.Mempool;
 import de.tum.in.net.ixy.memory.PacketBufferWrapper;
 import de.tum.in.net.ixy.memory.SmartJniMemoryManager;
 import de.tum.in.net.ixy.memory.SmartUnsafeMemoryManager;
+import de.tum.in.net.ixy.memory.VarHandleMemoryManager;
 
 import java.io.FileNotFoundException;
 import java.io.IOException;
@@ -31,6 +32,7 @@ import static de.tum.in.net.ixy.forwarder.BuildConfig.LOG_WARN;
 import static de.tum.in.net.ixy.forwarder.BuildConfig.MEMORY_MANAGER;
 import static de.tum.in.net.ixy.forwarder.BuildConfig.PREFER_JNI;
 import static de.tum.in.net.ixy.forwarder.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.forwarder.BuildConfig.PREFER_VARHANDLE;
 
 @Slf4j
 @SuppressWarnings({"ConstantConditions", "UseOfSystemOutOrSystemErr", "CallToSystemGC"})
@@ -61,6 +63,8 @@ public final class Main {
 			? JniMemoryManager.getSingleton()
 			: MEMORY_MANAGER == PREFER_JNI
 			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
 			: SmartUnsafeMemoryManager.getSingleton();
 
 	////////////////////////////////////////////////// STATIC METHODS //////////////////////////////////////////////////
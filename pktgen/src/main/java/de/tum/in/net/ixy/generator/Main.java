@@ -3,19 +3,21 @@ package de.tum.in.net.ixy.generator;
 import de.tum.in.net.ixy.Device;
 import de.tum.in.net.ixy.Stats;
 import de.tum.in.net.ixy.ixgbe.IxgbeDevice;
+import de.tum.in.net.ixy.memory.Checksums;
 import de.tum.in.net.ixy.memory.JniMemoryManager;
 import de.tum.in.net.ixy.memory.MemoryManager;
 import de.tum.in.net.ixy.memory.Mempool;
 import de.tum.in.net.ixy.memory.PacketBufferWrapper;
+import de.tum.in.net.ixy.memory.PacketKernels;
 import de.tum.in.net.ixy.memory.PacketBufferWrapperConstants;
 import de.tum.in.net.ixy.memory.SmartJniMemoryManager;
 import de.tum.in.net.ixy.memory.SmartUnsafeMemoryManager;
+import de.tum.in.net.ixy.memory.VarHandleMemoryManager;
 
 import java.io.FileNotFoundException;
 import java.io.IOException;
-import java.nio.ByteBuffer;
-import java.nio.ByteOrder;
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 import java.util.Map;
 import java.util.TreeMap;
@@ -32,12 +34,11 @@ import static de.tum.in.net.ixy.generator.BuildConfig.DEBUG;
 import static de.tum.in.net.ixy.generator.BuildConfig.LOG_DEBUG;
 import static de.tum.in.net.ixy.generator.BuildConfig.LOG_ERROR;
 import static de.tum.in.net.ixy.generator.BuildConfig.LOG_INFO;
-import static de.tum.in.net.ixy.generator.BuildConfig.LOG_TRACE;
 import static de.tum.in.net.ixy.generator.BuildConfig.LOG_WARN;
 import static de.tum.in.net.ixy.generator.BuildConfig.MEMORY_MANAGER;
-import static de.tum.in.net.ixy.generator.BuildConfig.OPTIMIZED;
 import static de.tum.in.net.ixy.generator.BuildConfig.PREFER_JNI;
 import static de.tum.in.net.ixy.generator.BuildConfig.PREFER_JNI_FULL;
+import static de.tum.in.net.ixy.generator.BuildConfig.PREFER_VARHANDLE;
 import static de.tum.in.net.ixy.utils.Strings.leftPad;
 
 @Slf4j
@@ -60,52 +61,11 @@ public final class Main {
 
 	//////////////////////////////////////////// GENERATOR STATIC VARIABLES ////////////////////////////////////////////
 
-	/** The maximum value an unsigned short can have (low byte). */
-	private static final int MAX_UNSIGNED_SHORT_LOW = 0x00FF;
-
-	/** The maximum value an unsigned short can have (high byte). */
-	private static final int MAX_UNSIGNED_SHORT_HIGH = 0xFF00;
-
-	/** The maximum value an unsigned short can have. */
-	private static final int MAX_UNSIGNED_SHORT = MAX_UNSIGNED_SHORT_HIGH | MAX_UNSIGNED_SHORT_LOW;
-
 	/** The size of the whole packet data {@link #packetData}. */
 	private static final int PACKET_SIZE = 60;
 
-	//////////////////////////////////////////////// UDP PSEUDO-HEADER /////////////////////////////////////////////////
-
-	/** The size of the UDP pseudo header source address field. */
-	private static final int UDP_PH_SRC_SIZE = Integer.BYTES;
-
-	/** The offset of the UDP pseudo header source address field. */
-	private static final int UDP_PH_SRC_OFFSET = 0;
-
-	/** The size of the UDP pseudo header destination address field. */
-	private static final int UDP_PH_DEST_SIZE = Integer.BYTES;
-
-	/** The offset of the UDP pseudo header destination address field. */
-	private static final int UDP_PH_DEST_OFFSET = UDP_PH_SRC_OFFSET + UDP_PH_SRC_SIZE;
-
-	/** The size of the UDP pseudo header reserved field. */
-	private static final int UDP_PH_RSVD_SIZE = Byte.BYTES;
-
-	/** The offset of the UDP pseudo header reserved field. */
-	private static final int UDP_PH_RSVD_OFFSET = UDP_PH_DEST_OFFSET + UDP_PH_DEST_SIZE;
-
-	/** The size of the UDP pseudo header IPv4 protocol field. */
-	private static final int UDP_PH_PROTO_SIZE = Byte.BYTES;
-
-	/** The offset of the UDP pseudo header IPv4 protocol field. */
-	private static final int UDP_PH_PROTO_OFFSET = UDP_PH_RSVD_OFFSET + UDP_PH_RSVD_SIZE;
-
-	/** The size of the UDP pseudo header UDP length field. */
-	private static final int UDP_PH_LEN_SIZE = Short.BYTES;
-
-	/** The offset of the UDP pseudo header UDP length field. */
-	private static final int UDP_PH_LEN_OFFSET = UDP_PH_PROTO_OFFSET + UDP_PH_PROTO_SIZE;
-
-	/** The size of the UDP pseudo header. */
-	private static final int UDP_PH_SIZE = UDP_PH_SRC_SIZE + UDP_PH_DEST_SIZE + UDP_PH_RSVD_SIZE + UDP_PH_PROTO_SIZE + UDP_PH_LEN_SIZE;
+	/** The offset of the sequence number written to every packet, which overlaps the end of the UDP payload. */
+	private static final int SEQUENCE_OFFSET = PACKET_SIZE - Integer.BYTES;
 
 	/////////////////////////////////////////////// PACKET DATA TEMPLATE ///////////////////////////////////////////////
 
@@ -136,10 +96,10 @@ public final class Main {
 	 *     <li>Destination port: 1337 ({@code 0x0539})</li>
 	 *     <li>UDP length: 60 - Ethernet header - IP header ({@code 0x001A})</li>
 	 *     <li>UDP checksum: to be defined {@code 0x0000}</li>
-	 *     <li>UDP payload: ixy ({@code 0x697879})</li>
+	 *     <li>UDP payload: ixy ({@code 0x697879}), padded with zeros up to {@link #PACKET_SIZE}</li>
 	 * </ul>
 	 */
-	private static final @NotNull byte[] packetData = {
+	private static final @NotNull byte[] packetData = Arrays.copyOf(new byte[] {
 			// Ethernet frame header                                       (14 bytes)
 			0x01, 0x02, 0x03, 0x04, 0x05, 0x06, // Destination MAC address (6 bytes)
 			0x11, 0x12, 0x13, 0x14, 0x15, 0x16, // Source MAC address      (6 bytes)
@@ -163,7 +123,7 @@ public final class Main {
 
 			// UDP payload            (3 bytes)
 			0x69, 0x78, 0x79 // "ixy" (3 bytes)
-	};
+	}, PACKET_SIZE);
 
 	///////////////////////////////////////////////////// ETHERNET /////////////////////////////////////////////////////
 
@@ -231,6 +191,8 @@ public final class Main {
 			? JniMemoryManager.getSingleton()
 			: MEMORY_MANAGER == PREFER_JNI
 			? SmartJniMemoryManager.getSingleton()
+			: MEMORY_MANAGER == PREFER_VARHANDLE
+			? VarHandleMemoryManager.getSingleton()
 			: SmartUnsafeMemoryManager.getSingleton();
 
 	/** The memory pool. */
@@ -338,7 +300,8 @@ public final class Main {
 		// Objects to be used inside the loop
 		val stats = new Stats();
 		val buffers = new PacketBufferWrapper[argvBatchSize];
-		var sequence = 0;
+		val addresses = new long[argvBatchSize];
+		var sequence = 1;
 		var counter = (short) 0;
 
 		var startTime = System.nanoTime();
@@ -350,12 +313,10 @@ public final class Main {
 				break;
 			}
 
-			// Modify the data
+			// Refresh the data of the whole batch in a single pass
 			if (DEBUG >= LOG_DEBUG) log.debug("Updating {} packets.", batch);
-			for (var i = 0; i < batch; i += 1) {
-				val buffer = buffers[i];
-				buffer.putInt(PACKET_SIZE - 4, ++sequence);
-			}
+			for (var i = 0; i < batch; i += 1) addresses[i] = buffers[i].getVirtualAddress();
+			sequence = PacketKernels.patch(addresses, batch, packetData, packetData.length, SEQUENCE_OFFSET, sequence);
 
 			// Send the data
 			nic.txBusyWait(0, buffers, 0, batch);
@@ -385,31 +346,10 @@ public final class Main {
 	private static void initPackets() {
 		if (DEBUG >= LOG_INFO) log.info("Configuring packets.");
 
-		if (DEBUG >= LOG_DEBUG) log.debug("Computing IPv4 checksum.");
-		val checksumIp = checksum(packetData, IP_HEADER_OFFSET, IP_HEADER_SIZE);
-
-		if (DEBUG >= LOG_DEBUG) log.debug("Computing UDP checksum.");
-		val wrap = ByteBuffer.wrap(packetData);
-		val udpChecksumSize = UDP_PH_SIZE + UDP_HEADER_SIZE + (packetData.length - UDP_PAYLOAD_OFFSET);
-		val udpChecksumData = ByteBuffer.allocate(udpChecksumSize + udpChecksumSize % 2);
-		// Pseudo header data
-		udpChecksumData.putInt(UDP_PH_SRC_OFFSET, wrap.getInt(IP_HEADER_SRC_OFFSET));
-		udpChecksumData.putInt(UDP_PH_DEST_OFFSET, wrap.getInt(IP_HEADER_DEST_OFFSET));
-		udpChecksumData.put(UDP_PH_RSVD_OFFSET, (byte) 0);
-//		udpChecksumData.put(UDP_PH_PROTO_OFFSET, wrap.get(IP_HEADER_PROTO_OFFSET));
-		udpChecksumData.putShort(UDP_PH_LEN_OFFSET, wrap.get(UDP_HEADER_LEN_OFFSET));
-		// UDP header
-		udpChecksumData.position(UDP_PH_SIZE).put(wrap.limit(UDP_HEADER_OFFSET + UDP_HEADER_SIZE).position(UDP_HEADER_OFFSET));
-		// UDP payload
-		udpChecksumData.position(UDP_PH_SIZE + UDP_HEADER_SIZE).put(wrap.limit(UDP_PAYLOAD_OFFSET + UDP_PAYLOAD_SIZE).position(UDP_PAYLOAD_OFFSET));
-		// Compute the checksum
-		val checksumUdp = checksum(udpChecksumData.array(), 0, udpChecksumData.capacity());
-
-		if (DEBUG >= LOG_DEBUG) log.debug("Writing IPv4 checksum: 0x{}.", leftPad(checksumIp));
-		wrap.putShort(IP_CHECKSUM_OFFSET, checksumIp);
-
-		if (DEBUG >= LOG_DEBUG) log.debug("Writing UDP checksum: 0x{}.", leftPad(checksumUdp));
-		wrap.putShort(UDP_HEADER_CHECKSUM_OFFSET, checksumUdp);
+		// The NIC inserts the checksums, so the sequence number can change without recomputing them
+		if (DEBUG >= LOG_DEBUG) log.debug("Preparing IPv4 and UDP checksum offloading.");
+		val offload = Checksums.offload(packetData, IP_HEADER_OFFSET);
+		if (DEBUG >= LOG_DEBUG) log.debug("Offload flags: 0x{}.", leftPad(offload));
 
 		if (DEBUG >= LOG_INFO) {
 			log.debug("Ethernet header : {}.", toHexString(packetData, ETHERNET_HEADER_OFFSET, ETHERNET_HEADER_SIZE));
@@ -418,78 +358,17 @@ public final class Main {
 			log.debug("UDP payload     : {}.", toHexString(packetData, UDP_PAYLOAD_OFFSET, UDP_PAYLOAD_SIZE));
 		}
 
-		val tmp = new PacketBufferWrapper[mempool.capacity()];
-		var counter = 0;
-		PacketBufferWrapper buffer;
+		// Write the data and the size of all the packets at once
+		val addresses = new long[mempool.capacity()];
+		val count = mempool.pop(addresses, addresses.length);
 		if (DEBUG >= LOG_DEBUG) {
-			while ((buffer = mempool.pop()) != null) {
-				if (buffer == null) {
-					log.error("A packet buffer wrapper was 'null' and that MUST NOT happen.");
-					System.exit(0);
-				}
-
-				log.debug(">>> Writing packet data to packet #{}: {}", counter, buffer);
-
-				if (DEBUG >= LOG_TRACE) log.trace("Setting packet size.");
-				buffer.setSize(packetData.length);
-
-				if (DEBUG >= LOG_TRACE) log.trace("Write data.");
-				buffer.put(0, packetData.length, packetData);
-				tmp[counter++] = buffer;
-			}
-		} else {
-			while ((buffer = mempool.pop()) != null) {
-				if (buffer == null) {
-					if (DEBUG >= LOG_ERROR) log.error("A packet buffer wrapper was 'null' and that MUST NOT happen.");
-					System.exit(0);
-				}
-				buffer.setSize(packetData.length);
-				buffer.put(0, packetData.length, packetData);
-				tmp[counter++] = buffer;
-			}
-		}
-		for (var i = tmp.length - 1; i >= 0; i--) {
-			mempool.push(tmp[i]);
-		}
-	}
-
-	/**
-	 * Computes the IPv4 header checksum based on the bytes of a packet.
-	 *
-	 * @param data   The data to compute the checksum of.
-	 * @param offset The offset in which the IPv4 header starts.
-	 * @return The IPv4 checksum.
-	 */
-	private static short checksum(final @NotNull byte[] data, final int offset, int length) {
-		if (!OPTIMIZED) {
-			if (offset < 0) throw new ArrayIndexOutOfBoundsException("The parameter 'offset' MUST be positive.");
-			if (offset + length > data.length) {
-				throw new IllegalArgumentException("There are not as many bytes to read as expected.");
-			}
+			log.debug(">>> Writing packet data to {} packets with the '{}' kernels.", count, PacketKernels.getKernel());
 		}
-
-		// Trace message
-		if (DEBUG >= LOG_WARN) {
-			if (DEBUG >= LOG_DEBUG) log.trace("Computing checksum of {} bytes.", length);
-			if (length % 2 != 0) {
-				log.warn("Odd-sized headers are not supported, the last byte will be ignored.");
-				length -= 1;
-			}
+		PacketKernels.patch(addresses, count, packetData, packetData.length, SEQUENCE_OFFSET, 0);
+		for (var i = 0; i < count; i += 1) {
+			mmanager.putInt(addresses[i] + PacketBufferWrapperConstants.OFL_OFFSET, offload);
 		}
-
-		// Create a short-based view of the array using the native byte order
-		val buffer = ByteBuffer.wrap(data, offset, length).order(ByteOrder.nativeOrder()).asShortBuffer();
-
-		// Compute the sum of all shorts
-		var sum = 0;
-		for (int i = 0; i < length / 2; i += 1) {
-			sum += buffer.get(i);
-		}
-
-		// Fix the carried bits
-		val carry = (sum >> Short.SIZE) & MAX_UNSIGNED_SHORT_LOW;
-		var finalSum = (sum & MAX_UNSIGNED_SHORT) + carry;
-		return (short) ~((short) finalSum & MAX_UNSIGNED_SHORT);
+		mempool.push(addresses, count);
 	}
 
 	/**